@@ -52,6 +52,18 @@ void test1()
     // If compiled with optimisations turned on, the following doesn't even
     // appear in the generated assembly.
     if (cmap.find(10) != nullptr) std::terminate();
+
+    // Quality of the hash table can be checked at compile-time...
+    constexpr auto stats = cmap.statistics();
+    static_assert(stats.max_probe_length <= 1, "Too many collisions!");
+    // ... or printed at runtime.
+    std::cout << "elements:           " << stats.element_count << '\n'
+              << "buckets:            " << stats.bucket_count << '\n'
+              << "load factor:        " << stats.load_factor() << '\n'
+              << "max probe length:   " << stats.max_probe_length << '\n'
+              << "mean probe length:  " << stats.mean_probe_length() << '\n'
+              << "miss probes (avg.): " << stats.expected_miss_probes() << '\n'
+              << "bytes:              " << stats.bytes << '\n';
 }
 
 int main()
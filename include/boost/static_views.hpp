@@ -9,22 +9,44 @@
 #define BOOST_STATIC_VIEWS_STATIC_VIEWS_HPP
 
 #include "static_views/algorithm_base.hpp"
+#include "static_views/atomic_snapshot.hpp"
+#include "static_views/case_insensitive.hpp"
 #include "static_views/chunk.hpp"
+#include "static_views/composite_key.hpp"
+#include "static_views/dispatch_table.hpp"
 #include "static_views/drop.hpp"
 #include "static_views/errors.hpp"
 #include "static_views/flatten.hpp"
+#include "static_views/for_each.hpp"
 #include "static_views/hash_c.hpp"
+#include "static_views/hash_many.hpp"
 #include "static_views/hashed.hpp"
+#include "static_views/hashed_statistics.hpp"
 #include "static_views/iterator.hpp"
+#include "static_views/lfold.hpp"
+#include "static_views/linear_scan.hpp"
+#include "static_views/overlay_map.hpp"
+#include "static_views/lookup_counters.hpp"
+#include "static_views/materialize.hpp"
+#include "static_views/packed_hashed.hpp"
+#include "static_views/parallel.hpp"
+#include "static_views/parallel_hashed.hpp"
 #include "static_views/pipe.hpp"
 #include "static_views/raw_view.hpp"
+#include "static_views/reduce.hpp"
 #include "static_views/sequence_traits.hpp"
 #include "static_views/slice.hpp"
+#include "static_views/static_interval_map.hpp"
 #include "static_views/static_map.hpp"
+#include "static_views/static_trie.hpp"
+#include "static_views/string_equal.hpp"
+#include "static_views/string_interner.hpp"
+#include "static_views/string_pool.hpp"
 #include "static_views/take.hpp"
 #include "static_views/through.hpp"
 #include "static_views/transform.hpp"
 #include "static_views/view_base.hpp"
 #include "static_views/view_concept.hpp"
+#include "static_views/zip.hpp"
 
 #endif // BOOST_STATIC_VIEWS_STATIC_VIEWS_HPP
@@ -0,0 +1,270 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/atomic_snapshot.hpp
+///
+/// \brief Implementation of #atomic_snapshot.
+
+#ifndef BOOST_STATIC_VIEWS_ATOMIC_SNAPSHOT_HPP
+#define BOOST_STATIC_VIEWS_ATOMIC_SNAPSHOT_HPP
+
+#include "detail/config.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Epoch-based reclamation.
+//
+// Every thread which reads from an atomic_snapshot owns a record. While the
+// thread is inside a read-side critical section, the record holds the value
+// of the global epoch at the time the section was entered; otherwise it holds
+// zero. An object retired at epoch e may be destroyed once no record holds a
+// non-zero value <= e: every reader that entered afterwards is guaranteed to
+// see the new pointer.
+//
+// Records are never deallocated. When a thread exits, its record is marked
+// free and will be reused by the next new thread.
+//
+// Records are allocated with new, so they can only be aligned to cache lines
+// when over-aligned new is available (C++17).
+#if defined(__cpp_aligned_new)
+constexpr std::size_t epoch_record_alignment = 64;
+#else
+constexpr std::size_t epoch_record_alignment = alignof(std::max_align_t);
+#endif
+
+struct alignas(epoch_record_alignment) epoch_record {
+    std::atomic<std::uint64_t> epoch;
+    std::atomic<bool>          in_use;
+    epoch_record*              next;
+    // Only accessed by the owning thread.
+    unsigned depth;
+};
+
+struct epoch_domain {
+    std::atomic<std::uint64_t> global_epoch{1};
+    std::atomic<epoch_record*> head{nullptr};
+
+    auto acquire_record() -> epoch_record*
+    {
+        for (auto* p = head.load(std::memory_order_acquire); p != nullptr;
+             p       = p->next) {
+            bool expected = false;
+            if (!p->in_use.load(std::memory_order_relaxed)
+                && p->in_use.compare_exchange_strong(
+                       expected, true, std::memory_order_acquire)) {
+                return p;
+            }
+        }
+        auto* p = new epoch_record{};
+        p->in_use.store(true, std::memory_order_relaxed);
+        p->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(
+            p->next, p, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return p;
+    }
+
+    static auto release_record(epoch_record& r) noexcept -> void
+    {
+        r.epoch.store(0, std::memory_order_release);
+        r.in_use.store(false, std::memory_order_release);
+    }
+
+    // Returns the smallest epoch pinned by any thread, or
+    // numeric_limits<uint64_t>::max() if no thread is reading.
+    auto min_pinned_epoch() const noexcept -> std::uint64_t
+    {
+        auto result = ~std::uint64_t{0};
+        for (auto* p = head.load(std::memory_order_acquire); p != nullptr;
+             p       = p->next) {
+            auto const e = p->epoch.load(std::memory_order_seq_cst);
+            if (e != 0 && e < result) result = e;
+        }
+        return result;
+    }
+};
+
+inline auto global_epoch_domain() -> epoch_domain&
+{
+    static epoch_domain domain;
+    return domain;
+}
+
+struct thread_epoch_record {
+    epoch_record* record;
+
+    thread_epoch_record()
+        : record{global_epoch_domain().acquire_record()}
+    {
+    }
+
+    ~thread_epoch_record() { epoch_domain::release_record(*record); }
+};
+
+inline auto this_thread_epoch_record() -> epoch_record&
+{
+    static thread_local thread_epoch_record r;
+    return *r.record;
+}
+
+} // end namespace detail
+
+/// \brief Holder of an immutable object which can be replaced at runtime
+/// without blocking readers.
+
+/// This is meant for tables (e.g. #static_map instances built from views of
+/// runtime data) which are occasionally reloaded while being read by many
+/// threads. Readers obtain a #guard via #read() and may use the object for
+/// as long as the guard lives. #publish() replaces the object with one
+/// atomic pointer swap. The old object is destroyed as soon as no guard
+/// created before the swap remains alive (epoch-based reclamation).
+///
+/// Reading costs two atomic loads and one store to a thread-local
+/// cache-line-sized record, no read-modify-write operations on shared
+/// memory. Writers are serialised by a mutex.
+template <class T>
+class atomic_snapshot {
+  public:
+    using element_type = T;
+
+    /// \brief RAII read-side critical section.
+
+    /// The referenced object is guaranteed to stay alive until the guard is
+    /// destroyed. Guards may be nested, but must not be moved to another
+    /// thread.
+    class guard {
+        detail::epoch_record* _record;
+        T const*              _value;
+
+        friend class atomic_snapshot;
+
+        guard(detail::epoch_record& r, std::atomic<T*> const& p) noexcept
+            : _record{&r}, _value{nullptr}
+        {
+            if (r.depth++ == 0) {
+                auto& domain = detail::global_epoch_domain();
+                r.epoch.store(
+                    domain.global_epoch.load(std::memory_order_seq_cst),
+                    std::memory_order_seq_cst);
+            }
+            _value = p.load(std::memory_order_seq_cst);
+        }
+
+      public:
+        guard(guard const&) = delete;
+        guard& operator=(guard const&) = delete;
+        guard& operator=(guard&&) = delete;
+
+        guard(guard&& other) noexcept
+            : _record{other._record}, _value{other._value}
+        {
+            other._record = nullptr;
+        }
+
+        ~guard()
+        {
+            if (_record != nullptr && --_record->depth == 0) {
+                _record->epoch.store(0, std::memory_order_release);
+            }
+        }
+
+        auto get() const noexcept -> T const& { return *_value; }
+        auto operator*() const noexcept -> T const& { return *_value; }
+        auto operator-> () const noexcept -> T const* { return _value; }
+    };
+
+  private:
+    struct retired_type {
+        std::uint64_t      epoch;
+        std::unique_ptr<T> value;
+    };
+
+    std::atomic<T*>           _current;
+    std::mutex                _write_mutex;
+    std::vector<retired_type> _retired;
+
+    // Must be called with _write_mutex held.
+    auto reclaim_impl() -> std::size_t
+    {
+        auto const min_epoch = detail::global_epoch_domain().min_pinned_epoch();
+        _retired.erase(std::remove_if(_retired.begin(), _retired.end(),
+                           [min_epoch](auto const& x) {
+                               return x.epoch < min_epoch;
+                           }),
+            _retired.end());
+        return _retired.size();
+    }
+
+  public:
+    /// \brief Creates a snapshot holding \p initial which must not be null.
+    explicit atomic_snapshot(std::unique_ptr<T> initial)
+        : _current{initial.release()}, _write_mutex{}, _retired{}
+    {
+    }
+
+    atomic_snapshot(atomic_snapshot const&) = delete;
+    atomic_snapshot(atomic_snapshot&&)      = delete;
+    atomic_snapshot& operator=(atomic_snapshot const&) = delete;
+    atomic_snapshot& operator=(atomic_snapshot&&) = delete;
+
+    /// \brief Destroys the current and all retired objects.
+
+    /// There must be no live guards.
+    ~atomic_snapshot()
+    {
+        delete _current.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Enters a read-side critical section and returns a guard giving
+    /// access to the current object.
+    auto read() const -> guard
+    {
+        return guard{detail::this_thread_epoch_record(), _current};
+    }
+
+    /// \brief Replaces the current object with \p x which must not be null.
+
+    /// The old object is retired and destroyed once all readers which might
+    /// still be using it are gone. This function also tries to destroy
+    /// objects retired by previous calls.
+    auto publish(std::unique_ptr<T> x) -> void
+    {
+        std::lock_guard<std::mutex> lock{_write_mutex};
+        // Make sure push_back below can't throw.
+        _retired.reserve(_retired.size() + 1);
+        std::unique_ptr<T> old{
+            _current.exchange(x.release(), std::memory_order_seq_cst)};
+        // Readers which pin the new epoch are guaranteed to see the new
+        // pointer, so old is only reachable by readers pinning epoch or an
+        // earlier one.
+        auto const epoch =
+            detail::global_epoch_domain().global_epoch.fetch_add(
+                1, std::memory_order_seq_cst);
+        _retired.push_back(retired_type{epoch, std::move(old)});
+        reclaim_impl();
+    }
+
+    /// \brief Destroys all retired objects which are no longer in use and
+    /// returns the number of objects which are still waiting.
+    auto reclaim() -> std::size_t
+    {
+        std::lock_guard<std::mutex> lock{_write_mutex};
+        return reclaim_impl();
+    }
+};
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_ATOMIC_SNAPSHOT_HPP
@@ -0,0 +1,265 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/case_insensitive.hpp
+///
+/// \brief Implementation of #case_insensitive_hash and
+/// #case_insensitive_equal.
+
+#ifndef BOOST_STATIC_VIEWS_CASE_INSENSITIVE_HPP
+#define BOOST_STATIC_VIEWS_CASE_INSENSITIVE_HPP
+
+#include "detail/config.hpp"
+#include "hash_c.hpp"
+#include "string_equal.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto fold_case(char const c) noexcept -> unsigned char
+{
+    auto const x = static_cast<unsigned char>(c);
+    return (x >= 'A' && x <= 'Z') ? static_cast<unsigned char>(x | 0x20) : x;
+}
+
+// Lowercases all ASCII letters in w at once. For every byte below 0x80,
+// adding 0x3f (resp. 0x25) sets the high bit iff the byte is at least 'A'
+// (resp. greater than 'Z'). Bytes with the high bit set are left alone.
+template <class Word>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto fold_case_word(
+    Word const w) noexcept -> Word
+{
+    constexpr auto ones  = static_cast<Word>(~Word{0}) / 0xFF;
+    constexpr auto highs = static_cast<Word>(ones * 0x80);
+    auto const     low   = static_cast<Word>(w & ~highs);
+    auto const     ge_a  = static_cast<Word>(low + ones * (0x80 - 'A'));
+    auto const     gt_z  = static_cast<Word>(low + ones * (0x7F - 'Z'));
+    return static_cast<Word>(w | (((ge_a ^ gt_z) & ~w & highs) >> 2));
+}
+
+#if defined(__SSE2__)
+BOOST_STATIC_VIEWS_FORCEINLINE
+auto fold_case_sse2(__m128i const v) noexcept -> __m128i
+{
+    // 'A'..'Z' are shifted to -128..-103, the only values below -102.
+    auto const shifted = _mm_add_epi8(v, _mm_set1_epi8(0x80 - 'A'));
+    auto const upper =
+        _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + 26)));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+#if defined(BOOST_STATIC_VIEWS_GCC)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+// Same structure as equal_bytes_runtime, with both sides folded.
+BOOST_STATIC_VIEWS_FORCEINLINE
+auto iequal_bytes_runtime(char const* const a, char const* const b,
+    std::size_t const n) noexcept -> bool
+{
+    if (n < 4) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (fold_case(a[i]) != fold_case(b[i])) return false;
+        }
+        return true;
+    }
+    if (n <= 8) {
+        using word = std::uint32_t;
+        return ((fold_case_word(load_unaligned<word>(a))
+                    ^ fold_case_word(load_unaligned<word>(b)))
+                   | (fold_case_word(load_unaligned<word>(a + n - 4))
+                         ^ fold_case_word(load_unaligned<word>(b + n - 4))))
+               == 0;
+    }
+    if (n <= 16) {
+        using word = std::uint64_t;
+        return ((fold_case_word(load_unaligned<word>(a))
+                    ^ fold_case_word(load_unaligned<word>(b)))
+                   | (fold_case_word(load_unaligned<word>(a + n - 8))
+                         ^ fold_case_word(load_unaligned<word>(b + n - 8))))
+               == 0;
+    }
+#if defined(__SSE2__)
+    auto const load = [](char const* const p) {
+        return fold_case_sse2(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+    };
+    for (std::size_t i = 0; i + 16 < n; i += 16) {
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(load(a + i), load(b + i)))
+            != 0xFFFF)
+            return false;
+    }
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(load(a + n - 16), load(b + n - 16)))
+           == 0xFFFF;
+#else
+    using word = std::uint64_t;
+    for (std::size_t i = 0; i + 8 < n; i += 8) {
+        if (fold_case_word(load_unaligned<word>(a + i))
+            != fold_case_word(load_unaligned<word>(b + i)))
+            return false;
+    }
+    return fold_case_word(load_unaligned<word>(a + n - 8))
+           == fold_case_word(load_unaligned<word>(b + n - 8));
+#endif
+}
+
+#if defined(BOOST_STATIC_VIEWS_GCC)
+#pragma GCC diagnostic pop
+#endif
+
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto iequal_bytes(char const* const a, char const* const b,
+    std::size_t const n) noexcept -> bool
+{
+    if (!BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED()) {
+        return iequal_bytes_runtime(a, b, n);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        if (fold_case(a[i]) != fold_case(b[i])) return false;
+    }
+    return true;
+}
+
+// Little-endian word made of the n <= 8 bytes at p, with the remaining
+// bytes zero.
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto load_word_le(char const* const p, std::size_t const n) noexcept
+    -> std::uint64_t
+{
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        word |= std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+    }
+    return word;
+}
+
+// The hash is defined on little-endian 8-byte words of the folded string,
+// so that it can be computed a word at a time at runtime and byte by byte
+// during constant evaluation.
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto ihash_bytes(char const* const p, std::size_t const n) noexcept
+    -> std::size_t
+{
+    std::size_t hash = n;
+    std::size_t i    = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED()) {
+        for (; i + 8 <= n; i += 8) {
+            hash = hash_combine(hash,
+                static_cast<std::size_t>(
+                    fold_case_word(load_unaligned<std::uint64_t>(p + i))));
+        }
+    }
+#endif
+    for (; i + 8 <= n; i += 8) {
+        hash = hash_combine(hash,
+            static_cast<std::size_t>(fold_case_word(load_word_le(p + i, 8))));
+    }
+    if (i != n) {
+        hash = hash_combine(hash, static_cast<std::size_t>(fold_case_word(
+                                      load_word_le(p + i, n - i))));
+    }
+    return hash;
+}
+
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto c_str_length(char const* const str) noexcept -> std::size_t
+{
+    if (!BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED()) {
+        return std::strlen(str);
+    }
+    std::size_t n = 0;
+    while (str[n] != '\0') {
+        ++n;
+    }
+    return n;
+}
+
+} // namespace detail
+
+/// \brief ASCII case-insensitive hash of strings meant to be used as the
+/// hasher of #static_map together with #case_insensitive_equal.
+
+/// Strings which differ only in the case of ASCII letters have equal
+/// hashes. Letters are folded inline, eight characters at a time, so the
+/// query doesn't need to be lowercased into a temporary buffer first. The
+/// hashes of the keys stored in a #static_map are computed at compile-time.
+/// Accepts NUL-terminated strings and string types with `data()` and
+/// `size()` (#pooled_string, `std::string_view`, `std::string`), which hash
+/// the same way.
+struct case_insensitive_hash {
+    // clang-format off
+    template <class String
+        BOOST_STATIC_VIEWS_REQUIRES(detail::is_char_string<String>::value)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(String const& str) const noexcept -> std::size_t
+    // clang-format on
+    {
+        return detail::ihash_bytes(
+            str.data(), static_cast<std::size_t>(str.size()));
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(char const* const str) const noexcept -> std::size_t
+    {
+        return detail::ihash_bytes(str, detail::c_str_length(str));
+    }
+};
+
+/// \brief ASCII case-insensitive equality of strings meant to be used as
+/// `key_equal` of #static_map together with #case_insensitive_hash.
+
+/// Like #string_equal, sizes are compared first, and characters are then
+/// folded and compared 16 (SSE2) or 8 bytes at a time. Only `'A'`-`'Z'` are
+/// folded, all other bytes have to match exactly.
+struct case_insensitive_equal {
+    // clang-format off
+    template <class String
+        BOOST_STATIC_VIEWS_REQUIRES(detail::is_char_string<String>::value)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(String const& a, String const& b) const noexcept -> bool
+    // clang-format on
+    {
+        return a.size() == b.size()
+               && detail::iequal_bytes(a.data(), b.data(),
+                      static_cast<std::size_t>(a.size()));
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(char const* const a, char const* const b) const noexcept
+        -> bool
+    {
+        std::size_t i = 0;
+        while (a[i] != '\0'
+               && detail::fold_case(a[i]) == detail::fold_case(b[i])) {
+            ++i;
+        }
+        return a[i] == b[i];
+    }
+};
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_CASE_INSENSITIVE_HPP
@@ -25,6 +25,23 @@ namespace detail {
 struct chunk_size_tag {
 };
 
+// Returns the view of the n elements of xs starting at i.
+template <std::ptrdiff_t ChunkSize, class V, class IndexType>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto make_chunk(
+    V const& xs, IndexType const i, IndexType const n,
+    std::false_type /*is static*/)
+    BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+        take_exactly(drop_exactly(xs, i), n));
+
+template <std::ptrdiff_t ChunkSize, class V, class IndexType>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto make_chunk(
+    V const& xs, IndexType const i, IndexType /*unused*/,
+    std::true_type /*is static*/)
+    BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+        take_exactly(drop_exactly(xs, i),
+            std::integral_constant<IndexType,
+                static_cast<IndexType>(ChunkSize)>{}));
+
 template <class Wrapper, std::ptrdiff_t ChunkSize>
 struct chunk_view_impl
     : public view_adaptor_base<chunk_view_impl<Wrapper, ChunkSize>, Wrapper>
@@ -46,9 +63,12 @@ struct chunk_view_impl
   private:
     typename base::index_type _chunk_count;
 
+    using view_type = std::remove_cv_t<typename Wrapper::value_type>;
     using chunk_size_type =
         compact_index<chunk_size_tag, index_type, ChunkSize>;
     using chunk_size_type::index;
+    using is_static =
+        std::integral_constant<bool, ChunkSize != dynamic_extent>;
 
     BOOST_STATIC_VIEWS_CONSTEXPR
     auto chunk_count() const noexcept -> index_type { return _chunk_count; }
@@ -79,7 +99,7 @@ struct chunk_view_impl
     BOOST_STATIC_VIEWS_PURE
     BOOST_STATIC_VIEWS_CONSTEXPR auto size() const noexcept -> size_type
     {
-        return static_cast<size_type>(chunk_size());
+        return static_cast<size_type>(chunk_count());
     }
 
     static constexpr auto extent() noexcept -> std::ptrdiff_t
@@ -87,27 +107,12 @@ struct chunk_view_impl
         return dynamic_extent;
     }
 
-  private:
-    // clang-format off
-    BOOST_STATIC_VIEWS_FORCEINLINE
-    BOOST_STATIC_VIEWS_CONSTEXPR
-    auto unsafe_at_impl(index_type const i, std::true_type /*is static*/) const
-        BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true)
-    // clang-format on
-    {
-        return take_exactly(drop_exactly(parent(), i),
-            std::integral_constant<index_type, ChunkSize>{});
-    }
-
-    // clang-format off
-    BOOST_STATIC_VIEWS_FORCEINLINE
-    BOOST_STATIC_VIEWS_CONSTEXPR
-    auto unsafe_at_impl(index_type const i, std::false_type /*is static*/) const
-        BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true)
-    // clang-format on
-    {
-        return take_exactly(drop_exactly(parent(), i), chunk_size());
-    }
+    // Computed from the parent, since the class is incomplete here.
+    using reference =
+        decltype(make_chunk<ChunkSize>(std::declval<view_type const&>(),
+            std::declval<index_type>(), std::declval<index_type>(),
+            is_static{}));
+    using value_type = reference;
 
   public:
     BOOST_STATIC_VIEWS_FORCEINLINE
@@ -119,9 +124,8 @@ struct chunk_view_impl
             "boost::static_views::chunk_view_impl::unsafe_at: Precondition "
             "`0 <= i < size()` is not satisfied.");
         auto const start = chunk_size() * i;
-        return unsafe_at_impl(
-            start, std::integral_constant<bool,
-                       chunk_size_type::extent() != dynamic_extent>{});
+        return make_chunk<ChunkSize>(
+            parent(), start, chunk_size(), is_static{});
     }
 
     BOOST_STATIC_VIEWS_FORCEINLINE
@@ -135,14 +139,25 @@ struct chunk_view_impl
                 "boost::static_views::chunk_view_impl::operator[].");
             BOOST_STATIC_VIEWS_UNREACHABLE;
         }
-        // TODO: using ChunkSize explicitly here is ugly, but Clang barfs
-        // on chunk_size_type::extent().
-        return unsafe_at_impl(
-            start, std::integral_constant<bool, ChunkSize != dynamic_extent>{});
+        return make_chunk<ChunkSize>(
+            parent(), start, chunk_size(), is_static{});
     }
 
-    using reference = decltype(std::declval<chunk_view_impl const&>()[std::declval<index_type>()]);
-    using value_type = std::remove_reference_t<reference>;
+    /// \brief Calls `f` for chunks in order until it returns `false`.
+
+    /// A strided loop over the parent view. See #for_each_while.
+    template <class F>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto for_each_while(F& f) const -> bool
+    {
+        auto const n    = chunk_size();
+        auto const size = static_cast<index_type>(parent().size());
+        for (index_type start = 0; start < size; start += n) {
+            auto const chunk =
+                make_chunk<ChunkSize>(parent(), start, n, is_static{});
+            if (!invoke(f, chunk)) return false;
+        }
+        return true;
+    }
 };
 
 struct chunk_impl {
@@ -99,6 +99,48 @@ BOOST_STATIC_VIEWS_CONSTEXPR auto index(
     return compact_index<Tag, IndexType, I>{};
 }
 
+namespace detail {
+template <class Tag, class IndexType, std::ptrdiff_t Extent>
+BOOST_STATIC_VIEWS_CONSTEXPR auto make_index(
+    IndexType const /*unused*/, std::true_type /*is static*/) noexcept
+{
+    return compact_index<Tag, IndexType, Extent>{};
+}
+
+template <class Tag, class IndexType, std::ptrdiff_t Extent>
+BOOST_STATIC_VIEWS_CONSTEXPR auto make_index(
+    IndexType const x, std::false_type /*is static*/) noexcept
+{
+    return compact_index<Tag, IndexType>{x};
+}
+} // namespace detail
+
+/// \brief Returns `a + b`. The result is a compile-time constant if both
+/// \p a and \p b are.
+template <class Tag, class TagA, class TagB, class IndexType,
+    std::ptrdiff_t ExtentA, std::ptrdiff_t ExtentB>
+BOOST_STATIC_VIEWS_CONSTEXPR auto add_indices(
+    compact_index<TagA, IndexType, ExtentA> const a,
+    compact_index<TagB, IndexType, ExtentB> const b) noexcept
+{
+    return detail::make_index<Tag, IndexType, ExtentA + ExtentB>(
+        static_cast<IndexType>(a.index() + b.index()),
+        std::integral_constant<bool, (ExtentA >= 0 && ExtentB >= 0)>{});
+}
+
+/// \brief Returns `a - b`. The result is a compile-time constant if both
+/// \p a and \p b are.
+template <class Tag, class TagA, class TagB, class IndexType,
+    std::ptrdiff_t ExtentA, std::ptrdiff_t ExtentB>
+BOOST_STATIC_VIEWS_CONSTEXPR auto subtract_indices(
+    compact_index<TagA, IndexType, ExtentA> const a,
+    compact_index<TagB, IndexType, ExtentB> const b) noexcept
+{
+    return detail::make_index<Tag, IndexType, ExtentA - ExtentB>(
+        static_cast<IndexType>(a.index() - b.index()),
+        std::integral_constant<bool, (ExtentA >= 0 && ExtentB >= 0)>{});
+}
+
 #define BOOST_STATIC_VIEWS_DECLARE_BIN_OP(op)                                  \
     template <class Tag, class IndexType, std::ptrdiff_t ExtentA,              \
         std::ptrdiff_t ExtentB>                                                \
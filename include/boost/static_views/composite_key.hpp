@@ -0,0 +1,108 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/composite_key.hpp
+///
+/// \brief Implementation of #composite_key.
+
+#ifndef BOOST_STATIC_VIEWS_COMPOSITE_KEY_HPP
+#define BOOST_STATIC_VIEWS_COMPOSITE_KEY_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "hash_c.hpp"
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+template <class... Getters>
+struct composite_key_impl {
+  private:
+    std::tuple<Getters...> _getters;
+
+    template <class T, std::size_t... Is>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        T const& x, std::index_sequence<Is...> /*unused*/) const
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(noexcept(std::tuple<
+            invoke_t<Getters const&, T const&>...>{
+            invoke(std::get<Is>(_getters), x)...}))
+    {
+        return std::tuple<invoke_t<Getters const&, T const&>...>{
+            invoke(std::get<Is>(_getters), x)...};
+    }
+
+  public:
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    explicit composite_key_impl(Getters... getters)
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+            std::is_nothrow_move_constructible<std::tuple<Getters...>>::value)
+        : _getters{std::move(getters)...}
+    {
+    }
+
+    // clang-format off
+    template <class T
+        BOOST_STATIC_VIEWS_REQUIRES(
+            all(is_invocable<Getters const&, T const&>::value...))
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(T const& x) const
+    // clang-format on
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(noexcept(
+            std::declval<composite_key_impl const&>().call_impl(
+                x, std::index_sequence_for<Getters...>{})))
+    {
+        return call_impl(x, std::index_sequence_for<Getters...>{});
+    }
+};
+
+struct make_composite_key_impl {
+    template <class... Getters>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto operator()(Getters&&... getters) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            composite_key_impl<std::decay_t<Getters>...>{
+                std::forward<Getters>(getters)...});
+};
+} // namespace detail
+
+/// \brief Combines several key getters into one.
+
+/// `composite_key(get_1, ..., get_n)(x)` returns
+/// `std::tuple<invoke_t<get_1, x>, ..., invoke_t<get_n, x>>`. For pointers
+/// to data members this is a tuple of references, so no key columns are
+/// copied. It is meant to be used as the `GetKey` argument of
+/// #make_static_map_impl:
+///
+/// \code
+/// struct usb_device {
+///     std::uint16_t vendor;
+///     std::uint16_t product;
+///     char const*   name;
+/// };
+/// static constexpr auto devices = make_static_map_impl<>{}(raw_view(table),
+///     composite_key(&usb_device::vendor, &usb_device::product),
+///     &usb_device::name);
+/// devices.find({0x046d, 0xc52b});
+/// \endcode
+///
+/// The `key_type` of such a map is the corresponding tuple of values, so
+/// the braced list above is copied into the key rather than bound to
+/// references which would dangle. The hash of a tuple combines the hashes
+/// of its elements (see `hash_impl<std::tuple<Ts...>>`), and the default
+/// `std::equal_to<void>` compares tuples element-wise.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto composite_key = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(
+    detail::make_composite_key_impl, composite_key)
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_COMPOSITE_KEY_HPP
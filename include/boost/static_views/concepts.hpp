@@ -401,6 +401,18 @@ template <class T>
 using HasMap =
     is_detected<has_map_t, T const&, typename T::index_type>;
 
+template <class T>
+using has_data_t = decltype(std::declval<T>().data());
+
+template <class T, class = void>
+struct HasDataWithType : std::false_type {};
+
+template <class T>
+struct HasDataWithType<T, void_t<typename T::value_type>>
+    : std::is_same<detected_t<has_data_t, T const&>,
+          typename T::value_type*> {
+};
+
 } // namespace detail
 
 #if defined(BOOST_STATIC_VIEWS_CONCEPTS)
@@ -450,6 +462,10 @@ template <class T>
 concept bool HasMap = requires(T const& x, typename T::index_type i) {
     x.map(i);
 };
+template <class T>
+concept bool HasDataWithType = requires(T const& x) {
+    { x.data() } -> typename T::value_type*;
+};
 // clang-format on
 #else
 template <class T>
@@ -471,6 +487,8 @@ constexpr bool HasUnsafeAtWithType =
     detail::HasUnsafeAtWithType<T>::value;
 template <class T>
 constexpr bool HasMap = detail::HasMap<T>::value;
+template <class T>
+constexpr bool HasDataWithType = detail::HasDataWithType<T>::value;
 #endif
 
 template <class T>
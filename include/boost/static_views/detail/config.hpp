@@ -181,6 +181,19 @@
 
 #endif // use Boost.Config
 
+// Functions which use intrinsics (memcpy, SIMD) at runtime need a plain loop
+// for constant evaluation. If the compiler can't tell us which one it is
+// doing, the plain loop is always used.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED()                   \
+    __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED)
+#define BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED() true
+#endif
+
 #define BOOST_STATIC_VIEWS_ISSUES_LINK                               \
     "https://github.com/BoostGSoC17/static-views/issues"
 
@@ -251,7 +264,14 @@ constexpr T _static_const{};
 
 BOOST_STATIC_VIEWS_END_NAMESPACE
 
-#if defined(BOOST_STATIC_VIEWS_DISABLE_CHECKS)
+#if defined(BOOST_STATIC_VIEWS_DISABLE_CHECKS)                       \
+    && defined(BOOST_STATIC_VIEWS_GCC)
+// GCC keeps the branch to __builtin_unreachable() in loops until after
+// vectorisation, so disabled checks are dropped rather than assumed. cond
+// is left unevaluated, but still counts as a use of the names in it.
+#define BOOST_STATIC_VIEWS_EXPECT(cond, msg)                         \
+    static_cast<void>(sizeof(!!(cond)))
+#elif defined(BOOST_STATIC_VIEWS_DISABLE_CHECKS)
 #define BOOST_STATIC_VIEWS_EXPECT(cond, msg)                         \
     BOOST_STATIC_VIEWS_ASSUME(cond)
 #elif defined(BOOST_STATIC_VIEWS_THROW_ON_FAILURES)
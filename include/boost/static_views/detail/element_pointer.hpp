@@ -0,0 +1,119 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_STATIC_VIEWS_DETAIL_ELEMENT_POINTER_HPP
+#define BOOST_STATIC_VIEWS_DETAIL_ELEMENT_POINTER_HPP
+
+#include "config.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+/// \brief Pointer-like handle to an element of a view whose elements are
+/// not lvalues.
+
+/// Lookups return pointers to the elements they find. Some views (e.g.
+/// #zip, whose elements are tuples of references) return elements by value,
+/// so there is no address to return. An element_pointer stores the view and
+/// the index of the element instead, and dereferencing it calls
+/// `unsafe_at`. A default-constructed element_pointer compares equal to
+/// `nullptr`. It is valid as long as the view is.
+template <class View>
+class element_pointer {
+  public:
+    using index_type = typename View::index_type;
+    using reference  = typename View::reference;
+
+  private:
+    View const* _xs;
+    index_type  _i;
+
+  public:
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    element_pointer(std::nullptr_t /*unused*/ = nullptr) noexcept
+        : _xs{nullptr}, _i{}
+    {
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    element_pointer(View const& xs, index_type const i) noexcept
+        : _xs{&xs}, _i{i}
+    {
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator*() const
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(noexcept(
+            std::declval<View const&>().unsafe_at(std::declval<index_type>())))
+            -> reference
+    {
+        return _xs->unsafe_at(_i);
+    }
+
+    /// \brief Returns the index of the element in the view.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto index() const noexcept -> index_type { return _i; }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    explicit operator bool() const noexcept { return _xs != nullptr; }
+
+    friend BOOST_STATIC_VIEWS_CONSTEXPR auto operator==(
+        element_pointer const& x, element_pointer const& y) noexcept -> bool
+    {
+        return x._xs == y._xs && (x._xs == nullptr || x._i == y._i);
+    }
+
+    friend BOOST_STATIC_VIEWS_CONSTEXPR auto operator!=(
+        element_pointer const& x, element_pointer const& y) noexcept -> bool
+    {
+        return !(x == y);
+    }
+};
+
+/// \brief Type returned by lookups in \p View: a plain pointer if elements
+/// of \p View are lvalues and an #element_pointer otherwise.
+template <class View>
+using element_pointer_t = std::conditional_t<
+    std::is_lvalue_reference<typename std::remove_cv_t<View>::reference>::value,
+    std::remove_reference_t<typename std::remove_cv_t<View>::reference>*,
+    element_pointer<std::remove_cv_t<View>>>;
+
+template <class View, class IndexType>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+element_address_impl(View const& xs, IndexType const i,
+    std::true_type /*is lvalue*/) noexcept -> element_pointer_t<View>
+{
+    return &xs.unsafe_at(i);
+}
+
+template <class View, class IndexType>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+element_address_impl(View const& xs, IndexType const i,
+    std::false_type /*is lvalue*/) noexcept -> element_pointer_t<View>
+{
+    return {xs, static_cast<typename View::index_type>(i)};
+}
+
+/// \brief Returns `&xs.unsafe_at(i)` or, if elements of \p xs are not
+/// lvalues, the corresponding #element_pointer.
+template <class View, class IndexType>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+element_address(View const& xs, IndexType const i) noexcept
+    -> element_pointer_t<View>
+{
+    return element_address_impl(xs, i,
+        std::is_lvalue_reference<typename View::reference>{});
+}
+
+} // namespace detail
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_DETAIL_ELEMENT_POINTER_HPP
@@ -0,0 +1,62 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_STATIC_VIEWS_DETAIL_THREADS_HPP
+#define BOOST_STATIC_VIEWS_DETAIL_THREADS_HPP
+
+#include "config.hpp"
+#include <exception>
+#include <thread>
+#include <vector>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Calls f(0), ..., f(n - 1) concurrently, f(0) on the calling thread. The
+// first exception thrown by any of the calls is rethrown after all threads
+// have finished. If a thread cannot be started, the ones which were started
+// are joined and the error is rethrown.
+template <class Function>
+auto run_on_threads(unsigned const n, Function&& f) -> void
+{
+    std::vector<std::exception_ptr> errors(n);
+    std::vector<std::thread>        threads;
+    threads.reserve(n - 1);
+    auto const run = [&f, &errors](unsigned const i) {
+        try {
+            f(i);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    auto const join_all = [&threads] {
+        for (auto& t : threads) {
+            t.join();
+        }
+    };
+    try {
+        for (unsigned i = 1; i < n; ++i) {
+            threads.emplace_back(run, i);
+        }
+    }
+    catch (...) {
+        // Destroying a joinable std::thread calls std::terminate.
+        join_all();
+        throw;
+    }
+    run(0);
+    join_all();
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
+
+} // namespace detail
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_DETAIL_THREADS_HPP
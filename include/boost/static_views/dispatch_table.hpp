@@ -0,0 +1,207 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/dispatch_table.hpp
+///
+/// \brief Implementation of #dispatch_table.
+
+#ifndef BOOST_STATIC_VIEWS_DISPATCH_TABLE_HPP
+#define BOOST_STATIC_VIEWS_DISPATCH_TABLE_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <class Index, class Key>
+using lookup_id_t =
+    decltype(std::declval<Index const&>().lookup_id(std::declval<Key>()));
+
+// Indices providing lookup_id (e.g. string_interner) already return dense
+// ids.
+template <class Index, class Key>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+lookup_handler_id(Index const& index, Key const& key, std::true_type)
+    BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+        static_cast<std::size_t>(index.lookup_id(key)));
+
+// Otherwise, index is a static_map with ids as mapped values.
+template <class Index, class Key>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+lookup_handler_id(Index const& index, Key const& key, std::false_type)
+    BOOST_STATIC_VIEWS_NOEXCEPT_IF(noexcept(index.find(key)))
+        -> std::size_t
+{
+    auto const x = index.find(key);
+    // Not found is mapped to an id which is out of range for any table.
+    if (x == nullptr) return static_cast<std::size_t>(-1);
+    return static_cast<std::size_t>(invoke(index.mapped_fn(), *x));
+}
+
+template <class Handlers, class... Args>
+struct dispatch_result;
+
+template <class... Handlers, class... Args>
+struct dispatch_result<std::tuple<Handlers...>, Args...> {
+    using type = std::common_type_t<invoke_t<Handlers const&, Args&&...>...>;
+};
+
+// Calls the I'th handler if i == I and moves on to I + 1 otherwise. After
+// inlining, this is a chain of comparisons with constants which compilers
+// turn into a jump table or a tree of branches, just like a switch. The
+// last handler is the fallback and is called for all remaining ids.
+template <std::size_t I, std::size_t N, bool = (I + 1 == N)>
+struct dispatch_to {
+    template <class R, class Handlers, class... Args>
+    BOOST_STATIC_VIEWS_FORCEINLINE static BOOST_STATIC_VIEWS_CONSTEXPR auto
+    call(std::size_t const i, Handlers const& handlers, Args&&... args) -> R
+    {
+        if (i == I) {
+            return invoke(std::get<I>(handlers), std::forward<Args>(args)...);
+        }
+        return dispatch_to<I + 1, N>::template call<R>(
+            i, handlers, std::forward<Args>(args)...);
+    }
+};
+
+template <std::size_t I, std::size_t N>
+struct dispatch_to<I, N, true> {
+    template <class R, class Handlers, class... Args>
+    BOOST_STATIC_VIEWS_FORCEINLINE static BOOST_STATIC_VIEWS_CONSTEXPR auto
+    call(std::size_t const /*i*/, Handlers const& handlers, Args&&... args)
+        -> R
+    {
+        return invoke(std::get<I>(handlers), std::forward<Args>(args)...);
+    }
+};
+
+struct make_dispatch_table_impl;
+} // namespace detail
+
+/// \brief Maps keys to handlers which are known at compile-time.
+
+/// A static_map with function pointers as mapped values makes every call
+/// an indirect call which the compiler can't inline. A dispatch table
+/// instead stores the handlers (function objects) in a `std::tuple`, looks
+/// up the *index* of the handler, and calls it through a chain of
+/// comparisons with constants, i.e. effectively a `switch`. Handlers can
+/// then be inlined and the branches predicted per call site.
+///
+/// \code
+/// struct instruction { std::uint8_t opcode; std::size_t handler; };
+/// static constexpr instruction instructions[] = {
+///     {0x01, 0}, {0x02, 1}, {0x10, 2}};
+/// static constexpr auto table = make_dispatch_table(
+///     make_static_map_impl<>{}(raw_view(instructions),
+///         &instruction::opcode, &instruction::handler),
+///     do_add{}, do_sub{}, do_jmp{}, do_invalid{});
+/// table(opcode, vm); // Calls one of the handlers with vm.
+/// \endcode
+///
+/// The index is either a #static_map with handler ids as mapped values, or
+/// an object with a `lookup_id(key)` member function such as a
+/// #string_interner. The last handler is the fallback: it is called for keys
+/// which are not found and for ids which are out of range.
+template <class Index, class... Handlers>
+class dispatch_table {
+    static_assert(sizeof...(Handlers) > 0,
+        "boost::static_views::dispatch_table needs at least the fallback "
+        "handler.");
+
+    Index                   _index;
+    std::tuple<Handlers...> _handlers;
+
+  public:
+    using id_type   = std::size_t;
+    using size_type = std::size_t;
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    dispatch_table(Index index, Handlers... handlers)
+        : _index{std::move(index)}, _handlers{std::move(handlers)...}
+    {
+    }
+
+    /// \brief Returns the number of handlers excluding the fallback, which
+    /// is also the id of the fallback.
+    static constexpr auto size() noexcept -> size_type
+    {
+        return sizeof...(Handlers) - 1;
+    }
+
+    /// \brief Returns the id of the handler for \p key, or `size()` if
+    /// there is none.
+    template <class Key>
+    BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+    lookup_id(Key const& key) const BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+        noexcept(detail::lookup_handler_id(std::declval<Index const&>(), key,
+            is_detected<detail::lookup_id_t, Index, Key const&>{})))
+        -> id_type
+    {
+        auto const id = detail::lookup_handler_id(
+            _index, key, is_detected<detail::lookup_id_t, Index, Key const&>{});
+        return id < size() ? id : size();
+    }
+
+    /// \brief Calls the handler with id \p id with \p args.
+    template <class... Args>
+    BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto call(
+        id_type const id, Args&&... args) const ->
+        typename detail::dispatch_result<std::tuple<Handlers...>,
+            Args...>::type
+    {
+        using result_type = typename detail::dispatch_result<
+            std::tuple<Handlers...>, Args...>::type;
+        return detail::dispatch_to<0, sizeof...(Handlers)>::template call<
+            result_type>(id, _handlers, std::forward<Args>(args)...);
+    }
+
+    /// \brief Calls the handler for \p key with \p args.
+    template <class Key, class... Args>
+    BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+    operator()(Key const& key, Args&&... args) const ->
+        typename detail::dispatch_result<std::tuple<Handlers...>,
+            Args...>::type
+    {
+        return call(lookup_id(key), std::forward<Args>(args)...);
+    }
+
+    /// \brief Returns the index used to map keys to ids.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto index() const noexcept -> Index const& { return _index; }
+};
+
+namespace detail {
+struct make_dispatch_table_impl {
+    template <class Index, class... Handlers>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto operator()(
+        Index&& index, Handlers&&... handlers) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            dispatch_table<std::decay_t<Index>, std::decay_t<Handlers>...>{
+                std::forward<Index>(index),
+                std::forward<Handlers>(handlers)...});
+};
+} // namespace detail
+
+/// \brief Creates a #dispatch_table from an index and handlers.
+
+/// `make_dispatch_table(index, h_0, ..., h_n, fallback)` calls `h_i` for
+/// keys with id `i` and `fallback` for everything else.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto make_dispatch_table = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(
+    detail::make_dispatch_table_impl, make_dispatch_table)
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_DISPATCH_TABLE_HPP
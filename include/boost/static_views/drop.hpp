@@ -13,6 +13,7 @@
 #include "algorithm_base.hpp"
 #include "compact_index.hpp"
 #include "copy.hpp"
+#include "take.hpp"
 #include "view_base.hpp"
 
 #include <algorithm>
@@ -40,6 +41,8 @@ struct drop_view_impl
         compact_index<drop_index_tag, typename base::index_type, Extent>;
     using compact_index_type::index;
 
+    friend struct drop_exactly_impl;
+
   public:
     using typename base::index_type;
     using typename base::reference;
@@ -105,15 +108,71 @@ struct drop_view_impl
             "`0 <= i < size()` is not satisfied.");
         return index() + i;
     }
+
+    /// \brief Returns a pointer to the first element viewed.
+
+    /// Only available if the parent view is a #ContiguousView.
+    // clang-format off
+    template <class V = std::remove_cv_t<typename Wrapper::value_type>
+        BOOST_STATIC_VIEWS_REQUIRES(ContiguousView<V>)
+    BOOST_STATIC_VIEWS_CONSTEXPR auto data() const noexcept -> value_type*
+    // clang-format on
+    {
+        return parent().data() + index();
+    }
 };
 
+template <class T>
+struct is_drop_view : std::false_type {};
+
+template <class Wrapper, std::ptrdiff_t Extent>
+struct is_drop_view<drop_view_impl<Wrapper, Extent>> : std::true_type {};
+
+// Chains of drops, takes and slices are fused when they are built, so that
+// they are at most two adaptors deep, `take_exactly(drop_exactly(xs, b),
+// n)`, no matter how long the chain is.
 struct drop_exactly_impl {
   private:
-    template <class Wrapper, class IndexType>
-    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
-        Wrapper xs, IndexType const b) const
+    template <class V>
+    static BOOST_STATIC_VIEWS_CONSTEXPR auto stored_index(V const& xs) noexcept
+        -> typename V::compact_index_type
+    {
+        return xs;
+    }
+
+    template <class V, class IndexType>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(V&& xs, IndexType const b,
+        std::false_type /*is drop view*/,
+        std::false_type /*is take view*/) const
         BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
-            drop_view_impl<Wrapper, IndexType::extent()>{std::move(xs), b});
+            drop_view_impl<decltype(make_wrapper(std::forward<V>(xs))),
+                IndexType::extent()>{make_wrapper(std::forward<V>(xs)), b});
+
+    // drop_exactly(drop_exactly(xs, a), b) is drop_exactly(xs, a + b).
+    template <class V, class IndexType>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(V&& xs, IndexType const b,
+        std::true_type /*is drop view*/,
+        std::false_type /*is take view*/) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            call_impl(std::forward<V>(xs).parent(),
+                add_indices<drop_index_tag>(stored_index(xs), b)));
+
+    // drop_exactly(take_exactly(xs, n), b) is
+    // take_exactly(drop_exactly(xs, b), n - b).
+    template <class V, class IndexType>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(V&& xs, IndexType const b,
+        std::false_type /*is drop view*/,
+        std::true_type /*is take view*/) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(take_exactly_impl{}.call_impl(
+            call_impl(std::forward<V>(xs).parent(), b),
+            subtract_indices<void>(stored_index(xs), b), std::false_type{}));
+
+    template <class V, class IndexType>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        V&& xs, IndexType const b) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(call_impl(std::forward<V>(xs),
+            b, is_drop_view<remove_cvref_t<V>>{},
+            is_take_view<remove_cvref_t<V>>{}));
 
     template <class T>
     using index_t =
@@ -131,14 +190,14 @@ struct drop_exactly_impl {
         // clang-format on
         BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(
             noexcept(std::declval<drop_exactly_impl const&>().call_impl(
-                make_wrapper(std::forward<V>(xs)), index(b))))
+                std::forward<V>(xs), index<drop_index_tag>(b))))
     {
         using index_type = index_t<V>;
         BOOST_STATIC_VIEWS_EXPECT(
             0 <= b && b <= static_cast<index_type>(xs.size()),
             "boost::static_views::drop_exactly(xs, b): Precondition "
             "`0 <= b <= xs.size()` is not satisfied.");
-        return call_impl(make_wrapper(std::forward<V>(xs)), index<drop_index_tag>(b));
+        return call_impl(std::forward<V>(xs), index<drop_index_tag>(b));
     }
 
     // clang-format off
@@ -160,8 +219,8 @@ struct drop_exactly_impl {
         // clang-format on
         BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(
             noexcept(std::declval<drop_exactly_impl const&>().call_impl(
-                make_wrapper(std::forward<V>(xs)),
-                index(std::integral_constant<index_t<V>, I>{}))))
+                std::forward<V>(xs),
+                index<drop_index_tag>(std::integral_constant<index_t<V>, I>{}))))
     {
         using index_type = index_t<V>;
         using view_type = std::remove_cv_t<std::remove_reference_t<V>>;
@@ -174,7 +233,7 @@ struct drop_exactly_impl {
             0 <= b && b <= static_cast<index_type>(xs.size()),
             "boost::static_views::drop_exactly(xs, b): Precondition "
             "`0 <= b <= xs.size()` is not satisfied.");
-        return call_impl(make_wrapper(std::forward<V>(xs)),
+        return call_impl(std::forward<V>(xs),
             index<drop_index_tag>(std::integral_constant<index_type, I>{}));
     }
 
@@ -11,6 +11,7 @@
 #define BOOST_STATIC_VIEWS_FLATTEN_HPP
 
 #include "algorithm_base.hpp"
+#include "for_each.hpp"
 #include "view_base.hpp"
 
 #include <algorithm>
@@ -20,6 +21,19 @@ BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
 
 namespace detail {
 
+template <class F>
+struct flatten_visitor {
+    F& f;
+
+    template <class Inner>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(Inner const& inner) const -> bool
+    {
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(inner, f);
+    }
+};
+
 template <class Wrapper>
 struct flatten_view_impl
     : view_adaptor_base<flatten_view_impl<Wrapper>, Wrapper> {
@@ -83,6 +97,17 @@ struct flatten_view_impl
         auto const second = i % n;
         return parent().unsafe_at(first).unsafe_at(second);
     }
+
+    /// \brief Calls `f` for elements in order until it returns `false`.
+
+    /// Runs as a nested loop rather than dividing every index by the size
+    /// of the inner views. See #for_each_while.
+    template <class F>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto for_each_while(F& f) const -> bool
+    {
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(
+            parent(), flatten_visitor<F>{f});
+    }
 };
 
 struct flatten_impl {
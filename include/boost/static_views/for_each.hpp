@@ -0,0 +1,200 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/for_each.hpp
+///
+/// \brief Implementation of #for_each_while, #for_each and #fold_while.
+
+#ifndef BOOST_STATIC_VIEWS_FOR_EACH_HPP
+#define BOOST_STATIC_VIEWS_FOR_EACH_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "view_concept.hpp"
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <class V, class F>
+using has_for_each_while_t = decltype(
+    std::declval<V const&>().for_each_while(std::declval<F&>()));
+
+struct for_each_while_impl {
+  private:
+    // The view knows how to walk over its elements, e.g. flatten as a
+    // nested loop.
+    template <class V, class F>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, F& f, std::true_type /*native*/,
+        std::false_type /*contiguous*/) -> bool
+    {
+        return xs.for_each_while(f);
+    }
+
+    template <class V, class F>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, F& f, std::false_type /*native*/,
+        std::true_type /*contiguous*/) -> bool
+    {
+        auto const* first = xs.data();
+        auto const* last  = first + xs.size();
+        for (; first != last; ++first) {
+            if (!invoke(f, *first)) return false;
+        }
+        return true;
+    }
+
+    template <class V, class F>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, F& f, std::false_type /*native*/,
+        std::false_type /*contiguous*/) -> bool
+    {
+        using index_type = typename V::index_type;
+        auto const size  = static_cast<index_type>(xs.size());
+        for (index_type i = 0; i < size; ++i) {
+            if (!invoke(f, xs.unsafe_at(i))) return false;
+        }
+        return true;
+    }
+
+  public:
+    // clang-format off
+    template <class V, class F
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, F&& f) const -> bool
+    // clang-format on
+    {
+        using native =
+            std::integral_constant<bool, is_detected<has_for_each_while_t,
+                                             remove_cvref_t<V>, F>::value>;
+        using contiguous = std::integral_constant<bool,
+            !native::value && ContiguousView<remove_cvref_t<V>>>;
+        return call(xs, f, native{}, contiguous{});
+    }
+};
+
+template <class F>
+struct for_each_visitor {
+    F& f;
+
+    template <class T>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(T&& x) const -> bool
+    {
+        invoke(f, std::forward<T>(x));
+        return true;
+    }
+};
+
+template <class Acc, class F>
+struct fold_while_visitor {
+    Acc& acc;
+    F&   f;
+
+    template <class T>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(T&& x) const -> bool
+    {
+        return invoke(f, acc, std::forward<T>(x));
+    }
+};
+} // namespace detail
+
+/// \brief Calls `f(x)` for the elements `x` of a view in order until `f`
+/// returns `false`.
+
+/// `for_each_while(xs, f)` returns `true` if all elements were visited.
+/// This is the internal iteration protocol of the library: a view may
+/// define a member function `for_each_while(f)` with the same semantics
+/// which is then used instead of calling `unsafe_at` for every index.
+/// Adaptors whose `unsafe_at` is costly, e.g. #flatten, do so.
+/// Contiguous views are walked over with a pointer.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto for_each_while = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(
+    detail::for_each_while_impl, for_each_while)
+#endif
+
+namespace detail {
+struct for_each_impl {
+    // clang-format off
+    template <class V, class F
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, F&& f) const -> void
+    // clang-format on
+    {
+        ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(
+            xs, for_each_visitor<std::remove_reference_t<F>>{f});
+    }
+};
+
+struct fold_while_impl {
+    // clang-format off
+    template <class V, class Acc, class F
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, Acc init, F&& f) const -> Acc
+    // clang-format on
+    {
+        ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(xs,
+            fold_while_visitor<Acc, std::remove_reference_t<F>>{init, f});
+        return init;
+    }
+};
+} // namespace detail
+
+/// \brief Calls `f(x)` for all elements `x` of a view in order.
+
+/// Uses the same internal iteration as #for_each_while, so e.g. a loop over
+/// a #flatten view runs as a nested loop.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto for_each = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::for_each_impl, for_each)
+#endif
+
+/// \brief Left fold with early exit.
+
+/// `fold_while(xs, init, f)` calls `f(acc, x)` with a reference `acc` to
+/// the accumulator, initialised with `init`, for the elements `x` of `xs`
+/// in order. `f` updates `acc` in place and returns whether to go on. The
+/// final value of the accumulator is returned.
+///
+/// \code
+/// struct sum_until_negative {
+///     constexpr auto operator()(int& acc, int const x) const -> bool
+///     {
+///         if (x < 0) return false;
+///         acc += x;
+///         return true;
+///     }
+/// };
+/// static constexpr int xs[] = {1, 2, -3, 4};
+/// fold_while(raw_view(xs), 0, sum_until_negative{}); // 3
+/// \endcode
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto fold_while = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::fold_while_impl, fold_while)
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_FOR_EACH_HPP
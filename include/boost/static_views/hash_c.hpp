@@ -6,7 +6,10 @@
 #ifndef BOOST_STATIC_VIEWS_HASH_C_HPP
 #define BOOST_STATIC_VIEWS_HASH_C_HPP
 
+#include <cstdint>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "concepts.hpp"
 #include "detail/config.hpp"
@@ -153,7 +156,7 @@ struct hash_impl<Char const*, std::enable_if_t<std::is_integral<Char>::value>> {
     BOOST_STATIC_VIEWS_CONSTEXPR
     auto operator()(Char const* const x) const noexcept -> std::size_t
     {
-        return simple_hash(x);
+        return detail::simple_hash(x);
         // return static_cast<std::size_t>(crc32_hash(x));
     }
 };
@@ -170,6 +173,76 @@ struct hash_impl<basic_string_view<Char>> {
 };
 #endif
 
+namespace detail {
+// Finaliser of a 64-bit multiply-xorshift mixer. Every input bit affects
+// every output bit, so combining identity hashes of small integers (see
+// hash_impl above) still gives a well-distributed result.
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto hash_mix(std::uint64_t x) noexcept -> std::uint64_t
+{
+    x ^= x >> 32;
+    x *= 0xE9846AF9B1A615Dull;
+    x ^= x >> 32;
+    x *= 0xE9846AF9B1A615Dull;
+    x ^= x >> 28;
+    return x;
+}
+
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto hash_combine(std::size_t const seed, std::size_t const hash) noexcept
+    -> std::size_t
+{
+    return static_cast<std::size_t>(
+        hash_mix(std::uint64_t{seed} + 0x9E3779B97F4A7C15ull + hash));
+}
+
+template <class T>
+using element_hash_t = hash_impl<std::decay_t<T>>;
+
+template <class Tuple, std::size_t... Is>
+BOOST_STATIC_VIEWS_CONSTEXPR auto hash_elements(Tuple const& x,
+    std::index_sequence<Is...> /*unused*/) noexcept -> std::size_t
+{
+    std::size_t const hashes[] = {std::size_t{0},
+        element_hash_t<std::tuple_element_t<Is, Tuple>>{}(std::get<Is>(x))...};
+    std::size_t seed = 0;
+    for (std::size_t i = 1; i < sizeof...(Is) + 1; ++i) {
+        seed = hash_combine(seed, hashes[i]);
+    }
+    return seed;
+}
+} // namespace detail
+
+/// \brief Hash of a pair, combined from the hashes of its elements.
+
+/// Elements are hashed as if by `hash_c`, i.e. references are hashed like
+/// the values they refer to. Hence, `std::pair<int, int>`,
+/// `std::tuple<int, int>` and `std::tuple<int const&, int const&>` with the
+/// same values have equal hashes.
+template <class T, class U>
+struct hash_impl<std::pair<T, U>> {
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(std::pair<T, U> const& x) const noexcept -> std::size_t
+    {
+        return detail::hash_elements(x, std::make_index_sequence<2>{});
+    }
+};
+
+/// \brief Hash of a tuple, combined from the hashes of its elements.
+
+/// See `hash_impl<std::pair<T, U>>`.
+template <class... Ts>
+struct hash_impl<std::tuple<Ts...>> {
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(std::tuple<Ts...> const& x) const noexcept -> std::size_t
+    {
+        return detail::hash_elements(
+            x, std::make_index_sequence<sizeof...(Ts)>{});
+    }
+};
+
 struct hash_c {
     // clang-format off
     template <class T>
@@ -178,8 +251,8 @@ struct hash_c {
     auto operator()(T&& x) const
         // clang-format on
         BOOST_STATIC_VIEWS_NOEXCEPT_IF(
-            noexcept(hash_impl<std::remove_cv_t<std::remove_reference_t<T>>>{}(
-                std::forward<T>(x)))) -> std::size_t
+            noexcept(hash_impl<std::decay_t<T>>{}(std::forward<T>(x))))
+        -> std::size_t
     {
         return hash_impl<std::decay_t<T>>{}(std::forward<T>(x));
     }
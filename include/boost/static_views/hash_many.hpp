@@ -0,0 +1,274 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/hash_many.hpp
+///
+/// \brief Batch versions of #hash_c.
+
+#ifndef BOOST_STATIC_VIEWS_HASH_MANY_HPP
+#define BOOST_STATIC_VIEWS_HASH_MANY_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "hash_c.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Hash of a fixed-width key, i.e. a string of at most `width` bytes padded
+// with NULs. Equal to `hash_c{}(str)` where str is the NUL-terminated prefix
+// of the key.
+BOOST_STATIC_VIEWS_FORCEINLINE
+auto hash_fixed_scalar(char const* const key, std::size_t const width) noexcept
+    -> std::size_t
+{
+    std::size_t hash = 0;
+    for (std::size_t i = 0; i < width && key[i] != '\0'; ++i) {
+        hash = 37 * hash + static_cast<unsigned char>(key[i]);
+    }
+    return hash;
+}
+
+// Loads up to 8 bytes of a key starting at offset. Bytes past the end of the
+// key are zero, which the kernels below treat just like a terminating NUL.
+BOOST_STATIC_VIEWS_FORCEINLINE
+auto load_word(char const* const key, std::size_t const offset,
+    std::size_t const width) noexcept -> std::uint64_t
+{
+    std::uint64_t word = 0;
+    auto const    n    = width - offset < 8 ? width - offset : 8;
+    // Assumes a little-endian target, i.e. byte `offset` ends up in the
+    // lowest 8 bits.
+    std::memcpy(&word, key + offset, n);
+    return word;
+}
+
+#if defined(__AVX512F__)
+// 8 keys per vector. 37 * h is computed as (h << 5) + (h << 2) + h since a
+// 64-bit multiplication requires AVX-512DQ.
+struct hash_fixed_avx512 {
+    static constexpr std::size_t lanes = 8;
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    static auto run(char const* const data, std::size_t const width,
+        std::size_t* const out) noexcept -> void
+    {
+        auto     hash   = _mm512_setzero_si512();
+        __mmask8 active = 0xFF;
+        for (std::size_t j = 0; j < width && active != 0; j += 8) {
+            auto const words = _mm512_set_epi64(
+                static_cast<long long>(load_word(data + 7 * width, j, width)),
+                static_cast<long long>(load_word(data + 6 * width, j, width)),
+                static_cast<long long>(load_word(data + 5 * width, j, width)),
+                static_cast<long long>(load_word(data + 4 * width, j, width)),
+                static_cast<long long>(load_word(data + 3 * width, j, width)),
+                static_cast<long long>(load_word(data + 2 * width, j, width)),
+                static_cast<long long>(load_word(data + 1 * width, j, width)),
+                static_cast<long long>(load_word(data + 0 * width, j, width)));
+            auto const byte_mask = _mm512_set1_epi64(0xFF);
+            // The zero-masking forms of the shifts are used because the
+            // unmasked ones trigger -Wmaybe-uninitialized in GCC's headers.
+            for (unsigned b = 0; b < 8; ++b) {
+                auto const c = _mm512_and_si512(
+                    _mm512_maskz_srli_epi64(0xFF, words, 8 * b), byte_mask);
+                active = _mm512_mask_test_epi64_mask(active, c, c);
+                hash   = _mm512_mask_add_epi64(hash, active,
+                    _mm512_add_epi64(_mm512_maskz_slli_epi64(0xFF, hash, 5),
+                        _mm512_maskz_slli_epi64(0xFF, hash, 2)),
+                    _mm512_add_epi64(hash, c));
+            }
+        }
+        _mm512_storeu_si512(out, hash);
+    }
+};
+#endif
+
+#if defined(__AVX2__)
+// 4 keys per vector. 37 * h is computed as (h << 5) + (h << 2) + h since
+// AVX2 has no 64-bit multiplication.
+struct hash_fixed_avx2 {
+    static constexpr std::size_t lanes = 4;
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    static auto run(char const* const data, std::size_t const width,
+        std::size_t* const out) noexcept -> void
+    {
+        auto const zero = _mm256_setzero_si256();
+        auto       hash = zero;
+        // All ones in lanes which have already seen a NUL.
+        auto done = zero;
+        for (std::size_t j = 0; j < width; j += 8) {
+            auto const words = _mm256_set_epi64x(
+                static_cast<long long>(load_word(data + 3 * width, j, width)),
+                static_cast<long long>(load_word(data + 2 * width, j, width)),
+                static_cast<long long>(load_word(data + 1 * width, j, width)),
+                static_cast<long long>(load_word(data + 0 * width, j, width)));
+            auto const byte_mask = _mm256_set1_epi64x(0xFF);
+            for (unsigned b = 0; b < 8; ++b) {
+                auto const c = _mm256_and_si256(
+                    _mm256_srli_epi64(words, static_cast<int>(8 * b)),
+                    byte_mask);
+                done = _mm256_or_si256(done, _mm256_cmpeq_epi64(c, zero));
+                auto const next = _mm256_add_epi64(
+                    _mm256_add_epi64(_mm256_slli_epi64(hash, 5),
+                        _mm256_slli_epi64(hash, 2)),
+                    _mm256_add_epi64(hash, c));
+                hash = _mm256_blendv_epi8(next, hash, done);
+            }
+            if (_mm256_movemask_epi8(done) == -1) break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), hash);
+    }
+};
+#endif
+
+struct hash_fixed_one {
+    static constexpr std::size_t lanes = 1;
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    static auto run(char const* const data, std::size_t const width,
+        std::size_t* const out) noexcept -> void
+    {
+        *out = hash_fixed_scalar(data, width);
+    }
+};
+
+// Hashes n keys with the first kernel while at least `lanes` keys are left,
+// and the rest with the following (narrower) kernels. The last kernel must
+// handle a single key, so no kernel ever touches keys past n.
+template <class... Kernels>
+struct hash_fixed_chain;
+
+template <class Kernel>
+struct hash_fixed_chain<Kernel> {
+    static_assert(Kernel::lanes == 1,
+        "[INTERNAL] The last kernel must hash a single key.");
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    static auto run(char const* const data, std::size_t const width,
+        std::size_t const n, std::size_t* const out) noexcept -> void
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            Kernel::run(data + i * width, width, out + i);
+        }
+    }
+};
+
+template <class Kernel, class Next, class... Rest>
+struct hash_fixed_chain<Kernel, Next, Rest...> {
+    static_assert(Kernel::lanes > Next::lanes,
+        "[INTERNAL] Kernels must be ordered from the widest to the "
+        "narrowest.");
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    static auto run(char const* const data, std::size_t const width,
+        std::size_t const n, std::size_t* const out) noexcept -> void
+    {
+        std::size_t i = 0;
+        for (; n - i >= Kernel::lanes; i += Kernel::lanes) {
+            Kernel::run(data + i * width, width, out + i);
+        }
+        hash_fixed_chain<Next, Rest...>::run(
+            data + i * width, width, n - i, out + i);
+    }
+};
+
+#if defined(__AVX512F__)
+using hash_fixed_kernels =
+    hash_fixed_chain<hash_fixed_avx512, hash_fixed_avx2, hash_fixed_one>;
+#elif defined(__AVX2__)
+using hash_fixed_kernels = hash_fixed_chain<hash_fixed_avx2, hash_fixed_one>;
+#else
+using hash_fixed_kernels = hash_fixed_chain<hash_fixed_one>;
+#endif
+
+} // end namespace detail
+
+/// \brief Hashes `N` integral keys at once.
+
+/// Equivalent to `out[i] = hash_c{}(keys[i])` for `i < N`. `N` must be 4, 8
+/// or 16. Since #hash_c is the identity for integral types, this boils down
+/// to a (sign or zero) extending copy which compilers turn into SIMD
+/// conversion instructions.
+// clang-format off
+template <std::size_t N, class T
+    BOOST_STATIC_VIEWS_REQUIRES(std::is_integral<T>::value)
+BOOST_STATIC_VIEWS_FORCEINLINE
+auto hash_n(T const* const keys, std::size_t* const out) noexcept -> void
+// clang-format on
+{
+    static_assert(N == 4 || N == 8 || N == 16,
+        "boost::static_views::hash_n<N> supports N = 4, 8 or 16.");
+    for (std::size_t i = 0; i < N; ++i) {
+        out[i] = hash_impl<T>{}(keys[i]);
+    }
+}
+
+/// \brief Hashes `N` fixed-width string keys at once.
+
+/// Keys are stored contiguously in \p data, each taking \p width bytes.
+/// Shorter keys must be padded with NULs. The result is bit-identical to
+/// `hash_c{}` applied to the NUL-terminated prefix of each key. `N` must be
+/// 4, 8 or 16.
+///
+/// Depending on the target, this uses AVX-512 (8 keys per vector), AVX2 (4
+/// keys per vector) or scalar code. Keys which do not fill a whole vector
+/// are hashed with narrower ones, so exactly `N` keys are read and `N`
+/// hashes written.
+template <std::size_t N>
+BOOST_STATIC_VIEWS_FORCEINLINE
+auto hash_n(char const* const data, std::size_t const width,
+    std::size_t* const out) noexcept -> void
+{
+    static_assert(N == 4 || N == 8 || N == 16,
+        "boost::static_views::hash_n<N> supports N = 4, 8 or 16.");
+    detail::hash_fixed_kernels::run(data, width, N, out);
+}
+
+/// \brief Hashes \p n integral keys.
+
+/// Equivalent to `out[i] = hash_c{}(keys[i])` for `i < n`.
+// clang-format off
+template <class T
+    BOOST_STATIC_VIEWS_REQUIRES(std::is_integral<T>::value)
+auto hash_many(T const* const keys, std::size_t const n,
+    std::size_t* const out) noexcept -> void
+// clang-format on
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        hash_n<16>(keys + i, out + i);
+    }
+    for (; i < n; ++i) {
+        out[i] = hash_impl<T>{}(keys[i]);
+    }
+}
+
+/// \brief Hashes \p n fixed-width string keys.
+
+/// See #hash_n for the description of the layout.
+inline auto hash_many(char const* const data, std::size_t const width,
+    std::size_t const n, std::size_t* const out) noexcept -> void
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        hash_n<16>(data + i * width, width, out + i);
+    }
+    for (; i < n; ++i) {
+        out[i] = detail::hash_fixed_scalar(data + i * width, width);
+    }
+}
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_HASH_MANY_HPP
@@ -7,9 +7,11 @@
 #define BOOST_STATIC_VIEWS_HASHED_HPP
 
 #include "concepts.hpp"
+#include "detail/element_pointer.hpp"
 #include "detail/find_first.hpp"
 #include "detail/invoke.hpp"
 #include "drop.hpp"
+#include "hashed_statistics.hpp"
 #include "raw_view.hpp"
 #include "slice.hpp"
 #include "take.hpp"
@@ -177,6 +179,10 @@ BOOST_STATIC_VIEWS_CONSTEXPR auto make_hashed_init_impl(
 }
 #endif
 
+// Defined in parallel_hashed.hpp.
+template <class HashedView>
+struct parallel_hashed_builder;
+
 template <std::size_t BucketCount, std::size_t BucketSize, class Wrapper,
     class Hasher>
 struct hashed_view_impl
@@ -224,6 +230,26 @@ struct hashed_view_impl
 
     std::tuple<array_wrapper, Hasher> _data;
 
+    template <class>
+    friend struct parallel_hashed_builder;
+
+    // Converting to array_wrapper (rather than passing array_wrapper{})
+    // lets C++17 compilers initialise the storage in place instead of
+    // copying a temporary which might not fit on the stack.
+    struct zeroed_storage {
+        operator array_wrapper() const noexcept { return array_wrapper{}; }
+    };
+
+    // Creates a view with zero-filled storage which
+    // parallel_hashed_builder then builds.
+    struct unbuilt_tag {
+    };
+
+    hashed_view_impl(unbuilt_tag, Wrapper&& xs, Hasher&& hf)
+        : base{std::move(xs)}, _data{zeroed_storage{}, std::move(hf)}
+    {
+    }
+
     // Returns whether a bucket at given index is empty.
     BOOST_STATIC_VIEWS_FORCEINLINE
     BOOST_STATIC_VIEWS_CONSTEXPR
@@ -288,7 +314,7 @@ struct hashed_view_impl
         // clang-format on
         BOOST_STATIC_VIEWS_NOEXCEPT_IF(
             noexcept(invoke(p, std::declval<typename base::reference>())))
-        -> typename base::value_type*
+        -> element_pointer_t<view_type>
     {
         auto const xs = bucket(h);
         for (typename base::index_type i = 0;
@@ -297,8 +323,8 @@ struct hashed_view_impl
             // xs.unsafe_at(i) -- index in the parent view
             // parent().unsafe_at(xs.unsafe_at(i)) -- element in the parent
             // view.
-            auto& x = parent().unsafe_at(xs.unsafe_at(i));
-            if (invoke(p, x)) return &x;
+            auto const x = element_address(parent(), xs.unsafe_at(i));
+            if (invoke(p, *x)) return x;
         }
         return nullptr;
     }
@@ -435,45 +461,68 @@ struct hashed_view_impl
     /// concept. It returns a view of elements that have hash
     /// ``hash``. If there are no such elements, the returned view
     /// will have size zero. \endverbatim
+    // NOTE: Spelling the type out rather than using decltype on operator[]
+    // is required by GCC which otherwise complains about *this being
+    // incomplete.
+    using reference = decltype(through(std::declval<view_type const&>(),
+        slice(raw_view(std::declval<storage_type const&>()),
+            std::declval<base_index_type>(), std::declval<base_index_type>())));
+    using value_type = std::remove_reference_t<reference>;
+
     BOOST_STATIC_VIEWS_FORCEINLINE
     BOOST_STATIC_VIEWS_CONSTEXPR
     auto operator[](index_type const hash)
-        const& BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true)
+        const& BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true) -> reference
     {
         auto const i = static_cast<typename base::index_type>(
             bucket_size() * (hash % bucket_count()));
         auto const n = find_first_i(bucket(i), is_empty{});
-        return through(parent(), slice(raw_view(storage()), i, i + n));
+        return through(parent(), slice(raw_view(storage()), i,
+                                     static_cast<base_index_type>(i + n)));
     }
 
     BOOST_STATIC_VIEWS_FORCEINLINE
     BOOST_STATIC_VIEWS_CONSTEXPR
     auto unsafe_at(index_type const hash)
-        const& BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true)
+        const& BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true) -> reference
     {
         return this->operator[](hash);
     }
 
-    using reference = decltype(
-        std::declval<hashed_view_impl const&>()[std::declval<index_type>()]);
-    using value_type = std::remove_reference_t<reference>;
 
+    /// \brief Returns a pointer to the first element in the bucket
+    /// corresponding to \p hash which satisfies \p p. If there is no such
+    /// element, `nullptr` is returned.
     template <class Predicate>
     BOOST_STATIC_VIEWS_FORCEINLINE
     BOOST_STATIC_VIEWS_CONSTEXPR
-    auto lookup(index_type h, Predicate&& p) const noexcept
-        -> typename value_type::value_type*
+    auto lookup(index_type const hash, Predicate&& p) const noexcept
+        -> element_pointer_t<view_type>
     {
-        auto const xs = bucket(h);
+        // TODO: For optimal performance, I need a way to mark a hash
+        // function "trustworthy". Such functions are then assumed to never
+        // return values larger that bucker_count() which would avoid a
+        // costly `mod` operation.
+        auto const xs = bucket(static_cast<base_index_type>(
+            bucket_size() * (hash % bucket_count())));
         for (typename base::index_type i = 0;
              i < bucket_size() && !empty(xs.unsafe_at(i)); ++i) {
 
-            auto* const x = &parent().unsafe_at(xs.unsafe_at(i));
+            auto const x = element_address(parent(), xs.unsafe_at(i));
             if (invoke(p, *x)) return x;
         }
         return nullptr;
     }
 
+    /// \brief Returns occupancy and probe-length statistics of the view.
+
+    /// This function is `constexpr`, so bad choices of the hash function,
+    /// `BucketCount` or `BucketSize` can be caught with a `static_assert`.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto statistics() const noexcept -> hashed_statistics<BucketSize>
+    {
+        return compute_hashed_statistics<BucketSize>(*this);
+    }
 };
 
 template <std::size_t BucketCount, std::size_t BucketSize = 4u>
@@ -0,0 +1,116 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/hashed_statistics.hpp
+///
+/// \brief Compile-time statistics of #hashed and #packed_hashed views.
+
+#ifndef BOOST_STATIC_VIEWS_HASHED_STATISTICS_HPP
+#define BOOST_STATIC_VIEWS_HASHED_STATISTICS_HPP
+
+#include "detail/config.hpp"
+#include <cstddef>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+/// \brief Occupancy and probe-length statistics of a hashed view.
+
+/// All counts assume that lookups compare the key against the elements of a
+/// single bucket one by one, which is exactly what `lookup` does. A "probe"
+/// is thus one invocation of the predicate (`key_equal` for #static_map).
+///
+/// \tparam MaxOccupancy Maximal number of elements a single bucket can hold.
+template <std::size_t MaxOccupancy>
+struct hashed_statistics {
+    /// \brief Number of stored elements.
+    std::size_t element_count;
+
+    /// \brief Number of buckets.
+    std::size_t bucket_count;
+
+    /// \brief Number of buckets with no elements in them.
+    std::size_t empty_bucket_count;
+
+    /// \brief Number of elements in the fullest bucket.
+    std::size_t max_occupancy;
+
+    /// \brief `occupancy_histogram[n]` is the number of buckets holding
+    /// exactly `n` elements.
+    std::size_t occupancy_histogram[MaxOccupancy + 1];
+
+    /// \brief Number of probes needed to find the worst-placed element.
+    std::size_t max_probe_length;
+
+    /// \brief Sum of probe lengths over all stored elements.
+
+    /// Dividing it by #element_count gives the mean number of probes for a
+    /// successful lookup, see #mean_probe_length().
+    std::size_t total_probe_length;
+
+    /// \brief Size of the view in bytes including the index storage (but not
+    /// the elements the view refers to).
+    std::size_t bytes;
+
+    /// \brief Returns the average number of elements per bucket.
+    constexpr auto load_factor() const noexcept -> double
+    {
+        return static_cast<double>(element_count)
+               / static_cast<double>(bucket_count);
+    }
+
+    /// \brief Returns the mean number of probes for a successful lookup
+    /// assuming all stored keys are equally likely to be requested.
+    constexpr auto mean_probe_length() const noexcept -> double
+    {
+        return element_count == 0
+                   ? 0.0
+                   : static_cast<double>(total_probe_length)
+                         / static_cast<double>(element_count);
+    }
+
+    /// \brief Returns the expected number of probes for an unsuccessful
+    /// lookup assuming the hashes of missing keys are uniformly distributed
+    /// over the buckets.
+
+    /// A miss inspects every element in its bucket, so this is the same as
+    /// #load_factor().
+    constexpr auto expected_miss_probes() const noexcept -> double
+    {
+        return load_factor();
+    }
+};
+
+namespace detail {
+
+/// \brief Computes #hashed_statistics of a view of buckets.
+
+/// \p xs must be a view where `xs[b]` for `b < xs.bucket_count()` is the
+/// view of elements in bucket `b`. Both #hashed_view_impl and
+/// #packed_hashed_view_impl satisfy this requirement.
+template <std::size_t MaxOccupancy, class HashedView>
+BOOST_STATIC_VIEWS_CONSTEXPR auto compute_hashed_statistics(
+    HashedView const& xs) noexcept -> hashed_statistics<MaxOccupancy>
+{
+    hashed_statistics<MaxOccupancy> stats{};
+    stats.bucket_count = static_cast<std::size_t>(xs.bucket_count());
+    stats.bytes        = sizeof(HashedView);
+    for (std::size_t b = 0; b < stats.bucket_count; ++b) {
+        auto const n = static_cast<std::size_t>(xs.unsafe_at(b).size());
+        stats.element_count += n;
+        stats.empty_bucket_count += (n == 0);
+        ++stats.occupancy_histogram[n];
+        if (n > stats.max_occupancy) stats.max_occupancy = n;
+        // The i'th element of a bucket is found after i + 1 probes.
+        stats.total_probe_length += n * (n + 1) / 2;
+    }
+    stats.max_probe_length = stats.max_occupancy;
+    return stats;
+}
+
+} // end namespace detail
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_HASHED_STATISTICS_HPP
@@ -0,0 +1,104 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/lfold.hpp
+///
+/// \brief Implementation of #lfold and #rfold.
+
+#ifndef BOOST_STATIC_VIEWS_LFOLD_HPP
+#define BOOST_STATIC_VIEWS_LFOLD_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "for_each.hpp"
+#include "view_concept.hpp"
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <class Acc, class Op>
+struct lfold_visitor {
+    Acc& acc;
+    Op&  op;
+
+    template <class T>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(T&& x) const -> bool
+    {
+        acc = invoke(op, std::move(acc), std::forward<T>(x));
+        return true;
+    }
+};
+
+struct lfold_impl {
+    // clang-format off
+    template <class V, class Acc, class Op = std::plus<>
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, Acc init, Op&& op = Op{}) const -> Acc
+    // clang-format on
+    {
+        ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(
+            xs, lfold_visitor<Acc, std::remove_reference_t<Op>>{init, op});
+        return init;
+    }
+};
+
+struct rfold_impl {
+    // clang-format off
+    template <class V, class Acc, class Op = std::plus<>
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, Acc init, Op&& op = Op{}) const -> Acc
+    // clang-format on
+    {
+        using index_type = typename remove_cvref_t<V>::index_type;
+        for (auto i = static_cast<index_type>(xs.size()); i > 0; --i) {
+            init = invoke(op, xs.unsafe_at(i - 1), std::move(init));
+        }
+        return init;
+    }
+};
+} // namespace detail
+
+/// \brief Left fold.
+
+/// `lfold(xs, init, op)` computes `op(...op(op(init, x0), x1)..., xn)` for
+/// the elements `x0, ..., xn` of `xs`. `op` defaults to `std::plus<>`. The
+/// accumulator has the type of `init` and is moved into every call, so
+/// folding into a container does not copy it. Uses the internal iteration
+/// of #for_each_while.
+///
+/// \code
+/// static constexpr int xs[] = {1, 2, 3, 4};
+/// lfold(raw_view(xs), 0); // 10
+/// \endcode
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto lfold = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::lfold_impl, lfold)
+#endif
+
+/// \brief Right fold.
+
+/// `rfold(xs, init, op)` computes `op(x0, op(x1, ...op(xn, init)...))` for
+/// the elements `x0, ..., xn` of `xs`. `op` defaults to `std::plus<>`.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto rfold = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::rfold_impl, rfold)
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_LFOLD_HPP
@@ -0,0 +1,171 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/linear_scan.hpp
+///
+/// \brief Implementation of #linear_scan.
+
+#ifndef BOOST_STATIC_VIEWS_LINEAR_SCAN_HPP
+#define BOOST_STATIC_VIEWS_LINEAR_SCAN_HPP
+
+#include "concepts.hpp"
+#include "detail/invoke.hpp"
+#include "hashed.hpp"
+#include "hashed_statistics.hpp"
+#include <tuple>
+#include <type_traits>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+/// \brief Degenerate "hashed view" with a single bucket holding the whole
+/// parent view.
+
+/// Lookups ignore the hash and compare against the elements one by one.
+/// For a handful of elements this is faster than hashing followed by a
+/// bucket scan, and since the size of the parent is bounded at compile-time,
+/// compilers fully unroll the loop. The hash function is still stored so
+/// that #static_map::hash_of keeps working.
+template <class Wrapper, class Hasher>
+struct linear_scan_view_impl
+    : view_adaptor_base<linear_scan_view_impl<Wrapper, Hasher>, Wrapper> {
+
+  private:
+    using view_type = typename Wrapper::value_type;
+
+    static_assert(is_wrapper<Hasher>(),
+        "[INTERNAL] Invalid use of linear_scan_view_impl.");
+    static_assert(view_type::extent() != dynamic_extent,
+        "boost::static_views::linear_scan requires the size of the parent "
+        "view to be known at compile-time.");
+
+    using base =
+        view_adaptor_base<linear_scan_view_impl<Wrapper, Hasher>, Wrapper>;
+    using base_index_type = typename base::index_type;
+
+    Hasher _hasher;
+
+  public:
+    using hasher_type = typename Hasher::value_type;
+    using index_type  = std::size_t;
+    using typename base::size_type;
+
+    /// \brief Tells #static_map that lookups don't need the hash.
+    using ignores_hash = std::true_type;
+
+    using base::parent;
+
+    /// \brief Constructs a linear view of \p xs storing the hash function
+    /// \p hf.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    linear_scan_view_impl(Wrapper&& xs, Hasher&& hf)
+        : base{std::move(xs)}, _hasher{std::move(hf)}
+    {
+    }
+
+    /// \brief Returns the number of buckets, i.e. one.
+    static constexpr auto bucket_count() noexcept -> size_type { return 1; }
+
+    /// \brief Returns the number of buckets, i.e. one.
+    static constexpr auto extent() noexcept -> std::ptrdiff_t { return 1; }
+
+    /// \brief Returns the number of elements, regardless of \p hash.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto bucket_size(index_type const /*hash*/) const noexcept -> size_type
+    {
+        return static_cast<size_type>(parent().size());
+    }
+
+    /// \brief Returns a reference to the hash function.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& hash_function() const& noexcept { return _hasher.get(); }
+
+    using reference  = view_type const&;
+    using value_type = view_type;
+
+    /// \brief Returns the parent view, regardless of \p hash.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator[](index_type const /*hash*/) const& noexcept -> reference
+    {
+        return parent();
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto unsafe_at(index_type const /*hash*/) const& noexcept -> reference
+    {
+        return parent();
+    }
+
+    /// \brief Returns a pointer to the first element which satisfies \p p.
+    /// If there is no such element, `nullptr` is returned.
+    template <class Predicate>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto lookup(index_type const /*hash*/, Predicate&& p) const noexcept
+        -> element_pointer_t<view_type>
+    {
+        // extent() only bounds the size: e.g. drop_exactly views can be
+        // shorter at run-time.
+        auto const size = static_cast<base_index_type>(parent().size());
+        for (base_index_type i = 0; i < size; ++i) {
+            auto const x = element_address(parent(), i);
+            if (invoke(p, *x)) return x;
+        }
+        return nullptr;
+    }
+
+    /// \brief Returns occupancy and probe-length statistics of the view.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto statistics() const noexcept
+        -> hashed_statistics<static_cast<std::size_t>(view_type::extent())>
+    {
+        return compute_hashed_statistics<static_cast<std::size_t>(
+            view_type::extent())>(*this);
+    }
+};
+
+struct linear_scan_impl {
+  private:
+    template <class Wrapper, class Hasher>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(Wrapper xs, Hasher hf) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            linear_scan_view_impl<Wrapper, Hasher>{
+                std::move(xs), std::move(hf)});
+
+  public:
+    // clang-format off
+    template <class V, class H
+        BOOST_STATIC_VIEWS_REQUIRES(
+            View<std::remove_cv_t<std::remove_reference_t<V>>>
+         && Hasher<H, typename std::remove_cv_t<
+                          std::remove_reference_t<V>>::reference>)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V&& xs, H&& hf) const
+    // clang-format on
+    {
+        return call_impl(make_wrapper(std::forward<V>(xs)),
+            make_wrapper(std::forward<H>(hf)));
+    }
+};
+
+} // end namespace detail
+
+/// \brief A functor for creating "linear scan views".
+
+/// A drop-in replacement for #hashed with a single bucket which contains
+/// all elements of the view. It is used by #make_static_map_impl for tiny
+/// maps. The size of the view must be known at compile-time.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto linear_scan = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::linear_scan_impl, linear_scan)
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_LINEAR_SCAN_HPP
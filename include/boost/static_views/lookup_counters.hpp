@@ -0,0 +1,222 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/lookup_counters.hpp
+///
+/// \brief Instrumentation policies for #static_map lookups.
+
+#ifndef BOOST_STATIC_VIEWS_LOOKUP_COUNTERS_HPP
+#define BOOST_STATIC_VIEWS_LOOKUP_COUNTERS_HPP
+
+#include "detail/config.hpp"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+/// \brief Default instrumentation policy of #static_map: does nothing.
+
+/// All hooks are empty `constexpr` functions, so a map using this policy
+/// compiles to exactly the same code as an uninstrumented one.
+struct no_lookup_counters {
+    /// \brief Called once per invocation of `key_equal`, i.e. once per
+    /// inspected slot.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    static constexpr auto on_key_equal() noexcept -> void {}
+
+    /// \brief Called once per lookup. \p hit indicates whether the key was
+    /// found.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    static constexpr auto on_lookup(bool const /*hit*/) noexcept -> void {}
+};
+
+/// \brief Aggregated lookup statistics as returned by
+/// #lookup_counters::collect().
+struct lookup_statistics {
+    std::uint64_t lookups;
+    std::uint64_t hits;
+    std::uint64_t key_equal_calls;
+
+    /// \brief Returns the fraction of lookups which found the key.
+    constexpr auto hit_rate() const noexcept -> double
+    {
+        return lookups == 0 ? 0.0
+                            : static_cast<double>(hits)
+                                  / static_cast<double>(lookups);
+    }
+
+    /// \brief Returns the average number of slots inspected per lookup.
+    constexpr auto mean_probes() const noexcept -> double
+    {
+        return lookups == 0 ? 0.0
+                            : static_cast<double>(key_equal_calls)
+                                  / static_cast<double>(lookups);
+    }
+};
+
+inline auto operator+=(lookup_statistics& x, lookup_statistics const& y) noexcept
+    -> lookup_statistics&
+{
+    x.lookups += y.lookups;
+    x.hits += y.hits;
+    x.key_equal_calls += y.key_equal_calls;
+    return x;
+}
+
+inline auto operator-=(lookup_statistics& x, lookup_statistics const& y) noexcept
+    -> lookup_statistics&
+{
+    x.lookups -= y.lookups;
+    x.hits -= y.hits;
+    x.key_equal_calls -= y.key_equal_calls;
+    return x;
+}
+
+namespace detail {
+
+// Counters of a single thread. They are only ever written by the owning
+// thread, so plain load + store is enough and no locked instructions are
+// needed on the hot path. Aligning to a cache line avoids false sharing
+// between threads.
+struct alignas(64) thread_lookup_counters {
+    std::atomic<std::uint64_t> lookups;
+    std::atomic<std::uint64_t> hits;
+    std::atomic<std::uint64_t> key_equal_calls;
+    thread_lookup_counters*    prev;
+    thread_lookup_counters*    next;
+
+    static auto increment(std::atomic<std::uint64_t>& x) noexcept -> void
+    {
+        x.store(x.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+    }
+
+    auto load() const noexcept -> lookup_statistics
+    {
+        return {lookups.load(std::memory_order_relaxed),
+            hits.load(std::memory_order_relaxed),
+            key_equal_calls.load(std::memory_order_relaxed)};
+    }
+};
+
+// List of counters of all live threads plus the totals of threads which have
+// already exited.
+struct lookup_counters_registry {
+    std::mutex              mutex;
+    thread_lookup_counters* head;
+    lookup_statistics       retired;
+    lookup_statistics       baseline;
+
+    auto attach(thread_lookup_counters& x) -> void
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        x.prev = nullptr;
+        x.next = head;
+        if (head != nullptr) head->prev = &x;
+        head = &x;
+    }
+
+    auto detach(thread_lookup_counters& x) -> void
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        retired += x.load();
+        if (x.prev != nullptr) { x.prev->next = x.next; }
+        else {
+            head = x.next;
+        }
+        if (x.next != nullptr) x.next->prev = x.prev;
+    }
+
+    auto total() -> lookup_statistics
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto stats = retired;
+        for (auto* p = head; p != nullptr; p = p->next) {
+            stats += p->load();
+        }
+        return stats;
+    }
+};
+
+} // end namespace detail
+
+/// \brief Instrumentation policy of #static_map which counts lookups, hits
+/// and `key_equal` invocations.
+
+/// Counters are kept per thread (padded to a cache line) and per \p Tag.
+/// Maps that should be accounted separately must therefore use different
+/// tags. Aggregation over all threads happens only when #collect() is
+/// called.
+///
+/// \verbatim embed:rst:leading-slashes
+/// .. note::
+///   Hooks of this policy are not ``constexpr``. Lookups in a map using it
+///   can thus not be evaluated at compile-time.
+/// \endverbatim
+template <class Tag = void>
+struct lookup_counters {
+  private:
+    static auto registry() -> detail::lookup_counters_registry&
+    {
+        static detail::lookup_counters_registry r{};
+        return r;
+    }
+
+    struct local_counters : detail::thread_lookup_counters {
+        local_counters() : detail::thread_lookup_counters{}
+        {
+            registry().attach(*this);
+        }
+
+        ~local_counters() { registry().detach(*this); }
+    };
+
+    static auto local() -> detail::thread_lookup_counters&
+    {
+        static thread_local local_counters counters;
+        return counters;
+    }
+
+  public:
+    static auto on_key_equal() noexcept -> void
+    {
+        detail::thread_lookup_counters::increment(local().key_equal_calls);
+    }
+
+    static auto on_lookup(bool const hit) noexcept -> void
+    {
+        auto& counters = local();
+        detail::thread_lookup_counters::increment(counters.lookups);
+        if (hit) detail::thread_lookup_counters::increment(counters.hits);
+    }
+
+    /// \brief Returns the counters accumulated over all threads since the
+    /// start of the program or the last call to #reset().
+    static auto collect() -> lookup_statistics
+    {
+        auto  stats = registry().total();
+        auto& r     = registry();
+        std::lock_guard<std::mutex> lock{r.mutex};
+        stats -= r.baseline;
+        return stats;
+    }
+
+    /// \brief Resets all counters to zero.
+
+    /// Counters are owned by their threads, so rather than writing to them
+    /// the current totals are recorded and subtracted by #collect().
+    static auto reset() -> void
+    {
+        auto  stats = registry().total();
+        auto& r     = registry();
+        std::lock_guard<std::mutex> lock{r.mutex};
+        r.baseline = stats;
+    }
+};
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_LOOKUP_COUNTERS_HPP
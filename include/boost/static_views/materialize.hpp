@@ -0,0 +1,112 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/materialize.hpp
+///
+/// \brief Implementation of #materialize and #to_array.
+
+#ifndef BOOST_STATIC_VIEWS_MATERIALIZE_HPP
+#define BOOST_STATIC_VIEWS_MATERIALIZE_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "errors.hpp"
+#include "view_concept.hpp"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Expands to a single aggregate initialisation, which, unlike assignment
+// to std::array<T, N>::operator[], is constexpr in C++14.
+template <class T, class V, std::size_t... Is>
+BOOST_STATIC_VIEWS_CONSTEXPR auto to_array_impl(
+    V const& xs, std::index_sequence<Is...> /*unused*/)
+    -> std::array<T, sizeof...(Is)>
+{
+    using index_type = typename V::index_type;
+    return {{xs.unsafe_at(static_cast<index_type>(Is))...}};
+}
+
+template <std::size_t N, class V>
+BOOST_STATIC_VIEWS_CONSTEXPR auto to_array_checked(V const& xs)
+    -> std::array<std::remove_cv_t<typename V::value_type>, N>
+{
+    if (BOOST_STATIC_VIEWS_UNLIKELY(xs.size() != N)) {
+        make_out_of_bound_error(
+            "Precondition `xs.size() == N` not satisfied in "
+            "boost::static_views::to_array<N>(xs).");
+        BOOST_STATIC_VIEWS_UNREACHABLE;
+    }
+    return to_array_impl<std::remove_cv_t<typename V::value_type>>(
+        xs, std::make_index_sequence<N>{});
+}
+
+struct materialize_impl {
+    // clang-format off
+    template <class V
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_CONSTEXPR auto operator()(V const& xs) const
+    // clang-format on
+    {
+        using view_type = remove_cvref_t<V>;
+        static_assert(view_type::extent() != dynamic_extent,
+            "`boost::static_views::materialize(xs)` requires the extent of "
+            "xs to be known at compile-time. Use `to_array<N>(xs)` "
+            "instead.");
+        constexpr auto extent = view_type::extent() == dynamic_extent
+                                    ? std::size_t{0}
+                                    : static_cast<std::size_t>(
+                                          view_type::extent());
+        return to_array_checked<extent>(xs);
+    }
+};
+} // namespace detail
+
+/// \brief Evaluates a view into a `std::array`.
+
+/// `materialize(xs)` returns a `std::array<value_type, extent()>` holding
+/// copies of the elements of `xs`. The extent of `xs` must be known at
+/// compile-time and equal to `xs.size()`. When the view is a compile-time
+/// constant, so is the array, and loops over it read flat data rather
+/// than run the adaptor chain on every access.
+///
+/// \code
+/// static constexpr auto table = materialize(
+///     through(transform(raw_view(data), f), raw_view(proxy)));
+/// for (auto const x : raw_view(table)) { ... }
+/// \endcode
+///
+/// \throws out_of_bound if `xs.size() != extent()`. In a constant
+/// expression, this is a compile error.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto materialize = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::materialize_impl, materialize)
+#endif
+
+/// \brief Evaluates a view of exactly \p N elements into a `std::array`.
+
+/// Like #materialize, but for views whose extent is not known at
+/// compile-time, e.g. `drop(xs, n)` with a run-time `n`.
+///
+/// \throws out_of_bound if `xs.size() != N`. In a constant expression,
+/// this is a compile error.
+// clang-format off
+template <std::size_t N, class V
+    BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+BOOST_STATIC_VIEWS_CONSTEXPR auto to_array(V const& xs)
+// clang-format on
+{
+    return detail::to_array_checked<N>(xs);
+}
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_MATERIALIZE_HPP
@@ -0,0 +1,316 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/overlay_map.hpp
+///
+/// \brief Implementation of #overlay_map.
+
+#ifndef BOOST_STATIC_VIEWS_OVERLAY_MAP_HPP
+#define BOOST_STATIC_VIEWS_OVERLAY_MAP_HPP
+
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "static_map.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+/// \brief A small mutable table of overrides on top of an immutable
+/// #static_map.
+
+/// The static map is referenced rather than copied, so it can (and should)
+/// live in read-only memory. Entries added with #insert_or_assign() take
+/// precedence over the ones in the static map, and #erase() hides a key by
+/// storing a tombstone.
+///
+/// The side table is open-addressed with linear probing and never grows, so
+/// at most \p Capacity distinct keys can be overridden until #clear() is
+/// called. A key keeps its slot until the table is cleared, which means
+/// probe chains never break and readers need no locks. Each slot is
+/// protected by a sequence counter: a reader only retries if it races a
+/// writer on that very slot. Writers are serialised by a mutex.
+///
+/// The payload of a slot is kept as an array of atomic words, so optimistic
+/// reads are race-free. Words are stored with release and loaded with
+/// acquire semantics, which on x86 compiles to plain moves.
+///
+/// Lookups first check an atomic "non-empty" flag, so as long as no
+/// overrides have been made, the cost of a lookup is that of the static map
+/// plus one load.
+///
+/// \tparam StaticMap Type of the underlying #static_map.
+/// \tparam Capacity  Number of slots in the side table. Must be a power of
+///                   two.
+/// \tparam Hasher    Hash function used for the side table. Defaults to the
+///                   one of the static map.
+/// \tparam KeyEqual  Equality comparison used for the side table. Defaults
+///                   to the one of the static map.
+///
+/// \verbatim embed:rst:leading-slashes
+/// .. note::
+///   ``key_type`` and ``mapped_type`` must be trivially copyable, because
+///   readers copy slots optimistically and discard the copy if a writer
+///   interfered.
+/// \endverbatim
+template <class StaticMap, std::size_t Capacity,
+    class Hasher   = std::remove_cv_t<typename StaticMap::key_hasher>,
+    class KeyEqual = std::remove_cv_t<typename StaticMap::key_equal>>
+class overlay_map {
+
+  public:
+    using static_map_type = StaticMap;
+    using key_type        = std::remove_cv_t<typename StaticMap::key_type>;
+    using mapped_type     = std::remove_cv_t<typename StaticMap::mapped_type>;
+    using size_type       = std::size_t;
+
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+        "boost::static_views::overlay_map requires Capacity to be a power "
+        "of two.");
+    static_assert(std::is_trivially_copyable<key_type>::value
+                      && std::is_trivially_copyable<mapped_type>::value,
+        "boost::static_views::overlay_map requires key_type and mapped_type "
+        "to be trivially copyable.");
+    static_assert(std::is_default_constructible<key_type>::value
+                      && std::is_default_constructible<mapped_type>::value,
+        "boost::static_views::overlay_map requires key_type and mapped_type "
+        "to be default constructible.");
+
+  private:
+    enum class slot_state : std::uint8_t { empty, value, tombstone };
+
+    struct payload_type {
+        key_type    key;
+        mapped_type mapped;
+        slot_state  state;
+    };
+
+    using word_type = std::uintptr_t;
+
+    static constexpr std::size_t number_words =
+        (sizeof(payload_type) + sizeof(word_type) - 1) / sizeof(word_type);
+
+    struct slot_type {
+        std::atomic<std::uint32_t> sequence;
+        std::atomic<word_type>     payload[number_words];
+    };
+
+    StaticMap const*  _map;
+    Hasher            _hasher;
+    KeyEqual          _equal;
+    std::atomic<bool> _non_empty;
+    std::mutex        _write_mutex;
+    slot_type         _slots[Capacity];
+
+    // Copies the payload of slot word by word. The copy may be torn if a
+    // writer is active; it's up to the caller to check the sequence. The
+    // acquire loads keep the sequence check from moving up before them.
+    static auto load(slot_type const& slot) noexcept -> payload_type
+    {
+        word_type words[number_words];
+        for (std::size_t i = 0; i < number_words; ++i) {
+            words[i] = slot.payload[i].load(std::memory_order_acquire);
+        }
+        payload_type x;
+        std::memcpy(&x, words, sizeof(payload_type));
+        return x;
+    }
+
+    // Returns a consistent copy of the payload of slot.
+    static auto read(slot_type const& slot) noexcept -> payload_type
+    {
+        for (;;) {
+            auto const before = slot.sequence.load(std::memory_order_acquire);
+            if (BOOST_STATIC_VIEWS_UNLIKELY(before & 1u)) continue;
+            auto const snapshot = load(slot);
+            if (BOOST_STATIC_VIEWS_LIKELY(
+                    slot.sequence.load(std::memory_order_relaxed) == before))
+                return snapshot;
+        }
+    }
+
+    // Must be called with _write_mutex held.
+    static auto write(slot_type& slot, payload_type const& x) noexcept -> void
+    {
+        word_type words[number_words] = {};
+        std::memcpy(words, &x, sizeof(payload_type));
+        auto const before = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(before + 1, std::memory_order_relaxed);
+        // A reader which sees any of these words also sees the odd sequence.
+        for (std::size_t i = 0; i < number_words; ++i) {
+            slot.payload[i].store(words[i], std::memory_order_release);
+        }
+        slot.sequence.store(before + 2, std::memory_order_release);
+    }
+
+    // Returns whether k is in the side table. If it is, found is set to the
+    // contents of its slot.
+    auto find_slot(key_type const& k, payload_type& found) const noexcept
+        -> bool
+    {
+        auto const hash =
+            static_cast<std::size_t>(invoke(_hasher, k));
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            auto const& slot = _slots[(hash + i) & (Capacity - 1)];
+            found            = read(slot);
+            if (found.state == slot_state::empty) return false;
+            if (invoke(_equal, found.key, k)) return true;
+        }
+        return false;
+    }
+
+    // Must be called with _write_mutex held.
+    auto assign(key_type const& k, mapped_type const& v,
+        slot_state const state) -> bool
+    {
+        auto const hash =
+            static_cast<std::size_t>(invoke(_hasher, k));
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            auto& slot = _slots[(hash + i) & (Capacity - 1)];
+            // We're the only writer, so no need for read().
+            auto const current = load(slot);
+            if (current.state == slot_state::empty
+                || invoke(_equal, current.key, k)) {
+                write(slot, payload_type{k, v, state});
+                _non_empty.store(true, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+  public:
+    /// \brief Creates an empty overlay on top of \p map which hashes and
+    /// compares keys like \p map does.
+
+    /// \p map must outlive the overlay.
+    explicit overlay_map(StaticMap const& map)
+        : overlay_map{map, map.key_hasher_fn(), map.key_equal_fn()}
+    {
+    }
+
+    /// \brief Creates an empty overlay on top of \p map.
+
+    /// \p map must outlive the overlay.
+    overlay_map(StaticMap const& map, Hasher hf, KeyEqual equal)
+        : _map{&map}
+        , _hasher{std::move(hf)}
+        , _equal{std::move(equal)}
+        , _non_empty{false}
+        , _write_mutex{}
+        , _slots{}
+    {
+    }
+
+    overlay_map(overlay_map const&) = delete;
+    overlay_map(overlay_map&&)      = delete;
+    overlay_map& operator=(overlay_map const&) = delete;
+    overlay_map& operator=(overlay_map&&) = delete;
+
+    /// \brief Returns the underlying static map.
+    auto base() const noexcept -> StaticMap const& { return *_map; }
+
+    /// \brief Returns the number of slots in the side table.
+    static constexpr auto capacity() noexcept -> size_type
+    {
+        return Capacity;
+    }
+
+    /// \brief Looks up \p k. If found, the mapped value is copied into \p
+    /// out and `true` is returned.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    auto find(key_type const& k, mapped_type& out) const -> bool
+    {
+        if (BOOST_STATIC_VIEWS_UNLIKELY(
+                _non_empty.load(std::memory_order_acquire))) {
+            payload_type x;
+            if (find_slot(k, x)) {
+                if (x.state == slot_state::tombstone) return false;
+                out = x.mapped;
+                return true;
+            }
+        }
+        auto const p = _map->find(k);
+        if (p == nullptr) return false;
+        out = invoke(_map->mapped_fn(), *p);
+        return true;
+    }
+
+    /// \brief Returns the number of times \p k occurs in the map, i.e. zero
+    /// or one.
+    auto count(key_type const& k) const -> size_type
+    {
+        mapped_type unused;
+        return find(k, unused) ? 1 : 0;
+    }
+
+    /// \brief Returns (a copy of) the value corresponding to \p k.
+
+    /// \throws key_not_found_error if there is no such key.
+    auto at(key_type const& k) const -> mapped_type
+    {
+        mapped_type x;
+        if (!find(k, x)) { throw key_not_found_error{}; }
+        return x;
+    }
+
+    /// \brief Overrides the value corresponding to \p k.
+
+    /// Returns `false` if \p k is new and the side table is full.
+    auto insert_or_assign(key_type const& k, mapped_type const& v) -> bool
+    {
+        std::lock_guard<std::mutex> lock{_write_mutex};
+        return assign(k, v, slot_state::value);
+    }
+
+    /// \brief Hides the key \p k.
+
+    /// Returns `false` if \p k is new and the side table is full.
+    auto erase(key_type const& k) -> bool
+    {
+        std::lock_guard<std::mutex> lock{_write_mutex};
+        return assign(k, mapped_type{}, slot_state::tombstone);
+    }
+
+    /// \brief Removes all overrides.
+    auto clear() -> void
+    {
+        std::lock_guard<std::mutex> lock{_write_mutex};
+        _non_empty.store(false, std::memory_order_release);
+        for (auto& slot : _slots) {
+            if (load(slot).state != slot_state::empty) {
+                write(slot, payload_type{});
+            }
+        }
+    }
+};
+
+/// \brief Creates an #overlay_map on top of \p map.
+template <std::size_t Capacity, class StaticMap>
+auto make_overlay_map(StaticMap const& map)
+    -> std::unique_ptr<overlay_map<StaticMap, Capacity>>
+{
+    return std::unique_ptr<overlay_map<StaticMap, Capacity>>{
+        new overlay_map<StaticMap, Capacity>{map}};
+}
+
+/// \brief Creates an #overlay_map on top of \p map with a custom hash
+/// function and equality comparison.
+template <std::size_t Capacity, class StaticMap, class Hasher, class KeyEqual>
+auto make_overlay_map(StaticMap const& map, Hasher hf, KeyEqual equal)
+    -> std::unique_ptr<overlay_map<StaticMap, Capacity, Hasher, KeyEqual>>
+{
+    return std::unique_ptr<overlay_map<StaticMap, Capacity, Hasher, KeyEqual>>{
+        new overlay_map<StaticMap, Capacity, Hasher, KeyEqual>{
+            map, std::move(hf), std::move(equal)}};
+}
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_OVERLAY_MAP_HPP
@@ -0,0 +1,335 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/packed_hashed.hpp
+///
+/// \brief Implementation of #packed_hashed.
+
+#ifndef BOOST_STATIC_VIEWS_PACKED_HASHED_HPP
+#define BOOST_STATIC_VIEWS_PACKED_HASHED_HPP
+
+#include "concepts.hpp"
+#include "detail/invoke.hpp"
+#include "hashed.hpp"
+#include "hashed_statistics.hpp"
+#include "raw_view.hpp"
+#include "slice.hpp"
+#include "through.hpp"
+#include <tuple>
+#include <type_traits>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+/// \brief Hashed view with a "compressed sparse row" layout.
+
+/// Unlike #hashed_view_impl which reserves `BucketSize` slots for every
+/// bucket, this view stores a `bucket_count() + 1` array of offsets and a
+/// dense array of indices into the parent view. Indices of the elements in
+/// bucket `b` are then `indices[offsets[b]], ..., indices[offsets[b + 1] -
+/// 1]`. There are thus no empty slots and buckets never overflow.
+template <std::size_t BucketCount, class Wrapper, class Hasher>
+struct packed_hashed_view_impl
+    : view_adaptor_base<packed_hashed_view_impl<BucketCount, Wrapper, Hasher>,
+          Wrapper> {
+
+  private:
+    using view_type = typename Wrapper::value_type;
+
+    static_assert(is_wrapper<Hasher>(),
+        "[INTERNAL] Invalid use of packed_hashed_view_impl.");
+    static_assert(view_type::extent() != dynamic_extent,
+        "boost::static_views::packed_hashed_view requires the size of the "
+        "parent view to be known at compile-time.");
+
+    using base = view_adaptor_base<
+        packed_hashed_view_impl<BucketCount, Wrapper, Hasher>, Wrapper>;
+    using base_index_type = typename base::index_type;
+
+  public:
+    using hasher_type = typename Hasher::value_type;
+    using index_type  = std::size_t;
+    using typename base::size_type;
+
+    using base::parent;
+
+    /// \brief Returns the number buckets.
+    static constexpr auto bucket_count() noexcept
+    {
+        static_assert(BucketCount > 0, "Zero-sized "
+                                       "boost::static_views::packed_hashed_"
+                                       "view is not supported.");
+        return static_cast<size_type>(BucketCount);
+    }
+
+  private:
+    // Zero-length arrays are not allowed, hence the max.
+    static constexpr auto capacity() noexcept -> std::size_t
+    {
+        return view_type::extent() > 0
+                   ? static_cast<std::size_t>(view_type::extent())
+                   : 1u;
+    }
+
+    using offsets_type = base_index_type[bucket_count() + 1];
+    using indices_type = base_index_type[capacity()];
+
+    struct storage_type {
+        offsets_type offsets;
+        indices_type indices;
+    };
+
+    std::tuple<storage_type, Hasher> _data;
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto offsets() const & noexcept -> offsets_type const&
+    {
+        return std::get<0>(_data).offsets;
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto offsets() & noexcept -> offsets_type& { return std::get<0>(_data).offsets; }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto indices() const & noexcept -> indices_type const&
+    {
+        return std::get<0>(_data).indices;
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto indices() & noexcept -> indices_type& { return std::get<0>(_data).indices; }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto bucket_of(std::size_t const hash) noexcept -> std::size_t
+    {
+        return hash % bucket_count();
+    }
+
+    // A counting sort of indices by bucket. Reverse scattering keeps the
+    // elements within a bucket in the order they appear in the parent view.
+    BOOST_STATIC_VIEWS_CONSTEXPR auto initialise_storage()
+    {
+        using I = base_index_type;
+        auto const size = static_cast<I>(parent().size());
+
+        for (std::size_t b = 0; b <= bucket_count(); ++b)
+            offsets()[b] = 0;
+        for (I i = 0; i < size; ++i)
+            ++offsets()[bucket_of(
+                invoke(hash_function(), parent().unsafe_at(i)))];
+        // offsets()[b] is now the number of elements in bucket b. A prefix
+        // sum turns it into one-past-the-end of bucket b.
+        for (std::size_t b = 1; b < bucket_count(); ++b)
+            offsets()[b] += offsets()[b - 1];
+        offsets()[bucket_count()] = size;
+        for (I i = size; i-- > 0;) {
+            auto const b =
+                bucket_of(invoke(hash_function(), parent().unsafe_at(i)));
+            indices()[--offsets()[b]] = i;
+        }
+    }
+
+    // Removes all elements for which an equal element occurs earlier in the
+    // same bucket, i.e. the first occurrence wins.
+    template <class Equal>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto remove_duplicates(Equal& equal)
+    {
+        using I = base_index_type;
+        I out   = 0;
+        for (std::size_t b = 0; b < bucket_count(); ++b) {
+            auto const first = offsets()[b];
+            auto const last  = offsets()[b + 1];
+            offsets()[b]     = out;
+            for (auto j = first; j < last; ++j) {
+                auto const& x         = parent().unsafe_at(indices()[j]);
+                bool        duplicate = false;
+                for (auto k = offsets()[b]; k < out && !duplicate; ++k) {
+                    duplicate =
+                        invoke(equal, parent().unsafe_at(indices()[k]), x);
+                }
+                if (!duplicate) { indices()[out++] = indices()[j]; }
+            }
+        }
+        offsets()[bucket_count()] = out;
+    }
+
+  public:
+    /// \brief Constructs a packed hashed view of \p xs using \p hf as a hash
+    /// function.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    packed_hashed_view_impl(Wrapper&& xs, Hasher&& hf)
+        : base{std::move(xs)}, _data{storage_type{}, std::move(hf)}
+    {
+        initialise_storage();
+    }
+
+    /// \brief Constructs a packed hashed view of \p xs using \p hf as a hash
+    /// function. Elements considered equal by \p equal are stored only once.
+    template <class Equal>
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    packed_hashed_view_impl(Wrapper&& xs, Hasher&& hf, Equal&& equal)
+        : base{std::move(xs)}, _data{storage_type{}, std::move(hf)}
+    {
+        initialise_storage();
+        remove_duplicates(equal);
+    }
+
+    /// \brief Returns the number of buckets.
+
+    /// \verbatim embed:rst:leading-slashes
+    /// This function is required by the :ref:`view <view-concept>`
+    /// concept. Just like :cpp:class:`hashed_view_impl`, this is a view of
+    /// buckets rather than individual elements.
+    /// \endverbatim
+    static constexpr auto extent() noexcept -> std::ptrdiff_t
+    {
+        return static_cast<std::ptrdiff_t>(bucket_count());
+    }
+
+    /// \brief Returns the number of elements in the bucket corresponding to
+    /// \p hash.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto bucket_size(index_type const hash) const noexcept -> size_type
+    {
+        auto const b = bucket_of(hash);
+        return static_cast<size_type>(offsets()[b + 1] - offsets()[b]);
+    }
+
+    /// \brief Returns a reference to the hash function.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& hash_function() const& noexcept
+    {
+        return std::get<1>(_data).get();
+    }
+
+    using reference = decltype(through(std::declval<view_type const&>(),
+        slice(raw_view(std::declval<indices_type const&>()),
+            std::declval<base_index_type>(), std::declval<base_index_type>())));
+    using value_type = std::remove_reference_t<reference>;
+
+    /// \brief Returns the bucket corresponding to \p hash.
+
+    /// Contrary to #hashed_view_impl::operator[], the returned view is an
+    /// exact slice of the index array, i.e. no search for the first empty
+    /// slot is needed.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator[](index_type const hash)
+        const& BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true) -> reference
+    {
+        auto const b = bucket_of(hash);
+        return through(
+            parent(), slice(raw_view(indices()), offsets()[b], offsets()[b + 1]));
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto unsafe_at(index_type const hash)
+        const& BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(true) -> reference
+    {
+        return this->operator[](hash);
+    }
+
+    /// \brief Returns a pointer to the first element in the bucket
+    /// corresponding to \p hash which satisfies \p p. If there is no such
+    /// element, `nullptr` is returned.
+    template <class Predicate>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto lookup(index_type const hash, Predicate&& p) const noexcept
+        -> element_pointer_t<view_type>
+    {
+        auto const b = bucket_of(hash);
+        for (auto i = offsets()[b], last = offsets()[b + 1]; i < last; ++i) {
+            auto const x = element_address(parent(), indices()[i]);
+            if (invoke(p, *x)) return x;
+        }
+        return nullptr;
+    }
+
+    /// \brief Returns occupancy and probe-length statistics of the view.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto statistics() const noexcept -> hashed_statistics<capacity()>
+    {
+        return compute_hashed_statistics<capacity()>(*this);
+    }
+};
+
+template <std::size_t BucketCount>
+struct packed_hashed_impl {
+
+  private:
+    template <class Wrapper, class Hasher>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(Wrapper xs, Hasher hf) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            packed_hashed_view_impl<BucketCount, Wrapper, Hasher>{
+                std::move(xs), std::move(hf)});
+
+    template <class Wrapper, class Hasher, class Equal>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        Wrapper xs, Hasher hf, Equal&& equal) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            packed_hashed_view_impl<BucketCount, Wrapper, Hasher>{
+                std::move(xs), std::move(hf), std::forward<Equal>(equal)});
+
+    static_assert(BucketCount > 0,
+        "`boost::static_views::packed_hashed<BucketCount>` requires "
+        "BucketCount to be greater than zero.");
+
+  public:
+    // clang-format off
+    template <class V, class H
+        BOOST_STATIC_VIEWS_REQUIRES(
+            View<std::remove_cv_t<std::remove_reference_t<V>>>
+         && Hasher<H, typename std::remove_cv_t<
+                          std::remove_reference_t<V>>::reference>)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V&& xs, H&& hf) const
+    // clang-format on
+    {
+        return call_impl(make_wrapper(std::forward<V>(xs)),
+            make_wrapper(std::forward<H>(hf)));
+    }
+
+    // clang-format off
+    template <class V, class H, class Equal
+        BOOST_STATIC_VIEWS_REQUIRES(
+            View<std::remove_cv_t<std::remove_reference_t<V>>>
+         && Hasher<H, typename std::remove_cv_t<
+                          std::remove_reference_t<V>>::reference>)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V&& xs, H&& hf, Equal&& equal) const
+    // clang-format on
+    {
+        return call_impl(make_wrapper(std::forward<V>(xs)),
+            make_wrapper(std::forward<H>(hf)), std::forward<Equal>(equal));
+    }
+};
+
+} // end namespace detail
+
+/// \brief A functor for creating "packed hashed views"
+
+/// Behaves exactly like #hashed except for the memory layout: instead of
+/// `BucketCount * BucketSize` slots, `BucketCount + 1 + xs.size()` indices
+/// are stored. The size of the parent view must thus be known at
+/// compile-time.
+#if defined(DOXYGEN_IN_HOUSE)
+template <std::size_t BucketCount>
+constexpr auto packed_hashed = implementation detail;
+#else
+inline namespace {
+template <std::size_t BucketCount>
+BOOST_STATIC_VIEWS_CONSTEXPR auto const& packed_hashed =
+    ::BOOST_STATIC_VIEWS_NAMESPACE::_static_const<
+        detail::packed_hashed_impl<BucketCount>>;
+} // anonymous namespace
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_PACKED_HASHED_HPP
@@ -0,0 +1,338 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/parallel.hpp
+///
+/// \brief Implementation of #parallel_for_each, #parallel_reduce and
+/// #parallel_transform_into.
+
+#ifndef BOOST_STATIC_VIEWS_PARALLEL_HPP
+#define BOOST_STATIC_VIEWS_PARALLEL_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "detail/threads.hpp"
+#include "for_each.hpp"
+#include "reduce.hpp"
+#include "slice.hpp"
+#include "view_concept.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+/// \brief Runs work on `std::thread`s started for every call.
+
+/// This is the default executor of the parallel algorithms. An executor is
+/// any type `E` such that for `e` of type `E const&`
+///   * `e.concurrency()` returns the number of workers as an `unsigned`;
+///   * `e(f)` calls `f(0), ..., f(e.concurrency() - 1)` concurrently and
+///     returns once all calls have returned. Exceptions thrown by `f` are
+///     propagated to the caller.
+///
+/// so a thread pool of an application can be plugged in.
+class thread_executor {
+    unsigned _threads;
+
+  public:
+    /// \param threads Number of threads to use. Zero means
+    ///                `std::thread::hardware_concurrency()`.
+    explicit thread_executor(unsigned const threads = 0) noexcept
+        : _threads{threads != 0 ? threads
+                                : std::max(
+                                      std::thread::hardware_concurrency(), 1u)}
+    {
+    }
+
+    auto concurrency() const noexcept -> unsigned { return _threads; }
+
+    template <class Function>
+    auto operator()(Function&& f) const -> void
+    {
+        detail::run_on_threads(_threads, f);
+    }
+};
+
+namespace detail {
+
+template <class E>
+using concurrency_t = decltype(std::declval<E const&>().concurrency());
+
+template <class E>
+using is_executor = std::is_convertible<detected_t<concurrency_t, E>, unsigned>;
+
+// A range of grains [front, back) packed into one word, so that both ends
+// can be updated with a single compare-and-swap. Padded to a cache line,
+// since the owner updates it once per grain.
+struct grain_range {
+    std::atomic<std::uint64_t> bounds;
+    char                       _padding[64 - sizeof(std::uint64_t)];
+
+    static constexpr auto pack(std::uint64_t const front,
+        std::uint64_t const back) noexcept -> std::uint64_t
+    {
+        return front | (back << 32);
+    }
+
+    // Takes a grain from the front.
+    auto pop_front(std::size_t& grain) noexcept -> bool
+    {
+        return pop(grain, true);
+    }
+
+    // Takes a grain from the back.
+    auto pop_back(std::size_t& grain) noexcept -> bool
+    {
+        return pop(grain, false);
+    }
+
+  private:
+    auto pop(std::size_t& grain, bool const from_front) noexcept -> bool
+    {
+        auto          old = bounds.load(std::memory_order_relaxed);
+        std::uint64_t front, back;
+        do {
+            front = old & 0xFFFFFFFF;
+            back  = old >> 32;
+            if (front >= back) return false;
+        } while (!bounds.compare_exchange_weak(old,
+            from_front ? pack(front + 1, back) : pack(front, back - 1),
+            std::memory_order_relaxed));
+        grain = static_cast<std::size_t>(from_front ? front : back - 1);
+        return true;
+    }
+};
+
+// Large enough for the compare-and-swap to be noise, small enough for
+// stealing to even out differences between workers.
+inline auto grain_count(unsigned const workers, std::size_t const size) noexcept
+    -> std::size_t
+{
+    constexpr std::size_t min_grain_size    = 1u << 14;
+    constexpr std::size_t grains_per_worker = 16;
+    return std::max<std::size_t>(
+        std::min(size / min_grain_size, workers * grains_per_worker), 1);
+}
+
+// Splits [0, size) into grain_count(workers, size) grains and calls
+// f(grain, b, e) for every grain [b, e) on the workers of executor.
+//
+// Every worker starts with a contiguous range of grains and processes them
+// front to back, so it streams through memory. A worker which runs out of
+// grains steals them from the backs of the ranges of other workers. Views
+// are random-access, so stealing only moves the bounds of a range; no
+// task queues are needed.
+template <class Executor, class Function>
+auto parallel_grains(Executor const& executor, std::size_t const size,
+    Function&& f) -> void
+{
+    auto const workers    = std::max(executor.concurrency(), 1u);
+    auto const grains     = grain_count(workers, size);
+    auto const grain_size = (size + grains - 1) / grains;
+
+    std::unique_ptr<grain_range[]> ranges{new grain_range[workers]};
+    for (std::size_t t = 0; t < workers; ++t) {
+        ranges[t].bounds.store(grain_range::pack(
+            grains * t / workers, grains * (t + 1) / workers));
+    }
+
+    auto const process = [&f, size, grain_size](std::size_t const grain) {
+        auto const b = grain * grain_size;
+        auto const e = std::min(b + grain_size, size);
+        if (b < e) f(grain, b, e);
+    };
+    executor([&ranges, &process, workers](unsigned const worker) {
+        std::size_t grain;
+        while (ranges[worker].pop_front(grain)) {
+            process(grain);
+        }
+        for (unsigned i = 1; i < workers; ++i) {
+            auto& victim = ranges[(worker + i) % workers];
+            while (victim.pop_back(grain)) {
+                process(grain);
+            }
+        }
+    });
+}
+
+template <class V, class F, class Executor>
+auto parallel_for_each_impl(V const& xs, F& f, Executor const& executor)
+    -> void
+{
+    using index_type = typename V::index_type;
+    parallel_grains(executor, static_cast<std::size_t>(xs.size()),
+        [&xs, &f](std::size_t /*unused*/, std::size_t const b,
+            std::size_t const e) {
+            ::BOOST_STATIC_VIEWS_NAMESPACE::for_each(
+                slice(xs, static_cast<index_type>(b),
+                    static_cast<index_type>(e)),
+                f);
+        });
+}
+
+template <class V, class Acc, class Op, class Executor>
+auto parallel_reduce_impl(V const& xs, Acc init, Op& op,
+    Executor const& executor) -> Acc
+{
+    using index_type = typename V::index_type;
+    auto const size  = static_cast<std::size_t>(xs.size());
+    // Grains depend only on the size and the number of workers, so the
+    // result does not depend on scheduling.
+    std::vector<std::unique_ptr<Acc>> partials(
+        grain_count(std::max(executor.concurrency(), 1u), size));
+    parallel_grains(executor, size,
+        [&xs, &op, &partials](std::size_t const grain, std::size_t const b,
+            std::size_t const e) {
+            auto partial = reduce_impl::range(xs,
+                static_cast<index_type>(b + 1), static_cast<index_type>(e),
+                Acc(xs.unsafe_at(static_cast<index_type>(b))), op);
+            partials[grain].reset(new Acc(std::move(partial)));
+        });
+    for (auto& partial : partials) {
+        if (partial) init = invoke(op, std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+template <class Out, class F>
+struct transform_into_visitor {
+    Out& out;
+    F&   f;
+
+    template <class T>
+    auto operator()(T&& x) const -> void
+    {
+        *out = invoke(f, std::forward<T>(x));
+        ++out;
+    }
+};
+
+template <class V, class Out, class F, class Executor>
+auto parallel_transform_into_impl(V const& xs, Out out, F& f,
+    Executor const& executor) -> Out
+{
+    using index_type = typename V::index_type;
+    auto const size  = static_cast<std::size_t>(xs.size());
+    parallel_grains(executor, size,
+        [&xs, &f, out](std::size_t /*unused*/, std::size_t const b,
+            std::size_t const e) {
+            auto first = out + static_cast<std::ptrdiff_t>(b);
+            ::BOOST_STATIC_VIEWS_NAMESPACE::for_each(
+                slice(xs, static_cast<index_type>(b),
+                    static_cast<index_type>(e)),
+                transform_into_visitor<Out, F>{first, f});
+        });
+    return out + static_cast<std::ptrdiff_t>(size);
+}
+
+} // namespace detail
+
+/// \brief Calls `f(x)` for all elements `x` of a view using multiple
+/// threads.
+
+/// The view is split into ranges of indices which are balanced between the
+/// workers of \p executor by work stealing. Within a range, elements are
+/// visited in order with #for_each. \p f is called concurrently.
+// clang-format off
+template <class V, class F, class Executor
+    BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>
+        && detail::is_executor<remove_cvref_t<Executor>>::value)
+auto parallel_for_each(V const& xs, F&& f, Executor const& executor) -> void
+// clang-format on
+{
+    detail::parallel_for_each_impl(xs, f, executor);
+}
+
+/// \overload
+///
+/// \param threads Number of threads to use. Zero means
+///                `std::thread::hardware_concurrency()`.
+// clang-format off
+template <class V, class F
+    BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+auto parallel_for_each(V const& xs, F&& f, unsigned const threads = 0)
+    -> void
+// clang-format on
+{
+    detail::parallel_for_each_impl(xs, f, thread_executor{threads});
+}
+
+/// \brief Reduces a view with an associative and commutative operation
+/// using multiple threads.
+
+/// Every range of indices is reduced with #reduce, and the partial results
+/// are then combined with \p init in the order of the ranges. The ranges
+/// depend only on the size of the view and the number of workers, so the
+/// result does not depend on scheduling. `Acc` must be constructible from
+/// the elements of the view. \p op is called concurrently.
+// clang-format off
+template <class V, class Acc, class Op, class Executor
+    BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>
+        && detail::is_executor<remove_cvref_t<Executor>>::value)
+auto parallel_reduce(V const& xs, Acc init, Op&& op, Executor const& executor)
+    -> Acc
+// clang-format on
+{
+    return detail::parallel_reduce_impl(xs, std::move(init), op, executor);
+}
+
+/// \overload
+///
+/// \param threads Number of threads to use. Zero means
+///                `std::thread::hardware_concurrency()`.
+// clang-format off
+template <class V, class Acc, class Op = std::plus<>
+    BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+auto parallel_reduce(V const& xs, Acc init, Op&& op = Op{},
+    unsigned const threads = 0) -> Acc
+// clang-format on
+{
+    return detail::parallel_reduce_impl(
+        xs, std::move(init), op, thread_executor{threads});
+}
+
+/// \brief Stores `f(x)` for the elements `x` of a view into a random-access
+/// iterator using multiple threads.
+
+/// `out[i] = f(xs[i])` for all `0 <= i < xs.size()`. Returns
+/// `out + xs.size()`. \p f is called concurrently.
+// clang-format off
+template <class V, class Out, class F, class Executor
+    BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>
+        && detail::is_executor<remove_cvref_t<Executor>>::value)
+auto parallel_transform_into(V const& xs, Out out, F&& f,
+    Executor const& executor) -> Out
+// clang-format on
+{
+    return detail::parallel_transform_into_impl(xs, out, f, executor);
+}
+
+/// \overload
+///
+/// \param threads Number of threads to use. Zero means
+///                `std::thread::hardware_concurrency()`.
+// clang-format off
+template <class V, class Out, class F
+    BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+auto parallel_transform_into(V const& xs, Out out, F&& f,
+    unsigned const threads = 0) -> Out
+// clang-format on
+{
+    return detail::parallel_transform_into_impl(
+        xs, out, f, thread_executor{threads});
+}
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_PARALLEL_HPP
@@ -0,0 +1,234 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/parallel_hashed.hpp
+///
+/// \brief Implementation of #parallel_hashed.
+
+#ifndef BOOST_STATIC_VIEWS_PARALLEL_HASHED_HPP
+#define BOOST_STATIC_VIEWS_PARALLEL_HASHED_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "detail/threads.hpp"
+#include "hashed.hpp"
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Builds a hashed_view_impl using multiple threads.
+//
+// 1) Every thread hashes a contiguous chunk of the parent view and counts how
+//    many of its elements fall into each partition. Partition p consists of
+//    the buckets [p * w, (p + 1) * w) where w = ceil(bucket_count / threads).
+// 2) Prefix sums over (partition, thread) give every thread a private range
+//    of an index array for every partition. Threads then scatter indices of
+//    their elements into these ranges. Within a partition, indices thus
+//    remain sorted.
+// 3) Every thread inserts the elements of one partition. Partitions own
+//    disjoint ranges of buckets, so no synchronisation is needed, and since
+//    elements are inserted in the same order as by the sequential
+//    constructor, the resulting layout is identical.
+template <std::size_t BucketCount, std::size_t BucketSize, class Wrapper,
+    class Hasher>
+struct parallel_hashed_builder<
+    hashed_view_impl<BucketCount, BucketSize, Wrapper, Hasher>> {
+
+  private:
+    using view_type  = hashed_view_impl<BucketCount, BucketSize, Wrapper, Hasher>;
+    using index_type = typename view_type::base::index_type;
+
+    struct no_equal {
+    };
+
+    template <class Equal>
+    static auto insert(view_type& view, index_type const i,
+        index_type const guess, Equal& equal) -> void
+    {
+        view.insert(i, guess, equal);
+    }
+
+    static auto insert(view_type& view, index_type const i,
+        index_type const guess, no_equal& /*unused*/) -> void
+    {
+        view.insert(i, guess);
+    }
+
+    static auto chunk(std::size_t const n, unsigned const threads,
+        unsigned const t) noexcept -> std::size_t
+    {
+        return n / threads * t + (n % threads) * t / threads;
+    }
+
+    template <class Equal>
+    static auto build(view_type& view, unsigned const threads, Equal& equal)
+        -> void
+    {
+        constexpr auto capacity = BucketCount * BucketSize;
+        auto const     n        = static_cast<std::size_t>(view.parent().size());
+        auto const     width    = (BucketCount + threads - 1) / threads;
+
+        std::vector<std::size_t> buckets(n);
+        std::vector<std::size_t> counts(std::size_t{threads} * threads);
+        std::vector<index_type>  order(n);
+
+        run_on_threads(threads, [&](unsigned const t) {
+            // Storage of the view is zero-filled, but zero is a valid index
+            // and empty slots hold capacity instead.
+            for (auto i = chunk(capacity, threads, t),
+                      last = chunk(capacity, threads, t + 1);
+                 i < last; ++i) {
+                view.storage()[i] = static_cast<index_type>(capacity);
+            }
+            auto* const count = counts.data() + std::size_t{t} * threads;
+            for (auto i = chunk(n, threads, t), last = chunk(n, threads, t + 1);
+                 i < last; ++i) {
+                auto const hash = invoke(view.hash_function(),
+                    view.parent().unsafe_at(static_cast<index_type>(i)));
+                buckets[i] = static_cast<std::size_t>(hash) % BucketCount;
+                ++count[buckets[i] / width];
+            }
+        });
+
+        // counts[t * threads + p] becomes the offset in order at which
+        // thread t writes the elements of partition p. partitions[p] is the
+        // beginning of partition p.
+        std::vector<std::size_t> partitions(threads + 1);
+        std::size_t              offset = 0;
+        for (unsigned p = 0; p < threads; ++p) {
+            partitions[p] = offset;
+            for (unsigned t = 0; t < threads; ++t) {
+                auto const c = counts[std::size_t{t} * threads + p];
+                counts[std::size_t{t} * threads + p] = offset;
+                offset += c;
+            }
+        }
+        partitions[threads] = offset;
+
+        run_on_threads(threads, [&](unsigned const t) {
+            auto* const position = counts.data() + std::size_t{t} * threads;
+            for (auto i = chunk(n, threads, t), last = chunk(n, threads, t + 1);
+                 i < last; ++i) {
+                order[position[buckets[i] / width]++] =
+                    static_cast<index_type>(i);
+            }
+        });
+
+        run_on_threads(threads, [&](unsigned const p) {
+            for (auto j = partitions[p]; j < partitions[p + 1]; ++j) {
+                auto const i = order[j];
+                insert(view, i,
+                    static_cast<index_type>(
+                        BucketSize * buckets[static_cast<std::size_t>(i)]),
+                    equal);
+            }
+        });
+    }
+
+    static auto allocate(unsigned& threads, Wrapper&& xs, Hasher&& hf)
+        -> std::unique_ptr<view_type>
+    {
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+        if (threads > BucketCount) threads = static_cast<unsigned>(BucketCount);
+        return std::unique_ptr<view_type>{
+            new view_type{typename view_type::unbuilt_tag{},
+                std::move(xs), std::move(hf)}};
+    }
+
+  public:
+    static auto make(unsigned threads, Wrapper&& xs, Hasher&& hf)
+        -> std::unique_ptr<view_type>
+    {
+        auto view = allocate(threads, std::move(xs), std::move(hf));
+        no_equal equal;
+        build(*view, threads, equal);
+        return view;
+    }
+
+    template <class Equal>
+    static auto make(unsigned threads, Wrapper&& xs, Hasher&& hf,
+        Equal&& equal) -> std::unique_ptr<view_type>
+    {
+        auto view = allocate(threads, std::move(xs), std::move(hf));
+        build(*view, threads, equal);
+        return view;
+    }
+};
+
+} // end namespace detail
+
+/// \brief Builds a #hashed view using multiple threads.
+
+/// This is meant for large views of runtime data (e.g. with
+/// `extent() == dynamic_extent`) for which single-threaded construction
+/// of #hashed takes too long. The result is identical to
+/// `hashed<BucketCount, BucketSize>(xs, hf)`, i.e. buckets contain the same
+/// elements in the same order. Elements are partitioned by bucket so that
+/// every thread fills its own range of buckets and no locks are taken.
+///
+/// The view is allocated on the heap, because its storage (`BucketCount *
+/// BucketSize` indices) is typically too large for the stack.
+///
+/// \param xs      View to build the index for.
+/// \param hf      Hash function. It is called concurrently from multiple
+///                threads.
+/// \param threads Number of threads to use. Zero means
+///                `std::thread::hardware_concurrency()`.
+///
+/// \throws full_bucket if an insert into a full bucket is attempted.
+// clang-format off
+template <std::size_t BucketCount, std::size_t BucketSize = 4u, class V,
+    class H
+    BOOST_STATIC_VIEWS_REQUIRES(
+        View<std::remove_cv_t<std::remove_reference_t<V>>>
+     && detail::Hasher<H, typename std::remove_cv_t<
+                              std::remove_reference_t<V>>::reference>)
+auto parallel_hashed(V&& xs, H&& hf, unsigned const threads = 0)
+// clang-format on
+{
+    using view_type = detail::hashed_view_impl<BucketCount, BucketSize,
+        decltype(make_wrapper(std::forward<V>(xs))),
+        decltype(make_wrapper(std::forward<H>(hf)))>;
+    return detail::parallel_hashed_builder<view_type>::make(threads,
+        make_wrapper(std::forward<V>(xs)), make_wrapper(std::forward<H>(hf)));
+}
+
+/// \brief Builds a #hashed view using multiple threads. Elements considered
+/// equal by \p equal are stored only once.
+
+/// Just like for #hashed, the first occurrence of an element wins. \p equal
+/// is called concurrently from multiple threads.
+// clang-format off
+template <std::size_t BucketCount, std::size_t BucketSize = 4u, class V,
+    class H, class Equal
+    BOOST_STATIC_VIEWS_REQUIRES(
+        View<std::remove_cv_t<std::remove_reference_t<V>>>
+     && detail::Hasher<H, typename std::remove_cv_t<
+                              std::remove_reference_t<V>>::reference>
+     && is_invocable_r<bool, Equal&,
+            typename std::remove_cv_t<std::remove_reference_t<V>>::reference,
+            typename std::remove_cv_t<std::remove_reference_t<V>>::reference>::value)
+auto parallel_hashed(V&& xs, H&& hf, Equal&& equal, unsigned const threads = 0)
+// clang-format on
+{
+    using view_type = detail::hashed_view_impl<BucketCount, BucketSize,
+        decltype(make_wrapper(std::forward<V>(xs))),
+        decltype(make_wrapper(std::forward<H>(hf)))>;
+    return detail::parallel_hashed_builder<view_type>::make(threads,
+        make_wrapper(std::forward<V>(xs)), make_wrapper(std::forward<H>(hf)),
+        std::forward<Equal>(equal));
+}
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_PARALLEL_HASHED_HPP
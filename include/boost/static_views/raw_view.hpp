@@ -13,12 +13,17 @@
 #include "detail/config.hpp"
 #include "errors.hpp"
 #include "sequence_traits.hpp"
+#include "view_base.hpp"
 #include <type_traits>
 
 BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
 
 namespace detail {
 
+template <class S>
+using sequence_data_t =
+    decltype(sequence_traits<S>::data(std::declval<S&>()));
+
 template <class S
     BOOST_STATIC_VIEWS_REQUIRES(Sequence<S>)
 struct raw_view_impl {
@@ -66,7 +71,6 @@ struct raw_view_impl {
     BOOST_STATIC_VIEWS_PURE
     constexpr auto size() const noexcept
     {
-        BOOST_STATIC_VIEWS_ASSUME(_xs != nullptr);
         return sequence_traits<sequence_type>::size(*_xs);
     }
 
@@ -92,6 +96,34 @@ struct raw_view_impl {
         }
         return unsafe_at(i);
     }
+
+    /// \brief Returns a pointer to the first element.
+
+    /// Only available if `sequence_traits<S>` defines `data()`, i.e. if the
+    /// elements of the sequence are stored contiguously.
+    // clang-format off
+    template <class Sequence = S
+        BOOST_STATIC_VIEWS_REQUIRES(
+            is_detected<sequence_data_t, Sequence>::value)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto data() const noexcept -> value_type*
+    // clang-format on
+    {
+        BOOST_STATIC_VIEWS_ASSUME(_xs != nullptr);
+        return sequence_traits<sequence_type>::data(*_xs);
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto begin() const noexcept
+    {
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::begin(*this);
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto end() const noexcept
+    {
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::end(*this);
+    }
 };
 
 /// \cond
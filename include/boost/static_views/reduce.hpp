@@ -0,0 +1,394 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/reduce.hpp
+///
+/// \brief Implementation of #reduce, #count_if, #min_element and
+/// #max_element.
+
+#ifndef BOOST_STATIC_VIEWS_REDUCE_HPP
+#define BOOST_STATIC_VIEWS_REDUCE_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "for_each.hpp"
+#include "lfold.hpp"
+#include "slice.hpp"
+#include "view_concept.hpp"
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// sum_contiguous adds elements straight into Acc, which only matches
+// std::plus<> and std::plus<Acc>. std::plus<T> with T != Acc would convert
+// every partial sum to T first.
+template <class Op, class Acc>
+struct is_std_plus : std::false_type {
+};
+
+template <class Acc>
+struct is_std_plus<std::plus<>, Acc> : std::true_type {
+};
+
+template <class Acc>
+struct is_std_plus<std::plus<Acc>, Acc> : std::true_type {
+};
+
+template <class Op, class T>
+struct is_std_less : std::false_type {
+};
+
+template <class T>
+struct is_std_less<std::less<>, T> : std::true_type {
+};
+
+template <class T>
+struct is_std_less<std::less<T>, T> : std::true_type {
+};
+
+template <class T>
+struct is_simd_arithmetic
+    : std::integral_constant<bool,
+          std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {
+};
+
+// The kernels below keep 64 or 128 bytes worth of independent accumulators,
+// i.e. two or four AVX registers. There are no loop-carried dependencies
+// between them, so compilers vectorise the inner loops and the additions
+// overlap in the pipeline. Plain loops rather than intrinsics keep them
+// portable and usable in constant expressions.
+template <class Acc, class T>
+BOOST_STATIC_VIEWS_CONSTEXPR auto sum_contiguous(
+    T const* const first, std::size_t const n, Acc const init) noexcept -> Acc
+{
+    constexpr std::size_t lanes      = 128 / sizeof(Acc);
+    auto const            blocks     = n - n % lanes;
+    Acc                   acc[lanes] = {};
+    std::size_t           i          = 0;
+    for (; i < blocks; i += lanes) {
+        for (std::size_t k = 0; k < lanes; ++k) {
+            acc[k] += first[i + k];
+        }
+    }
+    for (; i < n; ++i) {
+        acc[0] += first[i];
+    }
+    for (std::size_t width = lanes / 2; width > 0; width /= 2) {
+        for (std::size_t k = 0; k < width; ++k) {
+            acc[k] += acc[k + width];
+        }
+    }
+    return init + acc[0];
+}
+
+template <bool IsMax, class T>
+BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto select(
+    T const a, T const b) noexcept -> T
+{
+    return IsMax ? (a < b ? b : a) : (b < a ? b : a);
+}
+
+// Finds the extremum with a vectorised pass and then looks for its first
+// occurrence block by block.
+template <bool IsMax, class T>
+BOOST_STATIC_VIEWS_CONSTEXPR auto extremum_contiguous(
+    T const* const first, std::size_t const n) noexcept -> std::size_t
+{
+    constexpr std::size_t lanes  = 64 / sizeof(T);
+    auto const            blocks = n - n % lanes;
+    auto                  best   = first[0];
+    std::size_t           i      = 0;
+    if (blocks > 0) {
+        T acc[lanes] = {};
+        for (std::size_t k = 0; k < lanes; ++k) {
+            acc[k] = first[k];
+        }
+        for (i = lanes; i < blocks; i += lanes) {
+            for (std::size_t k = 0; k < lanes; ++k) {
+                acc[k] = select<IsMax>(acc[k], first[i + k]);
+            }
+        }
+        for (std::size_t k = 0; k < lanes; ++k) {
+            best = select<IsMax>(best, acc[k]);
+        }
+    }
+    for (; i < n; ++i) {
+        best = select<IsMax>(best, first[i]);
+    }
+
+    for (i = 0; i < blocks; i += lanes) {
+        auto found = false;
+        for (std::size_t k = 0; k < lanes; ++k) {
+            found |= first[i + k] == best;
+        }
+        if (found) break;
+    }
+    while (first[i] != best) {
+        ++i;
+    }
+    return i;
+}
+
+struct reduce_impl {
+  private:
+    template <class V, class Acc, class Op>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, typename V::index_type const b,
+        typename V::index_type const e, Acc init, Op& /*unused*/,
+        std::true_type /*simd*/, std::false_type /*tree*/) -> Acc
+    {
+        return sum_contiguous(
+            xs.data() + b, static_cast<std::size_t>(e - b), init);
+    }
+
+    // Four accumulators combined as ((a0 + a1) + (a2 + a3)), so that
+    // consecutive calls to op do not depend on each other. Views with their
+    // own loop, e.g. flatten, are better off folded with it than indexed,
+    // but that loop always covers the whole view.
+    template <class V, class Acc, class Op>
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, typename V::index_type const b,
+        typename V::index_type const e, Acc init, Op& op,
+        std::false_type /*simd*/, std::true_type /*tree*/) -> Acc
+    {
+        using index_type = typename V::index_type;
+        using native     = is_detected<has_for_each_while_t, V,
+            lfold_visitor<Acc, Op>>;
+        if (native::value && b == 0
+            && e == static_cast<index_type>(xs.size())) {
+            return ::BOOST_STATIC_VIEWS_NAMESPACE::lfold(
+                xs, std::move(init), op);
+        }
+        if (e - b < 4) {
+            for (auto i = b; i < e; ++i) {
+                init = invoke(op, std::move(init), xs.unsafe_at(i));
+            }
+            return init;
+        }
+        Acc a0 = invoke(op, std::move(init), xs.unsafe_at(b));
+        Acc a1(xs.unsafe_at(b + 1));
+        Acc a2(xs.unsafe_at(b + 2));
+        Acc a3(xs.unsafe_at(b + 3));
+        index_type i = b + 4;
+        // Stopping at a whole number of blocks from b keeps constants out of
+        // the loop condition, which GCC would otherwise move across it.
+        auto const last = e - (e - b) % 4;
+        for (; i < last; i += 4) {
+            a0 = invoke(op, std::move(a0), xs.unsafe_at(i));
+            a1 = invoke(op, std::move(a1), xs.unsafe_at(i + 1));
+            a2 = invoke(op, std::move(a2), xs.unsafe_at(i + 2));
+            a3 = invoke(op, std::move(a3), xs.unsafe_at(i + 3));
+        }
+        for (; i < e; ++i) {
+            a0 = invoke(op, std::move(a0), xs.unsafe_at(i));
+        }
+        return invoke(op, invoke(op, std::move(a0), std::move(a1)),
+            invoke(op, std::move(a2), std::move(a3)));
+    }
+
+    template <class V, class Acc, class Op>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, typename V::index_type const b,
+        typename V::index_type const e, Acc init, Op& op,
+        std::false_type /*simd*/, std::false_type /*tree*/) -> Acc
+    {
+        if (b == 0 && e == static_cast<typename V::index_type>(xs.size())) {
+            return ::BOOST_STATIC_VIEWS_NAMESPACE::lfold(
+                xs, std::move(init), op);
+        }
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::lfold(
+            slice(xs, b, e), std::move(init), op);
+    }
+
+  public:
+    // Reduces the elements of xs with indices in [b, e). Used by the
+    // parallel algorithms, which would otherwise pay for slice.
+    template <class V, class Acc, class Op>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto range(V const& xs, typename V::index_type const b,
+        typename V::index_type const e, Acc init, Op& op) -> Acc
+    {
+        using T = std::remove_cv_t<typename V::value_type>;
+        using simd = std::integral_constant<bool,
+            ContiguousView<V> && is_simd_arithmetic<T>::value
+                && is_simd_arithmetic<Acc>::value
+                && is_std_plus<remove_cvref_t<Op>, Acc>::value>;
+        using tree = std::integral_constant<bool,
+            !simd::value
+                && std::is_constructible<Acc,
+                       typename V::reference>::value>;
+        return call(xs, b, e, std::move(init), op, simd{}, tree{});
+    }
+
+    // clang-format off
+    template <class V, class Acc, class Op = std::plus<>
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, Acc init, Op&& op = Op{}) const -> Acc
+    // clang-format on
+    {
+        using index_type = typename remove_cvref_t<V>::index_type;
+        return range(xs, index_type{0}, static_cast<index_type>(xs.size()),
+            std::move(init), op);
+    }
+};
+
+template <class Pred, class Count>
+struct count_if_visitor {
+    Count& count;
+    Pred&  pred;
+
+    template <class T>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(T&& x) const -> bool
+    {
+        count += static_cast<Count>(
+            static_cast<bool>(invoke(pred, std::forward<T>(x))));
+        return true;
+    }
+};
+
+struct count_if_impl {
+    // clang-format off
+    template <class V, class Pred
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, Pred&& pred) const
+        -> typename remove_cvref_t<V>::size_type
+    // clang-format on
+    {
+        using size_type = typename remove_cvref_t<V>::size_type;
+        size_type count = 0;
+        ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(xs,
+            count_if_visitor<std::remove_reference_t<Pred>, size_type>{
+                count, pred});
+        return count;
+    }
+};
+
+template <bool IsMax>
+struct extremum_impl {
+  private:
+    template <class V, class Compare>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, Compare& /*unused*/, std::true_type /*simd*/)
+        -> typename V::index_type
+    {
+        using index_type = typename V::index_type;
+        return static_cast<index_type>(
+            extremum_contiguous<IsMax>(xs.data(), xs.size()));
+    }
+
+    template <class V, class Compare>
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static auto call(V const& xs, Compare& compare, std::false_type /*simd*/)
+        -> typename V::index_type
+    {
+        using index_type = typename V::index_type;
+        auto const size  = static_cast<index_type>(xs.size());
+        index_type best  = 0;
+        for (index_type i = 1; i < size; ++i) {
+            auto const better =
+                IsMax ? invoke(compare, xs.unsafe_at(best), xs.unsafe_at(i))
+                      : invoke(compare, xs.unsafe_at(i), xs.unsafe_at(best));
+            if (better) best = i;
+        }
+        return best;
+    }
+
+  public:
+    // clang-format off
+    template <class V, class Compare = std::less<>
+        BOOST_STATIC_VIEWS_REQUIRES(View<remove_cvref_t<V>>)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V const& xs, Compare&& compare = Compare{}) const
+        -> typename remove_cvref_t<V>::index_type
+    // clang-format on
+    {
+        using view_type  = remove_cvref_t<V>;
+        using index_type = typename view_type::index_type;
+        using T = std::remove_cv_t<typename view_type::value_type>;
+        // Floating point numbers are left out, since NaNs make the result
+        // depend on the order of comparisons.
+        using simd = std::integral_constant<bool,
+            ContiguousView<view_type> && std::is_integral<T>::value
+                && !std::is_same<T, bool>::value
+                && is_std_less<remove_cvref_t<Compare>, T>::value>;
+        if (xs.size() == 0) return 0;
+        return static_cast<index_type>(call(xs, compare, simd{}));
+    }
+};
+} // namespace detail
+
+/// \brief Reduces a view with an associative and commutative operation.
+
+/// `reduce(xs, init, op)` computes the same as #lfold, but may regroup and
+/// reorder the applications of `op`, which defaults to `std::plus<>`. This
+/// breaks the chain of dependencies between consecutive calls:
+///   * sums of contiguous views of arithmetic types, with `op` either
+///     `std::plus<>` or `std::plus<Acc>`, are computed with many
+///     independent accumulators, which compilers turn into SIMD code;
+///   * other views are reduced into four accumulators combined as a tree,
+///     which requires `Acc` to be constructible from the elements of `xs`.
+///
+/// Sums of floating point numbers may thus differ from #lfold in rounding.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto reduce = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::reduce_impl, reduce)
+#endif
+
+/// \brief Returns the number of elements `x` of a view for which `pred(x)`
+/// holds.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto count_if = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::count_if_impl, count_if)
+#endif
+
+/// \brief Returns the index of the first smallest element of a view.
+
+/// `min_element(xs, compare)` returns `0` if `xs` is empty. `compare`
+/// defaults to `std::less<>`. For contiguous views of integers compared
+/// with `std::less`, the minimum is found with a SIMD pass.
+///
+/// \code
+/// static constexpr int xs[] = {3, 1, 4, 1, 5};
+/// min_element(raw_view(xs)); // 1
+/// \endcode
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto min_element = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::extremum_impl<false>, min_element)
+#endif
+
+/// \brief Returns the index of the first largest element of a view.
+
+/// `max_element(xs, compare)` returns `0` if `xs` is empty. `compare`
+/// defaults to `std::less<>`. For contiguous views of integers compared
+/// with `std::less`, the maximum is found with a SIMD pass.
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto max_element = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::extremum_impl<true>, max_element)
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_REDUCE_HPP
@@ -77,6 +77,12 @@ BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
 ///   calling ``size`` with any sequence of type ``T`` will return the
 ///   same result.
 ///
+/// * Optionally, ``sequence_traits<T>::data(xs)`` returns a pointer to the
+///   first element of ``xs`` if the elements are stored contiguously. It
+///   should be ``static`` and ``noexcept``. A :cpp:var:`raw_view` of such a
+///   sequence then models ``ContiguousView`` and is iterated over with
+///   plain pointers.
+///
 /// Currently, only arrays (``T[N]`` and ``std::array<T, N>``) and
 /// homogeneous tuples (``std::tuple<Ts...>`` where :math:`\exists
 /// \text{U}: \forall \text{T} \in \{\text{Ts}\dots\}: \text{T} =
@@ -326,6 +332,8 @@ struct sequence_traits<T[N]>
     {
         return static_cast<std::ptrdiff_t>(N);
     }
+
+    static constexpr auto data(T (&xs)[N]) noexcept -> T* { return xs; }
 };
 
 /// \brief Specialisation of #sequence_traits for std::array.
@@ -344,10 +352,18 @@ struct sequence_traits<std::array<T, N>>
         "Wow! That's one long array! Please, submit a bug report "
         "here " BOOST_STATIC_VIEWS_ISSUES_LINK);
 
+    // std::array<T, N>::data() is not constexpr until C++17, but the const
+    // operator[] is.
     template <class S>
     static constexpr decltype(auto) at(S& xs, index_type const i) noexcept
     {
-        return xs.data()[i];
+        return xs[static_cast<std::size_t>(i)];
+    }
+
+    template <class S>
+    static constexpr auto data(S& xs) noexcept
+    {
+        return N == 0 ? nullptr : &xs[0];
     }
 
     static constexpr auto extent() noexcept
@@ -360,21 +376,21 @@ template <class T, std::size_t N>
 struct sequence_traits<std::array<T, N> const>
     : sequence_traits<std::array<T, N>> {
     using value_type      = std::add_const_t<T>;
-    using reference       = std::add_lvalue_reference_t<T>;
+    using reference       = std::add_lvalue_reference_t<value_type>;
 };
 
 template <class T, std::size_t N>
 struct sequence_traits<std::array<T, N> volatile>
     : sequence_traits<std::array<T, N>> {
     using value_type      = std::add_volatile_t<T>;
-    using reference       = std::add_lvalue_reference_t<T>;
+    using reference       = std::add_lvalue_reference_t<value_type>;
 };
 
 template <class T, std::size_t N>
 struct sequence_traits<std::array<T, N> const volatile>
     : sequence_traits<std::array<T, N>> {
     using value_type      = std::add_volatile_t<std::add_const_t<T>>;
-    using reference       = std::add_lvalue_reference_t<T>;
+    using reference       = std::add_lvalue_reference_t<value_type>;
 };
 
 namespace detail {
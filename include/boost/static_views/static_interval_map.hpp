@@ -0,0 +1,213 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/static_interval_map.hpp
+///
+/// \brief Implementation of #static_interval_map.
+
+#ifndef BOOST_STATIC_VIEWS_STATIC_INTERVAL_MAP_HPP
+#define BOOST_STATIC_VIEWS_STATIC_INTERVAL_MAP_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "static_map.hpp"
+#include "view_concept.hpp"
+#include <cstddef>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+/// \brief Thrown when the intervals passed to #make_static_interval_map
+/// are empty, overlap, or are not sorted.
+struct invalid_intervals_error : public virtual std::exception {
+    auto what() const noexcept -> char const* override { return _msg; }
+
+  private:
+    static constexpr char const* _msg =
+        "Intervals must be non-empty, sorted and must not overlap.";
+};
+constexpr char const* invalid_intervals_error::_msg;
+
+/// \brief Maps closed intervals `[lo, hi]` of keys to elements of a view.
+
+/// The lower bounds are copied into a contiguous array, so a query touches
+/// only `log2(size())` cache lines of keys plus the one element it returns,
+/// however large the elements are. The search is branchless: every step
+/// halves the range with a conditional move rather than a branch, so there
+/// are no mispredictions.
+///
+/// Intervals are closed, so a range may end at the largest value of the
+/// key type, e.g. `255.255.255.255`.
+///
+/// The extent of the view bounds the number of lower bounds which are
+/// stored; its size, e.g. of a #drop_exactly view, may be smaller.
+template <class Intervals, class GetLo, class GetHi, class GetMapped>
+class static_interval_map {
+    static_assert(Intervals::extent() != dynamic_extent,
+        "boost::static_views::static_interval_map requires the size of the "
+        "view to be known at compile-time.");
+
+    // Capacity of _lows. Arrays can't be empty, hence at least one.
+    static constexpr auto _capacity =
+        Intervals::extent() > 0 ? static_cast<std::size_t>(Intervals::extent())
+                                : std::size_t{1};
+
+  public:
+    using reference  = typename Intervals::reference;
+    using value_type = std::remove_reference_t<reference>;
+    using key_type   = std::remove_cv_t<std::remove_reference_t<
+        detail::invoke_t<GetLo const&, reference>>>;
+    using mapped_type = std::remove_cv_t<std::remove_reference_t<
+        detail::invoke_t<GetMapped const&, reference>>>;
+    using size_type = std::size_t;
+
+  private:
+    using index_type = typename Intervals::index_type;
+
+    Intervals                           _xs;
+    std::tuple<GetLo, GetHi, GetMapped> _getters;
+    size_type                           _size;
+    key_type                            _lows[_capacity];
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto element(std::size_t const i) const noexcept -> value_type&
+    {
+        return _xs.unsafe_at(static_cast<index_type>(i));
+    }
+
+  public:
+    /// \throws invalid_intervals_error if some interval is empty, or if the
+    /// intervals are not sorted or overlap. In a constant expression, this
+    /// is a compile error.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static_interval_map(
+        Intervals xs, GetLo get_lo, GetHi get_hi, GetMapped get_mapped)
+        : _xs{std::move(xs)}
+        , _getters{std::move(get_lo), std::move(get_hi), std::move(get_mapped)}
+        , _size{static_cast<size_type>(_xs.size())}
+        , _lows{}
+    {
+        for (std::size_t i = 0; i < _size; ++i) {
+            auto const& x = element(i);
+            _lows[i]      = invoke(lo_fn(), x);
+            if (invoke(hi_fn(), x) < _lows[i]) {
+                throw invalid_intervals_error{};
+            }
+            if (i > 0 && !(invoke(hi_fn(), element(i - 1)) < _lows[i])) {
+                throw invalid_intervals_error{};
+            }
+        }
+    }
+
+    /// \brief Returns the number of intervals.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto size() const noexcept -> size_type { return _size; }
+
+    /// \brief Returns a pointer to the element whose interval contains \p x,
+    /// or `nullptr` if there is no such element.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto find(key_type const& x) const noexcept -> value_type*
+    {
+        if (_size == 0) return nullptr;
+        // Finds the last interval with lo <= x.
+        std::size_t base = 0;
+        for (std::size_t n = _size; n > 1; n -= n / 2) {
+            auto const half = n / 2;
+            base = (x < _lows[base + half]) ? base : base + half;
+        }
+        if (x < _lows[base]) return nullptr;
+        auto& candidate = element(base);
+        return invoke(hi_fn(), candidate) < x ? nullptr : &candidate;
+    }
+
+    /// \brief Returns the number of intervals containing \p x, i.e. zero or
+    /// one.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto count(key_type const& x) const noexcept -> size_type
+    {
+        return find(x) == nullptr ? 0 : 1;
+    }
+
+    /// \brief Returns the mapped value of the interval containing \p x.
+
+    /// \throws key_not_found_error if no interval contains \p x.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    decltype(auto) at(key_type const& x) const
+    {
+        auto* const element = find(x);
+        if (element == nullptr) { throw key_not_found_error{}; }
+        return invoke(mapped_fn(), *element);
+    }
+
+    /// \brief Returns the function used to extract lower bounds.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& lo_fn() const noexcept { return std::get<0>(_getters); }
+
+    /// \brief Returns the function used to extract upper bounds.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& hi_fn() const noexcept { return std::get<1>(_getters); }
+
+    /// \brief Returns the function used to extract mapped values.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& mapped_fn() const noexcept { return std::get<2>(_getters); }
+};
+
+namespace detail {
+struct make_static_interval_map_impl {
+    // clang-format off
+    template <class V, class GetLo, class GetHi, class GetMapped
+        BOOST_STATIC_VIEWS_REQUIRES(
+            View<std::remove_cv_t<std::remove_reference_t<V>>>)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V&& xs, GetLo get_lo, GetHi get_hi,
+        GetMapped get_mapped) const
+    // clang-format on
+    {
+        using view_type = std::remove_cv_t<std::remove_reference_t<V>>;
+        return static_interval_map<view_type, GetLo, GetHi, GetMapped>{
+            std::forward<V>(xs), std::move(get_lo), std::move(get_hi),
+            std::move(get_mapped)};
+    }
+};
+} // namespace detail
+
+/// \brief Creates a #static_interval_map.
+
+/// `make_static_interval_map(xs, get_lo, get_hi, get_mapped)` maps every
+/// key in `[invoke(get_lo, x), invoke(get_hi, x)]` to the element `x` of
+/// `xs`. Elements must be sorted by their intervals, which must not
+/// overlap.
+///
+/// \code
+/// struct network {
+///     std::uint32_t first;
+///     std::uint32_t last;
+///     char const*   name;
+/// };
+/// static constexpr network networks[] = {
+///     {0x0A000000, 0x0AFFFFFF, "10.0.0.0/8"},
+///     {0xAC100000, 0xAC1FFFFF, "172.16.0.0/12"},
+///     {0xC0A80000, 0xC0A8FFFF, "192.168.0.0/16"}};
+/// static constexpr auto private_networks = make_static_interval_map(
+///     raw_view(networks), &network::first, &network::last, &network::name);
+/// private_networks.at(0xC0A80101); // "192.168.0.0/16"
+/// \endcode
+#if defined(DOXYGEN_IN_HOUSE)
+constexpr auto make_static_interval_map = implementation detail;
+#else
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(
+    detail::make_static_interval_map_impl, make_static_interval_map)
+#endif
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_STATIC_INTERVAL_MAP_HPP
@@ -7,11 +7,16 @@
 #define BOOST_STATIC_VIEWS_STATIC_MAP_HPP
 
 #include <exception>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "detail/compose.hpp"
 #include "hash_c.hpp"
 #include "hashed.hpp"
+#include "linear_scan.hpp"
+#include "lookup_counters.hpp"
+#include "packed_hashed.hpp"
 
 BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
 
@@ -124,12 +129,46 @@ auto make_map_config(Pred&& p, GetKey&& k, GetMapped&& m)
 );
 // clang-format on
 
-template <class HashedView, class MapConfig>
+// Views such as linear_scan_view_impl don't look at the hash at all, so
+// static_map can skip computing it.
+template <class View>
+using ignores_hash_t = typename View::ignores_hash;
+
+template <class View>
+using lookup_ignores_hash = is_detected<ignores_hash_t, View>;
+
+// Keys returned by key getters may be tuples (or pairs) of references, e.g.
+// the ones built by composite_key. Lookups take the corresponding tuples of
+// values instead, so that a braced list like `find({1, 2})` does not bind the
+// references to temporaries which die before the lookup.
+template <class Key>
+struct lookup_key {
+    using type = Key;
+};
+
+template <class... Ts>
+struct lookup_key<std::tuple<Ts...>> {
+    using type = std::tuple<std::decay_t<Ts>...>;
+};
+
+template <class T1, class T2>
+struct lookup_key<std::pair<T1, T2>> {
+    using type = std::pair<std::decay_t<T1>, std::decay_t<T2>>;
+};
+
+template <class Key>
+using lookup_key_t = typename lookup_key<Key>::type;
+
+/// \tparam Instrumentation Policy which is notified about every lookup and
+/// every invocation of `key_equal`. See #no_lookup_counters and
+/// #lookup_counters.
+template <class HashedView, class MapConfig,
+    class Instrumentation = no_lookup_counters>
 class static_map
     : private HashedView
     , private MapConfig {
 
-    using type = static_map<HashedView, MapConfig>;
+    using type = static_map<HashedView, MapConfig, Instrumentation>;
 
   public:
     using bucket_type   = typename HashedView::value_type;
@@ -143,8 +182,8 @@ class static_map
         "`key_getter` in boost::static_views::static_map must be invocable "
         "with `reference`.");
 
-    using key_type = std::remove_reference_t<decltype(
-        invoke(std::declval<key_getter const&>(), std::declval<reference>()))>;
+    using key_type = lookup_key_t<std::remove_reference_t<decltype(
+        invoke(std::declval<key_getter const&>(), std::declval<reference>()))>>;
 
     static_assert(is_invocable<key_getter, reference>::value,
         "`mapped_getter` in boost::static_views::static_map must be "
@@ -158,9 +197,16 @@ class static_map
         "with two `key_type&` and, when invoked, return something "
         "convertible to `bool`..");
 
+    /// \brief Type returned by #find: a plain pointer if elements of the
+    /// view are lvalues and a #detail::element_pointer otherwise (e.g. for
+    /// #zip).
+    using pointer = element_pointer_t<
+        remove_cvref_t<decltype(std::declval<HashedView const&>().parent())>>;
+
     using typename HashedView::size_type;
-    using key_hasher = typename HashedView::hasher_type::first_fn;
+    using key_hasher = typename HashedView::hasher_type::second_fn;
     using index_type = key_type;
+    using instrumentation_type = Instrumentation;
 
   private:
     using view_type   = HashedView;
@@ -176,13 +222,12 @@ class static_map
 
     BOOST_STATIC_VIEWS_FORCEINLINE
     BOOST_STATIC_VIEWS_CONSTEXPR
-    auto* _lookup(key_type const& k) const BOOST_STATIC_VIEWS_NOEXCEPT_IF(
-        noexcept(invoke(std::declval<key_equal const&>(),
-            std::declval<key_type const&>(),
-            invoke(
-                std::declval<key_getter const&>(), std::declval<reference>())))
-        && noexcept(
-               invoke(std::declval<static_map const&>()._hash_function(), k)))
+    auto _lookup(key_type const& k, std::size_t const hash) const
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(noexcept(
+            invoke(std::declval<key_equal const&>(),
+                std::declval<key_type const&>(),
+                invoke(std::declval<key_getter const&>(),
+                    std::declval<reference>()))))
     {
         struct pred_equal {
             key_getter const& get_key;
@@ -191,24 +236,50 @@ class static_map
 
             BOOST_STATIC_VIEWS_FORCEINLINE
             BOOST_STATIC_VIEWS_CONSTEXPR
-            auto operator()(value_type const& y) BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+            auto operator()(reference y) BOOST_STATIC_VIEWS_NOEXCEPT_IF(
                 noexcept(invoke(std::declval<key_equal const&>(),
                     std::declval<key_type const&>(),
-                    invoke(std::declval<key_getter const&>(), y)))) -> bool
+                    invoke(std::declval<key_getter const&>(),
+                        std::declval<reference>())))) -> bool
             {
+                Instrumentation::on_key_equal();
                 return invoke(equal, key, invoke(get_key, y));
             }
         };
 
-        auto const hash =
-            view_type::bucket_size()
-            // TODO: For optimal performance, I need a way to mark a hash
-            // function "trustworthy". Such functions are then assumed to never
-            // return values larger that bucker_count() which would avoid a
-            // costly `mod` operation.
-            * (invoke(_hash_function(), k) % view_type::bucket_count());
-        return static_cast<HashedView const&>(*this).lookup(
+        auto const x = static_cast<HashedView const&>(*this).lookup(
             hash, pred_equal{this->key(), this->equal(), k});
+        Instrumentation::on_lookup(x != nullptr);
+        return x;
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto _lookup(key_type const& k) const BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+        noexcept(std::declval<static_map const&>()._lookup(k, std::size_t{}))
+        && noexcept(std::declval<static_map const&>()._hash_for_lookup(
+               k, lookup_ignores_hash<HashedView>{})))
+    {
+        return _lookup(
+            k, _hash_for_lookup(k, lookup_ignores_hash<HashedView>{}));
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto _hash_for_lookup(key_type const& k, std::false_type) const
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(noexcept(
+            invoke(std::declval<static_map const&>()._hash_function(), k)))
+        -> std::size_t
+    {
+        return static_cast<std::size_t>(invoke(_hash_function(), k));
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto _hash_for_lookup(key_type const& /*unused*/, std::true_type) const
+        noexcept -> std::size_t
+    {
+        return 0;
     }
 
   public:
@@ -235,11 +306,35 @@ class static_map
     BOOST_STATIC_VIEWS_FORCEINLINE
     BOOST_STATIC_VIEWS_CONSTEXPR
     auto find(key_type const& k) const BOOST_STATIC_VIEWS_NOEXCEPT_IF(
-        noexcept(std::declval<static_map const&>()._lookup(k))) -> value_type*
+        noexcept(std::declval<static_map const&>()._lookup(k))) -> pointer
     {
         return _lookup(k);
     }
 
+    /// \brief Like #find, but uses \p hash instead of hashing \p k.
+
+    /// \p hash must be equal to `hash_of(k)`. This allows to hash a key
+    /// only once when looking it up in several maps which use the same
+    /// hash function (see #find_all).
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto find_hashed(key_type const& k, std::size_t const hash) const
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(noexcept(
+            std::declval<static_map const&>()._lookup(k, hash))) -> pointer
+    {
+        return _lookup(k, hash);
+    }
+
+    /// \brief Returns the hash of \p k as computed by the map.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto hash_of(key_type const& k) const BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+        noexcept(invoke(std::declval<static_map const&>()._hash_function(), k)))
+        -> std::size_t
+    {
+        return static_cast<std::size_t>(invoke(_hash_function(), k));
+    }
+
     BOOST_STATIC_VIEWS_FORCEINLINE
     BOOST_STATIC_VIEWS_CONSTEXPR
     auto count(key_type const& k) const -> size_type
@@ -251,7 +346,7 @@ class static_map
     BOOST_STATIC_VIEWS_CONSTEXPR
     decltype(auto) at(key_type const& k) const
     {
-        auto* x = _lookup(k);
+        auto const x = _lookup(k);
         if (x == nullptr) { throw key_not_found_error{}; }
         return invoke(this->mapped(), *x);
     }
@@ -260,24 +355,185 @@ class static_map
     BOOST_STATIC_VIEWS_CONSTEXPR
     decltype(auto) operator[](key_type const& k) const { return at(k); }
 
+    /// \brief Returns the function used to hash keys.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& key_hasher_fn() const noexcept { return _hash_function(); }
+
+    /// \brief Returns the function used to compare keys for equality.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& key_equal_fn() const noexcept { return this->equal(); }
+
+    /// \brief Returns the function used to extract keys from elements.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& key_fn() const noexcept { return this->key(); }
+
+    /// \brief Returns the function used to extract mapped values from
+    /// elements.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& mapped_fn() const noexcept { return this->mapped(); }
+
     using view_type::begin;
     using view_type::bucket_count;
     using view_type::bucket_size;
     using view_type::end;
+    using view_type::statistics;
+};
+
+// Compares two elements of the underlying view by their keys. It is used to
+// remove duplicates when building the map: `key_equal` takes keys rather than
+// whole elements.
+template <class KeyEqual, class GetKey>
+struct equal_keys {
+    KeyEqual const& equal;
+    GetKey const&   get_key;
+
+    template <class T>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto operator()(T const& x, T const& y) const
+        BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN(
+            invoke(equal, invoke(get_key, x), invoke(get_key, y)));
+};
+
+template <class KeyEqual, class GetKey>
+BOOST_STATIC_VIEWS_CONSTEXPR auto make_equal_keys(
+    KeyEqual const& equal, GetKey const& get_key) noexcept
+    -> equal_keys<KeyEqual, GetKey>
+{
+    return {equal, get_key};
+}
+
+template <class... Ts>
+struct all_same : std::true_type {
+};
+
+template <class T, class... Ts>
+struct all_same<T, Ts...>
+    : std::integral_constant<bool,
+          std::is_same<std::tuple<T, Ts...>, std::tuple<Ts..., T>>::value> {
 };
 
 } // namespace detail
 
-template <std::size_t BucketCount = 0, std::size_t BucketSize = 0>
+/// \brief Looks up \p k in each of \p maps, hashing it only once.
+
+/// Returns a `std::tuple` of `pointer`s, the `i`'th being
+/// `std::get<i>(maps).find(k)`. All maps must use the same hash function
+/// (i.e. have the same `key_hasher` type, and stateful hashers must compare
+/// equal), because the hash is computed by the first map.
+// clang-format off
+template <class Map, class... Maps>
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto find_all(typename Map::key_type const& k, Map const& map,
+    Maps const&... maps)
+// clang-format on
+{
+    static_assert(detail::all_same<typename Map::key_hasher,
+                      typename Maps::key_hasher...>::value,
+        "boost::static_views::find_all requires all maps to use the same "
+        "hash function.");
+    auto const hash = map.hash_of(k);
+    return std::tuple<typename Map::pointer, typename Maps::pointer...>{
+        map.find_hashed(k, hash), maps.find_hashed(k, hash)...};
+}
+
+namespace detail {
+// Deliberately not constexpr: calling it during constant evaluation makes the
+// build fail, and the name of the function shows up in the diagnostic.
+inline auto static_at_key_not_found() -> void {}
+
+template <class Map, class Key>
+BOOST_STATIC_VIEWS_CONSTEXPR auto static_at_impl(Map const& map, Key const& k)
+{
+    auto const x = map.find(k);
+    if (x == nullptr) static_at_key_not_found();
+    return invoke(map.mapped_fn(), *x);
+}
+} // namespace detail
+
+/// \brief Looks up \p key in \p map at compile-time.
+
+/// Expands to a prvalue copy of the value corresponding to \p key. The
+/// lookup is guaranteed to be evaluated by the compiler, i.e. the result is
+/// a constant and no code is generated for the lookup itself. If \p key is
+/// not in the map, compilation fails with an error mentioning
+/// `static_at_key_not_found`.
+///
+/// \p map must be a `constexpr` object with static storage duration and
+/// `mapped_type` must be a literal type. Since C++17 (constexpr lambdas),
+/// the expansion is itself a constant expression.
+#define BOOST_STATIC_VIEWS_STATIC_AT(map, key)                               \
+    ([]() noexcept {                                                         \
+        constexpr auto _boost_static_views_value =                           \
+            ::BOOST_STATIC_VIEWS_NAMESPACE::detail::static_at_impl(          \
+                map, key);                                                   \
+        return _boost_static_views_value;                                    \
+    }())
+
+#if defined(__cpp_nontype_template_parameter_auto)
+/// \brief Returns the value corresponding to \p Key in \p Map, computed at
+/// compile-time.
+
+/// Same as #BOOST_STATIC_VIEWS_STATIC_AT, but with the key passed as a
+/// template argument. Requires C++17.
+template <auto const& Map, auto Key>
+BOOST_STATIC_VIEWS_FORCEINLINE constexpr auto static_at() noexcept
+{
+    constexpr auto value = detail::static_at_impl(Map, Key);
+    return value;
+}
+#endif
+
+namespace detail {
+// Maximal number of elements for which make_static_map_impl<> picks a
+// linear scan over hashing. Comparing integers is cheap, so more of them can
+// be scanned in the time it takes to hash a key and probe a bucket.
+template <class Key>
+struct linear_scan_threshold
+    : std::integral_constant<std::ptrdiff_t,
+          (std::is_arithmetic<Key>::value || std::is_enum<Key>::value) ? 16
+                                                                       : 8> {
+};
+} // namespace detail
+
+/// \brief Creates a #static_map.
+
+/// If neither \p BucketCount nor \p BucketSize is specified and the view
+/// is tiny (at most 16 elements for arithmetic and enum keys and at most 8
+/// otherwise), the map uses #linear_scan rather than #hashed. Specifying
+/// either parameter forces a hashed map, and #make_linear_static_map_impl
+/// forces a linear one.
+template <std::size_t BucketCount = 0, std::size_t BucketSize = 0,
+    class Instrumentation = no_lookup_counters>
 struct make_static_map_impl {
   private:
     template <class HashedView, class MapConfig>
     BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
         HashedView view, MapConfig config) const
         BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
-            detail::static_map<HashedView, MapConfig>{
+            detail::static_map<HashedView, MapConfig, Instrumentation>{
                 std::move(view), std::move(config)});
 
+    template <class View, class Hasher, class Equal>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto make_view(std::false_type /*linear*/,
+        View&& xs, Hasher&& hasher, Equal&& equal) const
+    {
+        using view_type = std::remove_cv_t<std::remove_reference_t<View>>;
+        constexpr auto bucket_count =
+            (BucketCount == 0) ? 2 * view_type::extent() : BucketCount;
+        constexpr auto bucket_size = (BucketSize == 0) ? 2 : BucketSize;
+        return hashed<bucket_count, bucket_size>(std::forward<View>(xs),
+            std::forward<Hasher>(hasher), std::forward<Equal>(equal));
+    }
+
+    // A linear scan finds the first of several equal keys, so there is no
+    // need to remove duplicates.
+    template <class View, class Hasher, class Equal>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto make_view(std::true_type /*linear*/,
+        View&& xs, Hasher&& hasher, Equal&& /*unused*/) const
+    {
+        return linear_scan(std::forward<View>(xs), std::forward<Hasher>(hasher));
+    }
+
   public:
     // clang-format off
     template <class View, class GetKey, class GetMapped,
@@ -288,20 +544,122 @@ struct make_static_map_impl {
     // clang-format on
     {
         using view_type = std::remove_cv_t<std::remove_reference_t<View>>;
-        static_assert(view_type::extent() != dynamic_extent,
+        static_assert(
+            BucketCount != 0 || view_type::extent() != dynamic_extent,
             "For views of unknown size you need to manually specify a non-zero "
             "BucketCount.");
 
+        static_assert(std::is_copy_constructible<GetKey>::value,
+            "Current implemetation of boost::static_views::static_map requires "
+            "GetKey to be copy constructible. If you absolutely cannot live "
+            "with this, please submit a bug report.");
+        using key_type = std::remove_cv_t<std::remove_reference_t<decltype(
+            invoke(std::declval<GetKey const&>(),
+                std::declval<typename view_type::reference>()))>>;
+        // If neither BucketCount nor BucketSize is given, tiny maps use a
+        // linear scan.
+        using use_linear_scan = std::integral_constant<bool,
+            BucketCount == 0 && BucketSize == 0
+                && view_type::extent() != dynamic_extent
+                && view_type::extent()
+                       <= detail::linear_scan_threshold<key_type>::value>;
+
+        auto view = make_view(use_linear_scan{}, std::forward<View>(xs),
+            compose(std::forward<Hasher>(hasher), GetKey{get_key}),
+            detail::make_equal_keys(key_equal, get_key));
+        auto conf = detail::make_map_config(std::forward<KeyEqual>(key_equal),
+            std::move(get_key), std::forward<GetMapped>(get_mapped));
+
+        return call_impl(std::move(view), std::move(conf));
+    }
+};
+
+/// \brief Like #make_static_map_impl, but uses #packed_hashed rather than
+/// #hashed as the underlying view.
+
+/// Buckets have no fixed capacity, so building the map never fails with
+/// #full_bucket, and memory usage does not depend on the distribution
+/// of hashes. By default, there are as many buckets as there are elements.
+template <std::size_t BucketCount = 0,
+    class Instrumentation = no_lookup_counters>
+struct make_packed_static_map_impl {
+  private:
+    template <class HashedView, class MapConfig>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        HashedView view, MapConfig config) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            detail::static_map<HashedView, MapConfig, Instrumentation>{
+                std::move(view), std::move(config)});
+
+  public:
+    // clang-format off
+    template <class View, class GetKey, class GetMapped,
+        class KeyEqual = std::equal_to<void>, class Hasher = hash_c>
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(View&& xs, GetKey get_key, GetMapped&& get_mapped,
+        KeyEqual&& key_equal = KeyEqual{}, Hasher&& hasher = Hasher{})
+    // clang-format on
+    {
+        using view_type = std::remove_cv_t<std::remove_reference_t<View>>;
+        static_assert(view_type::extent() != dynamic_extent,
+            "boost::static_views::make_packed_static_map requires the size of "
+            "the view to be known at compile-time.");
+
         constexpr auto bucket_count =
-            (BucketCount == 0) ? 2 * view_type::extent() : BucketCount;
-        constexpr auto bucket_size = (BucketSize == 0) ? 2 : BucketSize;
+            (BucketCount != 0)
+                ? BucketCount
+                : (view_type::extent() > 0
+                          ? static_cast<std::size_t>(view_type::extent())
+                          : 1u);
+
+        static_assert(std::is_copy_constructible<GetKey>::value,
+            "Current implemetation of boost::static_views::static_map requires "
+            "GetKey to be copy constructible. If you absolutely cannot live "
+            "with this, please submit a bug report.");
+        auto view = packed_hashed<bucket_count>(std::forward<View>(xs),
+            compose(std::forward<Hasher>(hasher), GetKey{get_key}),
+            detail::make_equal_keys(key_equal, get_key));
+        auto conf = detail::make_map_config(std::forward<KeyEqual>(key_equal),
+            std::move(get_key), std::forward<GetMapped>(get_mapped));
+
+        return call_impl(std::move(view), std::move(conf));
+    }
+};
+
+/// \brief Like #make_static_map_impl, but always uses #linear_scan as the
+/// underlying view.
 
+/// Lookups compare the key against every element in order, so the first of
+/// several equal keys wins, just like for hashed maps.
+template <class Instrumentation = no_lookup_counters>
+struct make_linear_static_map_impl {
+  private:
+    template <class HashedView, class MapConfig>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        HashedView view, MapConfig config) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            detail::static_map<HashedView, MapConfig, Instrumentation>{
+                std::move(view), std::move(config)});
+
+  public:
+    // clang-format off
+    template <class View, class GetKey, class GetMapped,
+        class KeyEqual = std::equal_to<void>, class Hasher = hash_c>
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(View&& xs, GetKey get_key, GetMapped&& get_mapped,
+        KeyEqual&& key_equal = KeyEqual{}, Hasher&& hasher = Hasher{})
+    // clang-format on
+    {
+        using view_type = std::remove_cv_t<std::remove_reference_t<View>>;
+        static_assert(view_type::extent() != dynamic_extent,
+            "boost::static_views::make_linear_static_map requires the size of "
+            "the view to be known at compile-time.");
         static_assert(std::is_copy_constructible<GetKey>::value,
             "Current implemetation of boost::static_views::static_map requires "
             "GetKey to be copy constructible. If you absolutely cannot live "
             "with this, please submit a bug report.");
-        auto view = hashed<bucket_count, bucket_size>(std::forward<View>(xs),
-            compose(std::forward<Hasher>(hasher), GetKey{get_key}), key_equal);
+        auto view = linear_scan(std::forward<View>(xs),
+            compose(std::forward<Hasher>(hasher), GetKey{get_key}));
         auto conf = detail::make_map_config(std::forward<KeyEqual>(key_equal),
             std::move(get_key), std::forward<GetMapped>(get_mapped));
 
@@ -0,0 +1,286 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/static_trie.hpp
+///
+/// \brief Implementation of #static_trie.
+
+#ifndef BOOST_STATIC_VIEWS_STATIC_TRIE_HPP
+#define BOOST_STATIC_VIEWS_STATIC_TRIE_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/invoke.hpp"
+#include "errors.hpp"
+#include "string_pool.hpp"
+#include "view_concept.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+// Lexicographic comparison of unsigned characters, with a proper prefix
+// comparing less.
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto string_less(pooled_string const a, pooled_string const b) noexcept
+    -> bool
+{
+    for (std::size_t i = 0; i < a.size() && i < b.size(); ++i) {
+        auto const x = static_cast<unsigned char>(a[i]);
+        auto const y = static_cast<unsigned char>(b[i]);
+        if (x != y) return x < y;
+    }
+    return a.size() < b.size();
+}
+} // namespace detail
+
+/// \brief A compact trie of the keys of a view, built at compile-time.
+
+/// Nodes are stored in breadth-first order, so the children of a node are
+/// consecutive, and the labels of the edges leaving a node are a contiguous
+/// run of bytes. The `i`'th edge always leads to node `i + 1`, so a node
+/// costs one byte of label, four bytes of offset into the labels, and four
+/// bytes of element index. At runtime, the labels of nodes with several
+/// children are searched 16 at a time with SSE2.
+///
+/// `NodeCount` is the capacity. A trie of `n` keys of total length `m` has
+/// at most `m + 1` nodes, and #node_count() tells how many are used.
+template <class KeyView, class GetKey, std::size_t NodeCount>
+class static_trie {
+    static_assert(NodeCount > 0 && NodeCount < UINT32_MAX,
+        "boost::static_views::static_trie needs at least one node for the "
+        "root.");
+    static_assert(KeyView::extent() != dynamic_extent,
+        "boost::static_views::static_trie requires the size of the view to be "
+        "known at compile-time.");
+
+    static constexpr std::uint32_t npos = UINT32_MAX;
+
+    KeyView _xs;
+    GetKey  _get_key;
+    // Padded so that 16-byte loads starting at any label stay in bounds.
+    char          _labels[NodeCount + 15];
+    std::uint32_t _first[NodeCount + 1];
+    std::uint32_t _values[NodeCount];
+    std::uint32_t _node_count;
+
+    using index_type = typename KeyView::index_type;
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto key_at(std::size_t const i) const noexcept -> pooled_string
+    {
+        return pooled_string{
+            invoke(_get_key, _xs.unsafe_at(static_cast<index_type>(i)))};
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto build() -> void
+    {
+        // The extent bounds the number of keys, e.g. of a drop_exactly view,
+        // which may hold fewer at run-time.
+        constexpr auto capacity = static_cast<std::size_t>(KeyView::extent());
+        auto const     size     = static_cast<std::size_t>(_xs.size());
+        // Element indices sorted by key. Insertion sort is stable, so of
+        // several equal keys the first one ends up in the trie.
+        std::size_t order[capacity == 0 ? 1 : capacity] = {};
+        for (std::size_t i = 0; i < size; ++i) {
+            auto       j   = i;
+            auto const key = key_at(i);
+            while (j > 0 && detail::string_less(key, key_at(order[j - 1]))) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = i;
+        }
+
+        // Every node owns the range [lo, hi) of sorted keys which start with
+        // the node's prefix of length depth.
+        std::size_t lo[NodeCount]    = {};
+        std::size_t hi[NodeCount]    = {};
+        std::size_t depth[NodeCount] = {};
+        hi[0]                        = size;
+        _node_count                  = 1;
+        for (std::size_t node = 0; node < _node_count; ++node) {
+            auto const d  = depth[node];
+            auto       i  = lo[node];
+            _first[node]  = _node_count - 1;
+            _values[node] = npos;
+            // Keys ending at this node sort first.
+            if (i < hi[node] && key_at(order[i]).size() == d) {
+                _values[node] = static_cast<std::uint32_t>(order[i]);
+            }
+            while (i < hi[node] && key_at(order[i]).size() == d) {
+                ++i;
+            }
+            while (i < hi[node]) {
+                auto const c = key_at(order[i])[d];
+                auto       j = i + 1;
+                while (j < hi[node] && key_at(order[j])[d] == c) {
+                    ++j;
+                }
+                if (_node_count == NodeCount) {
+                    make_out_of_bound_error(
+                        "boost::static_views::static_trie: NodeCount is too "
+                        "small.");
+                }
+                _labels[_node_count - 1] = c;
+                lo[_node_count]          = i;
+                hi[_node_count]          = j;
+                depth[_node_count]       = d + 1;
+                ++_node_count;
+                i = j;
+            }
+        }
+        _first[_node_count] = _node_count - 1;
+    }
+
+    // Returns the index of the edge leaving node labeled c, or npos.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto find_edge(std::uint32_t const node, char const c) const noexcept
+        -> std::uint32_t
+    {
+        auto const first = _first[node];
+        auto const count = _first[node + 1] - first;
+        // Most nodes of a trie of paths or keywords have a single child.
+        if (count == 1) return _labels[first] == c ? first : npos;
+#if defined(__SSE2__)
+        if (!BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED()) {
+            auto const needle = _mm_set1_epi8(c);
+            for (std::uint32_t i = 0; i < count; i += 16) {
+                auto const labels = _mm_loadu_si128(
+                    reinterpret_cast<__m128i const*>(_labels + first + i));
+                auto mask = static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(labels, needle)));
+                if (count - i < 16) {
+                    mask &= (1u << (count - i)) - 1u;
+                }
+                if (mask != 0) {
+                    return first + i
+                           + static_cast<std::uint32_t>(__builtin_ctz(mask));
+                }
+            }
+            return npos;
+        }
+#endif
+        for (std::uint32_t i = first; i < first + count; ++i) {
+            if (_labels[i] == c) return i;
+        }
+        return npos;
+    }
+
+  public:
+    using value_type = std::remove_reference_t<typename KeyView::reference>;
+    using size_type  = std::size_t;
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    static_trie(KeyView xs, GetKey get_key)
+        : _xs{std::move(xs)}
+        , _get_key{std::move(get_key)}
+        , _labels{}
+        , _first{}
+        , _values{}
+        , _node_count{0}
+    {
+        build();
+    }
+
+    /// \brief Returns the number of keys.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto size() const noexcept -> size_type
+    {
+        return static_cast<size_type>(_xs.size());
+    }
+
+    /// \brief Returns the number of nodes in use, including the root.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto node_count() const noexcept -> size_type { return _node_count; }
+
+    /// \brief Returns a reference to the key getter.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto const& key_fn() const noexcept { return _get_key; }
+
+    /// \brief Returns a pointer to the element whose key is the longest
+    /// prefix of \p str, or `nullptr` if no key is a prefix of \p str.
+
+    /// Walks the trie once, so the cost is proportional to the length of
+    /// the match rather than to the number of keys.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto longest_prefix(pooled_string const str) const noexcept
+        -> value_type*
+    {
+        std::uint32_t node = 0;
+        std::uint32_t best = _values[0];
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            auto const edge = find_edge(node, str[i]);
+            if (edge == npos) break;
+            node = edge + 1;
+            if (_values[node] != npos) best = _values[node];
+        }
+        return best == npos
+                   ? nullptr
+                   : &_xs.unsafe_at(static_cast<index_type>(best));
+    }
+
+    /// \brief Returns whether some key is a prefix of \p str.
+
+    /// Stops at the shortest matching key.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto starts_with_any(pooled_string const str) const noexcept -> bool
+    {
+        if (_values[0] != npos) return true;
+        std::uint32_t node = 0;
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            auto const edge = find_edge(node, str[i]);
+            if (edge == npos) return false;
+            node = edge + 1;
+            if (_values[node] != npos) return true;
+        }
+        return false;
+    }
+};
+
+/// \brief Creates a #static_trie of the keys of a view.
+
+/// Mirrors #make_static_map_impl: `make_static_trie_impl<NodeCount>{}(xs,
+/// get_key)` builds a trie of `invoke(get_key, x)` for all elements `x` of
+/// `xs`. Keys may be NUL-terminated strings or string types with `data()`
+/// and `size()`. Construction throws #out_of_bound if more than `NodeCount`
+/// nodes are needed, i.e. fails to compile in a constant expression.
+///
+/// \code
+/// struct route { char const* prefix; int handler; };
+/// static constexpr route routes[] = {
+///     {"/", 0}, {"/api/", 1}, {"/api/v2/", 2}, {"/static/", 3}};
+/// static constexpr auto router =
+///     make_static_trie_impl<32>{}(raw_view(routes), &route::prefix);
+/// router.longest_prefix("/api/v2/users")->handler; // 2
+/// \endcode
+template <std::size_t NodeCount>
+struct make_static_trie_impl {
+    // clang-format off
+    template <class V, class GetKey
+        BOOST_STATIC_VIEWS_REQUIRES(
+            View<std::remove_cv_t<std::remove_reference_t<V>>>)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V&& xs, GetKey get_key) const
+    // clang-format on
+    {
+        using view_type = std::remove_cv_t<std::remove_reference_t<V>>;
+        return static_trie<view_type, GetKey, NodeCount>{
+            std::forward<V>(xs), std::move(get_key)};
+    }
+};
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_STATIC_TRIE_HPP
@@ -0,0 +1,186 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/string_equal.hpp
+///
+/// \brief Implementation of #string_equal.
+
+#ifndef BOOST_STATIC_VIEWS_STRING_EQUAL_HPP
+#define BOOST_STATIC_VIEWS_STRING_EQUAL_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// When strings of known size are compared, GCC warns about out-of-bounds
+// reads in the branches for longer strings even though they are never taken.
+#if defined(BOOST_STATIC_VIEWS_GCC)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+template <class T>
+BOOST_STATIC_VIEWS_FORCEINLINE auto load_unaligned(char const* const p) noexcept
+    -> T
+{
+    T x;
+    std::memcpy(&x, p, sizeof(T));
+    return x;
+}
+
+// Compares n bytes without reading past the end of either string: the last
+// (partial) chunk is handled by a load which ends at byte n - 1 and overlaps
+// the previous chunk.
+BOOST_STATIC_VIEWS_FORCEINLINE
+auto equal_bytes_runtime(char const* const a, char const* const b,
+    std::size_t const n) noexcept -> bool
+{
+    if (n < 4) {
+        // Bytes 0, n / 2 and n - 1 cover all of the string.
+        if (n == 0) return true;
+        return a[0] == b[0] && a[n / 2] == b[n / 2] && a[n - 1] == b[n - 1];
+    }
+    if (n <= 8) {
+        using word = std::uint32_t;
+        return ((load_unaligned<word>(a) ^ load_unaligned<word>(b))
+                   | (load_unaligned<word>(a + n - 4)
+                         ^ load_unaligned<word>(b + n - 4)))
+               == 0;
+    }
+    if (n <= 16) {
+        using word = std::uint64_t;
+        return ((load_unaligned<word>(a) ^ load_unaligned<word>(b))
+                   | (load_unaligned<word>(a + n - 8)
+                         ^ load_unaligned<word>(b + n - 8)))
+               == 0;
+    }
+#if defined(__AVX2__)
+    if (n <= 32) {
+        auto const load = [](char const* const p) {
+            return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+        };
+        auto const eq = _mm_and_si128(_mm_cmpeq_epi8(load(a), load(b)),
+            _mm_cmpeq_epi8(load(a + n - 16), load(b + n - 16)));
+        return _mm_movemask_epi8(eq) == 0xFFFF;
+    }
+    auto const load = [](char const* const p) {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    };
+    for (std::size_t i = 0; i + 32 < n; i += 32) {
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(load(a + i), load(b + i)))
+            != -1)
+            return false;
+    }
+    return _mm256_movemask_epi8(
+               _mm256_cmpeq_epi8(load(a + n - 32), load(b + n - 32)))
+           == -1;
+#elif defined(__SSE2__)
+    auto const load = [](char const* const p) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+    };
+    for (std::size_t i = 0; i + 16 < n; i += 16) {
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(load(a + i), load(b + i)))
+            != 0xFFFF)
+            return false;
+    }
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(load(a + n - 16), load(b + n - 16)))
+           == 0xFFFF;
+#else
+    using word = std::uint64_t;
+    for (std::size_t i = 0; i + 8 < n; i += 8) {
+        if (load_unaligned<word>(a + i) != load_unaligned<word>(b + i))
+            return false;
+    }
+    return load_unaligned<word>(a + n - 8) == load_unaligned<word>(b + n - 8);
+#endif
+}
+
+#if defined(BOOST_STATIC_VIEWS_GCC)
+#pragma GCC diagnostic pop
+#endif
+
+BOOST_STATIC_VIEWS_FORCEINLINE
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto equal_bytes(char const* const a, char const* const b,
+    std::size_t const n) noexcept -> bool
+{
+    if (!BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED()) {
+        return equal_bytes_runtime(a, b, n);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+template <class T>
+using data_member_t = decltype(std::declval<T const&>().data());
+
+template <class T>
+using size_member_t = decltype(std::declval<T const&>().size());
+
+template <class T>
+using is_char_string = std::integral_constant<bool,
+    std::is_same<detected_t<data_member_t, T>, char const*>::value
+        && std::is_convertible<detected_t<size_member_t, T>,
+               std::size_t>::value>;
+
+} // namespace detail
+
+/// \brief Equality comparison of strings meant to be used as `key_equal`
+/// of #static_map.
+
+/// For string types which know their size (#pooled_string,
+/// `std::string_view`, `std::string`) sizes are compared first, and the
+/// characters are then compared 32 (AVX2), 16 (SSE2) or 8 bytes at a time.
+/// The last few bytes are compared with a load which overlaps the previous
+/// one, so neither string is read past its end and no padding is required.
+///
+/// NUL-terminated strings are compared with `std::strcmp`.
+///
+/// During constant evaluation, a plain loop is used.
+struct string_equal {
+    // clang-format off
+    template <class String
+        BOOST_STATIC_VIEWS_REQUIRES(detail::is_char_string<String>::value)
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(String const& a, String const& b) const noexcept -> bool
+    // clang-format on
+    {
+        return a.size() == b.size()
+               && detail::equal_bytes(a.data(), b.data(),
+                      static_cast<std::size_t>(a.size()));
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(char const* const a, char const* const b) const noexcept
+        -> bool
+    {
+        if (!BOOST_STATIC_VIEWS_IS_CONSTANT_EVALUATED()) {
+            return std::strcmp(a, b) == 0;
+        }
+        std::size_t i = 0;
+        while (a[i] != '\0' && a[i] == b[i]) {
+            ++i;
+        }
+        return a[i] == b[i];
+    }
+};
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_STRING_EQUAL_HPP
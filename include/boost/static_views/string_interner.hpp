@@ -0,0 +1,126 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/string_interner.hpp
+///
+/// \brief Implementation of #string_interner.
+
+#ifndef BOOST_STATIC_VIEWS_STRING_INTERNER_HPP
+#define BOOST_STATIC_VIEWS_STRING_INTERNER_HPP
+
+#include "detail/config.hpp"
+#include "raw_view.hpp"
+#include "static_map.hpp"
+#include "string_pool.hpp"
+#include <cstddef>
+#include <type_traits>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+// Maps an entry of a string pool to its position in the pool.
+struct pool_entry_index {
+    string_pool_entry const* first;
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(string_pool_entry const& x) const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(&x - first);
+    }
+};
+} // namespace detail
+
+/// \brief Maps a fixed set of strings to dense ids `0, 1, ..., size() - 1`.
+
+/// The id of a string is its position in the #string_pool the interner was
+/// built from. This is meant for dispatching on keywords: rather than
+/// comparing the input with every keyword in turn, look up its id once and
+/// `switch` on it or use it as an index into plain arrays.
+///
+/// \code
+/// static constexpr auto methods_pool = make_string_pool("GET", "POST");
+/// static constexpr auto methods = make_string_interner(methods_pool);
+///
+/// switch (methods.lookup_id(input)) {
+/// case methods.id_of("GET"): ...
+/// case methods.id_of("POST"): ...
+/// default: ...
+/// }
+/// \endcode
+///
+/// Both the pool and the interner have to have static storage duration.
+template <class StaticMap>
+class string_interner {
+    StaticMap                _map;
+    string_pool_entry const* _entries;
+
+  public:
+    using id_type   = std::size_t;
+    using size_type = std::size_t;
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    string_interner(StaticMap map, string_pool_entry const* const entries)
+        : _map{std::move(map)}, _entries{entries}
+    {
+    }
+
+    /// \brief Returns the number of strings.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto size() const noexcept -> size_type
+    {
+        return static_cast<size_type>(_map.size());
+    }
+
+    /// \brief Returns the id of \p str.
+
+    /// \throws key_not_found_error if \p str is not one of the strings. In a
+    /// constant expression (e.g. a `case` label), this is a compile error.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto id_of(pooled_string const str) const -> id_type
+    {
+        return _map.at(str);
+    }
+
+    /// \brief Returns the id of \p str, or `size()` if \p str is not one of
+    /// the strings.
+
+    /// Using `size()` as the sentinel allows to store a fallback as the last
+    /// element of an array of `size() + 1` elements indexed by ids.
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto lookup_id(pooled_string const str) const noexcept -> id_type
+    {
+        auto const* const x = _map.find(str);
+        return x == nullptr ? size() : static_cast<id_type>(x - _entries);
+    }
+
+    /// \brief Returns the string with id \p id.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto name_of(id_type const id) const noexcept -> pooled_string
+    {
+        return invoke(_map.key_fn(), _entries[id]);
+    }
+};
+
+/// \brief Creates a #string_interner for the strings in \p pool.
+
+/// `BucketCount` and `BucketSize` are passed on to #make_static_map_impl.
+// clang-format off
+template <std::size_t BucketCount = 0, std::size_t BucketSize = 0,
+    std::size_t Bytes, std::size_t Count>
+BOOST_STATIC_VIEWS_CONSTEXPR
+auto make_string_interner(string_pool<Bytes, Count, false> const& pool)
+// clang-format on
+{
+    auto map = make_static_map_impl<BucketCount, BucketSize>{}(
+        raw_view(pool.entries()), pool.key_fn(),
+        detail::pool_entry_index{pool.entries()});
+    return string_interner<decltype(map)>{std::move(map), pool.entries()};
+}
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_STRING_INTERNER_HPP
@@ -0,0 +1,328 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/string_pool.hpp
+///
+/// \brief Implementation of #string_pool.
+
+#ifndef BOOST_STATIC_VIEWS_STRING_POOL_HPP
+#define BOOST_STATIC_VIEWS_STRING_POOL_HPP
+
+#include "detail/config.hpp"
+#include "hash_c.hpp"
+#include "string_equal.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+/// \brief Reference to a string of known length.
+
+/// This is the key (and value) type of maps built on top of a #string_pool.
+/// It is implicitly constructible from NUL-terminated strings and from
+/// string types with `data()` and `size()` so that such maps can be queried
+/// with string literals or `std::string_view`s.
+class pooled_string {
+    char const* _data;
+    std::size_t _size;
+
+  public:
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    pooled_string(char const* const data, std::size_t const size) noexcept
+        : _data{data}, _size{size}
+    {
+    }
+
+    /// \brief Creates a reference to the NUL-terminated string \p str.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    pooled_string(char const* const str) noexcept : _data{str}, _size{0}
+    {
+        while (str[_size] != '\0') {
+            ++_size;
+        }
+    }
+
+    /// \brief Creates a reference to the characters of \p str, e.g. a
+    /// `std::string_view` or a `std::string`.
+    // clang-format off
+    template <class String
+        BOOST_STATIC_VIEWS_REQUIRES(
+            detail::is_char_string<String>::value
+         && !std::is_same<String, pooled_string>::value)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    pooled_string(String const& str) noexcept
+    // clang-format on
+        : _data{str.data()}, _size{static_cast<std::size_t>(str.size())}
+    {
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto data() const noexcept -> char const* { return _data; }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto size() const noexcept -> std::size_t { return _size; }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator[](std::size_t const i) const noexcept -> char
+    {
+        return _data[i];
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    friend auto operator==(
+        pooled_string const a, pooled_string const b) noexcept -> bool
+    {
+        return a._size == b._size
+               && detail::equal_bytes(a._data, b._data, a._size);
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    friend auto operator!=(
+        pooled_string const a, pooled_string const b) noexcept -> bool
+    {
+        return !(a == b);
+    }
+};
+
+/// \brief Same hash as `hash_c{}(str)` for a NUL-terminated \p str.
+template <>
+struct hash_impl<pooled_string> {
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(pooled_string const x) const noexcept -> std::size_t
+    {
+        std::size_t hash = 0;
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            hash = 37 * hash + static_cast<unsigned char>(x[i]);
+        }
+        return hash;
+    }
+};
+
+/// \brief Element of a #string_pool.
+
+/// Holds offsets of the length prefix of the key and of the value in the
+/// pool. For pools without values, `value` is zero.
+struct string_pool_entry {
+    std::uint32_t key;
+    std::uint32_t value;
+};
+
+namespace detail {
+template <class T, std::size_t N>
+BOOST_STATIC_VIEWS_CONSTEXPR auto sum(T const (&xs)[N]) noexcept -> T
+{
+    T result = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        result += xs[i];
+    }
+    return result;
+}
+
+template <std::size_t... Sizes>
+struct string_pool_bytes
+    // Every string takes its length, a one byte length prefix and the
+    // terminating NUL; N already accounts for the latter.
+    : std::integral_constant<std::size_t,
+          sum({std::size_t{0}, (Sizes + 1)...})> {
+
+    static_assert(sum({std::size_t{0}, std::size_t{Sizes <= 256}...})
+                      == sizeof...(Sizes),
+        "boost::static_views::string_pool supports strings of at most 255 "
+        "characters.");
+};
+
+struct make_string_pool_impl;
+} // namespace detail
+
+/// \brief All strings of a table packed into a single array.
+
+/// Every string is stored as a one byte length followed by the characters
+/// and a terminating NUL. With values, the value of an entry immediately
+/// follows its key, so a successful lookup touches one cache line rather
+/// than two. Strings are laid out in the order of the buckets their keys
+/// hash to with #hash_c in a map with a given number of buckets, so the
+/// candidate keys of a bucket are contiguous. Entries keep the order of
+/// the arguments. #entries() is the array of #string_pool_entry which is
+/// meant to be used as the parent view of #static_map together with
+/// #key_fn() and #value_fn():
+///
+/// \code
+/// static constexpr auto pool = make_string_pool_with_values(
+///     "red", "#ff0000", "green", "#00ff00");
+/// static constexpr auto map = make_static_map_impl<>{}(
+///     raw_view(pool.entries()), pool.key_fn(), pool.value_fn());
+/// static_assert(map.at("green") == "#00ff00", "");
+/// \endcode
+///
+/// Compared to a table of `char const*`, elements are 8 rather than 16
+/// bytes large, and keys are compared without first loading a pointer from
+/// the table. The pool has to have static storage duration, because the
+/// getters refer to it by address.
+template <std::size_t Bytes, std::size_t Count, bool HasValues>
+class string_pool {
+    static_assert(Bytes <= UINT32_MAX,
+        "boost::static_views::string_pool is limited to 4GB of strings.");
+
+    char              _data[Bytes];
+    string_pool_entry _entries[Count];
+
+    friend struct detail::make_string_pool_impl;
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    string_pool(char const* const* const strs, std::size_t const* const sizes,
+        std::size_t const bucket_count)
+        : _data{}, _entries{}
+    {
+        constexpr std::size_t stride = HasValues ? 2 : 1;
+        // Entry indices sorted by bucket. Insertion sort is stable, so keys
+        // of one bucket keep the order of the arguments.
+        std::size_t bucket[Count] = {};
+        std::size_t order[Count]  = {};
+        for (std::size_t i = 0; i < Count; ++i) {
+            bucket[i] = hash_impl<pooled_string>{}(pooled_string{
+                            strs[stride * i], sizes[stride * i]})
+                        % bucket_count;
+            auto j = i;
+            while (j > 0 && bucket[i] < bucket[order[j - 1]]) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = i;
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < Count; ++i) {
+            auto const k       = stride * order[i];
+            auto&      entry   = _entries[order[i]];
+            entry.key          = append(offset, strs[k], sizes[k]);
+            if (HasValues) {
+                entry.value = append(offset, strs[k + 1], sizes[k + 1]);
+            }
+        }
+    }
+
+    // Stores str at offset and returns the offset.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto append(std::size_t& offset, char const* const str,
+        std::size_t const size) noexcept -> std::uint32_t
+    {
+        auto const start = offset;
+        _data[offset++]  = static_cast<char>(size);
+        for (std::size_t j = 0; j < size; ++j) {
+            _data[offset++] = str[j];
+        }
+        _data[offset++] = '\0';
+        return static_cast<std::uint32_t>(start);
+    }
+
+    template <bool Value>
+    struct string_fn {
+        char const* data;
+
+        BOOST_STATIC_VIEWS_FORCEINLINE
+        BOOST_STATIC_VIEWS_CONSTEXPR
+        auto operator()(string_pool_entry const& x) const noexcept
+            -> pooled_string
+        {
+            auto const offset = Value ? x.value : x.key;
+            return {data + offset + 1,
+                static_cast<unsigned char>(data[offset])};
+        }
+    };
+
+  public:
+    /// \brief Returns the number of entries.
+    static constexpr auto size() noexcept -> std::size_t { return Count; }
+
+    /// \brief Returns the number of bytes used by the strings.
+    static constexpr auto bytes() noexcept -> std::size_t { return Bytes; }
+
+    /// \brief Returns the array of entries.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto entries() const noexcept -> string_pool_entry const (&)[Count]
+    {
+        return _entries;
+    }
+
+    /// \brief Returns the key of the `i`'th entry.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto key(std::size_t const i) const noexcept -> pooled_string
+    {
+        return key_fn()(_entries[i]);
+    }
+
+    /// \brief Returns a function object mapping entries to their keys.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto key_fn() const noexcept -> string_fn<false> { return {_data}; }
+
+    /// \brief Returns a function object mapping entries to their values.
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto value_fn() const noexcept -> string_fn<true>
+    {
+        static_assert(HasValues, "This string_pool has no values.");
+        return {_data};
+    }
+};
+
+namespace detail {
+// BucketCount == 0 means the default bucket count of make_static_map_impl.
+struct make_string_pool_impl {
+    template <std::size_t BucketCount, std::size_t... Sizes>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto keys(
+        char const (&... strs)[Sizes]) const noexcept
+    {
+        constexpr auto count = sizeof...(Sizes);
+        char const* const ptrs[]  = {strs...};
+        std::size_t const sizes[] = {(Sizes - 1)...};
+        return string_pool<string_pool_bytes<Sizes...>::value, count, false>{
+            ptrs, sizes, BucketCount == 0 ? 2 * count : BucketCount};
+    }
+
+    template <std::size_t BucketCount, std::size_t... Sizes>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto keys_and_values(
+        char const (&... strs)[Sizes]) const noexcept
+    {
+        static_assert(sizeof...(Sizes) % 2 == 0,
+            "boost::static_views::make_string_pool_with_values expects "
+            "alternating keys and values.");
+        constexpr auto count = sizeof...(Sizes) / 2;
+        char const* const ptrs[]  = {strs...};
+        std::size_t const sizes[] = {(Sizes - 1)...};
+        return string_pool<string_pool_bytes<Sizes...>::value, count, true>{
+            ptrs, sizes, BucketCount == 0 ? 2 * count : BucketCount};
+    }
+};
+} // namespace detail
+
+/// \brief Packs string literals \p strs into a #string_pool.
+
+/// Strings are laid out for a map with \p BucketCount buckets. The default
+/// matches the one of #make_static_map_impl.
+template <std::size_t BucketCount = 0, std::size_t... Sizes>
+BOOST_STATIC_VIEWS_CONSTEXPR auto make_string_pool(
+    char const (&... strs)[Sizes]) noexcept
+{
+    return detail::make_string_pool_impl{}.keys<BucketCount>(strs...);
+}
+
+/// \brief Packs string literals into a #string_pool with values.
+
+/// Arguments alternate between keys and values, i.e.
+/// `make_string_pool_with_values(key1, value1, key2, value2, ...)`. See
+/// #make_string_pool for \p BucketCount.
+template <std::size_t BucketCount = 0, std::size_t... Sizes>
+BOOST_STATIC_VIEWS_CONSTEXPR auto make_string_pool_with_values(
+    char const (&... strs)[Sizes]) noexcept
+{
+    return detail::make_string_pool_impl{}.keys_and_values<BucketCount>(
+        strs...);
+}
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_STRING_POOL_HPP
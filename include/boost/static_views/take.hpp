@@ -37,6 +37,9 @@ struct take_view_impl
         compact_index<void, typename base::index_type, Extent>;
     using compact_index_type::index;
 
+    friend struct take_exactly_impl;
+    friend struct drop_exactly_impl;
+
   public:
     using typename base::index_type;
     using typename base::reference;
@@ -98,15 +101,51 @@ struct take_view_impl
             "`0 <= i < size()` is not satisfied.");
         return i;
     }
+
+    /// \brief Returns a pointer to the first element viewed.
+
+    /// Only available if the parent view is a #ContiguousView.
+    // clang-format off
+    template <class V = std::remove_cv_t<typename Wrapper::value_type>
+        BOOST_STATIC_VIEWS_REQUIRES(ContiguousView<V>)
+    BOOST_STATIC_VIEWS_CONSTEXPR auto data() const noexcept -> value_type*
+    // clang-format on
+    {
+        return parent().data();
+    }
 };
 
+template <class T>
+struct is_take_view : std::false_type {};
+
+template <class Wrapper, std::ptrdiff_t Extent>
+struct is_take_view<take_view_impl<Wrapper, Extent>> : std::true_type {};
+
 struct take_exactly_impl {
   private:
-    template <class Wrapper, class IndexType>
+    friend struct drop_exactly_impl;
+
+    template <class V, class IndexType>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        V&& xs, IndexType const n, std::false_type /*is take view*/) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            take_view_impl<decltype(make_wrapper(std::forward<V>(xs))),
+                IndexType::extent()>{make_wrapper(std::forward<V>(xs)), n});
+
+    // take_exactly(take_exactly(xs, m), n) is take_exactly(xs, n), so takes
+    // never nest.
+    template <class V, class IndexType>
     BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
-        Wrapper xs, IndexType const n) const
+        V&& xs, IndexType const n, std::true_type /*is take view*/) const
         BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
-            take_view_impl<Wrapper, IndexType::extent()>{std::move(xs), n});
+            call_impl(std::forward<V>(xs).parent(), n,
+                is_take_view<remove_cvref_t<decltype(xs.parent())>>{}));
+
+    template <class V, class IndexType>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        V&& xs, IndexType const n) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(call_impl(
+            std::forward<V>(xs), n, is_take_view<remove_cvref_t<V>>{}));
 
     template <class T>
     using index_t =
@@ -124,14 +163,14 @@ struct take_exactly_impl {
         // clang-format on
         BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(
             noexcept(std::declval<take_exactly_impl const&>().call_impl(
-                make_wrapper(std::forward<V>(xs)), index(n))))
+                std::forward<V>(xs), index(n))))
     {
         using index_type = index_t<V>;
         BOOST_STATIC_VIEWS_EXPECT(
             0 <= n && n <= static_cast<index_type>(xs.size()),
             "boost::static_views::take_exactly(xs, n): Precondition "
             "`0 <= n <= xs.size()` is not satisfied.");
-        return call_impl(make_wrapper(std::forward<V>(xs)), index(n));
+        return call_impl(std::forward<V>(xs), index(n));
     }
 
     // clang-format off
@@ -153,7 +192,7 @@ struct take_exactly_impl {
         // clang-format on
         BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(
             noexcept(std::declval<take_exactly_impl const&>().call_impl(
-                make_wrapper(std::forward<V>(xs)),
+                std::forward<V>(xs),
                 index(std::integral_constant<index_t<V>, I>{}))))
     {
         using index_type = index_t<V>;
@@ -167,7 +206,7 @@ struct take_exactly_impl {
             0 <= n && n <= static_cast<index_type>(xs.size()),
             "boost::static_views::take_exactly(xs, b): Precondition "
             "`0 <= n <= xs.size()` is not satisfied.");
-        return call_impl(make_wrapper(std::forward<V>(xs)),
+        return call_impl(std::forward<V>(xs),
             index(std::integral_constant<index_type, I>{}));
     }
 
@@ -6,41 +6,71 @@
 #ifndef BOOST_STATIC_VIEWS_THROUGH_HPP
 #define BOOST_STATIC_VIEWS_THROUGH_HPP
 
+#include "detail/invoke.hpp"
+#include "for_each.hpp"
 #include "view_base.hpp"
 #include <type_traits>
 
 BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
 
 namespace detail {
+
+template <class Parent, class F>
+struct through_visitor {
+    Parent const& xs;
+    F&            f;
+
+    template <class Index>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(Index const i) const -> bool
+    {
+        return invoke(f, xs.unsafe_at(i));
+    }
+};
+
+// Wrapper and Proxy are often the same type, e.g. when a view is looked up
+// through a view of the same kind. Deriving from Proxy directly would then
+// make it an ambiguous base.
+template <class Proxy>
+struct through_proxy_storage : Proxy {
+    BOOST_STATIC_VIEWS_CONSTEXPR through_proxy_storage(Proxy&& proxy)
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+            std::is_nothrow_move_constructible<Proxy>::value)
+        : Proxy{std::move(proxy)}
+    {
+    }
+};
+
 template <class Wrapper, class Proxy>
 struct through_view_impl
     : public view_adaptor_base<through_view_impl<Wrapper, Proxy>, Wrapper>
-    // TODO: I'm not sure if this is safe, i.e. could the user come up with a
-    // really tricky combination of views such that view_adaptor_base<...> would
-    // end up deriving from Proxy too?
-    , private Proxy {
+    , private through_proxy_storage<Proxy> {
 
   private:
     using wrapper_type    = Wrapper;
     using proxy_type      = Proxy;
     using proxy_view_type = typename proxy_type::value_type;
+    using storage_type    = through_proxy_storage<Proxy>;
     using base = view_adaptor_base<through_view_impl<Wrapper, Proxy>, Wrapper>;
 
+    friend struct through_impl;
+
     BOOST_STATIC_VIEWS_CONSTEXPR auto const& proxy() const& noexcept
     {
-        return static_cast<Proxy const&>(*this).get();
+        return static_cast<storage_type const&>(*this).get();
     }
 
     BOOST_STATIC_VIEWS_CONSTEXPR auto& proxy() & noexcept
     {
-        return static_cast<Proxy&>(*this).get();
+        return static_cast<storage_type&>(*this).get();
     }
 
-    BOOST_STATIC_VIEWS_CONSTEXPR auto proxy()
+    BOOST_STATIC_VIEWS_CONSTEXPR BOOST_STATIC_VIEWS_DECLTYPE_AUTO proxy()
         && BOOST_STATIC_VIEWS_NOEXCEPT_IF(
                std::is_nothrow_move_constructible<proxy_view_type>::value)
     {
-        return static_cast<Proxy&&>(*this).get();
+        return static_cast<storage_type&&>(*this).get();
     }
 
   public:
@@ -88,7 +118,7 @@ struct through_view_impl
         BOOST_STATIC_VIEWS_NOEXCEPT_IF(
             std::is_nothrow_constructible<base, Wrapper&&>::value&&
                 std::is_nothrow_move_constructible<Proxy>::value)
-        : base{std::move(xs)}, proxy_type{std::move(proxy)}
+        : base{std::move(xs)}, storage_type{std::move(proxy)}
     {
     }
 
@@ -138,14 +168,53 @@ struct through_view_impl
             "`0 <= i < size()` is not satisfied.");
         return proxy().unsafe_at(i);
     }
+
+    /// \brief Calls `f` for elements in order until it returns `false`.
+
+    /// Walks over the proxy view with its own #for_each_while, so indices
+    /// are not looked up in the proxy one by one.
+    template <class F>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto for_each_while(F& f) const -> bool
+    {
+        using parent_type = std::remove_cv_t<typename Wrapper::value_type>;
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(
+            proxy(), through_visitor<parent_type, F>{this->parent(), f});
+    }
 };
 
+template <class T>
+struct is_through_view : std::false_type {};
+
+template <class Wrapper, class Proxy>
+struct is_through_view<through_view_impl<Wrapper, Proxy>> : std::true_type {};
+
 struct through_impl {
   private:
-    template <class Wrapper, class Proxy>
-    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(Wrapper xs, Proxy ys) const
+    template <class V, class P>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        V&& xs, P&& proxy, std::false_type /*is through view*/) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            through_view_impl<decltype(make_wrapper(std::forward<V>(xs))),
+                decltype(make_wrapper(std::forward<P>(proxy)))>{
+                make_wrapper(std::forward<V>(xs)),
+                make_wrapper(std::forward<P>(proxy))});
+
+    // through(through(xs, p), q) is through(xs, through(p, q)), so that xs is
+    // always accessed through a single, composed, proxy. If xs is an rvalue,
+    // its parent and its proxy are moved out of it one by one.
+    template <class V, class P>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(
+        V&& xs, P&& proxy, std::true_type /*is through view*/) const
         BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
-            through_view_impl<Wrapper, Proxy>{std::move(xs), std::move(ys)});
+            call_impl(std::forward<V>(xs).parent(),
+                call_impl(std::forward<V>(xs).proxy(), std::forward<P>(proxy),
+                    is_through_view<remove_cvref_t<decltype(xs.proxy())>>{}),
+                is_through_view<remove_cvref_t<decltype(xs.parent())>>{}));
+
+    template <class V, class P>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(V&& xs, P&& proxy) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(call_impl(std::forward<V>(xs),
+            std::forward<P>(proxy), is_through_view<remove_cvref_t<V>>{}));
 
   public:
     // TODO; Should through_view be checking that operator[] of P actually
@@ -160,11 +229,9 @@ struct through_impl {
         // clang-format on
         BOOST_STATIC_VIEWS_NOEXCEPT_CHECKS_IF(
             noexcept(std::declval<through_impl const&>().call_impl(
-                make_wrapper(std::forward<V>(xs)),
-                make_wrapper(std::forward<P>(proxy)))))
+                std::forward<V>(xs), std::forward<P>(proxy))))
     {
-        return call_impl(make_wrapper(std::forward<V>(xs)),
-                make_wrapper(std::forward<P>(proxy)));
+        return call_impl(std::forward<V>(xs), std::forward<P>(proxy));
     }
 };
 
@@ -12,6 +12,7 @@
 
 #include "algorithm_base.hpp"
 #include "detail/invoke.hpp"
+#include "for_each.hpp"
 #include "view_base.hpp"
 
 #include <algorithm>
@@ -21,6 +22,20 @@ BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
 
 namespace detail {
 
+template <class Function, class F>
+struct transform_visitor {
+    Function const& function;
+    F&              f;
+
+    template <class T>
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(T&& x) const -> bool
+    {
+        return invoke(f, invoke(function, std::forward<T>(x)));
+    }
+};
+
 template <class Wrapper, class Function>
 struct transform_view_impl
     : view_adaptor_base<transform_view_impl<Wrapper, Function>, Wrapper>
@@ -64,6 +79,17 @@ struct transform_view_impl
         return invoke(
             static_cast<Function const&>(*this).get(), parent().unsafe_at(i));
     }
+
+    /// \brief Calls `f` for elements in order until it returns `false`.
+
+    /// Walks over the parent view with its own #for_each_while.
+    template <class F>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto for_each_while(F& f) const -> bool
+    {
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::for_each_while(parent(),
+            transform_visitor<function_type, F>{
+                static_cast<Function const&>(*this).get(), f});
+    }
 };
 
 struct transform_impl {
@@ -56,7 +56,7 @@ struct view_adaptor_core_access {
 
 // clang-format off
 template <class T
-    BOOST_STATIC_VIEWS_REQUIRES(View<T>)
+    BOOST_STATIC_VIEWS_REQUIRES(View<T> && !ContiguousView<T>)
 BOOST_STATIC_VIEWS_CONSTEXPR auto begin(T const& xs)
 BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
 (
@@ -64,7 +64,7 @@ BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
 );
 
 template <class T
-    BOOST_STATIC_VIEWS_REQUIRES(View<T>)
+    BOOST_STATIC_VIEWS_REQUIRES(View<T> && !ContiguousView<T>)
 BOOST_STATIC_VIEWS_CONSTEXPR auto begin(T& xs)
 BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
 (
@@ -72,7 +72,7 @@ BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
 );
 
 template <class T
-    BOOST_STATIC_VIEWS_REQUIRES(View<T>)
+    BOOST_STATIC_VIEWS_REQUIRES(View<T> && !ContiguousView<T>)
 BOOST_STATIC_VIEWS_CONSTEXPR auto end(T const& xs)
 BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
 (
@@ -80,12 +80,30 @@ BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
 );
 
 template <class T
-    BOOST_STATIC_VIEWS_REQUIRES(View<T>)
+    BOOST_STATIC_VIEWS_REQUIRES(View<T> && !ContiguousView<T>)
 BOOST_STATIC_VIEWS_CONSTEXPR auto end(T& xs)
 BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
 (
     view_iterator<T>{&xs, static_cast<typename view_iterator<T>::difference_type>(xs.size())}
 );
+
+// Contiguous views are iterated over with plain pointers, so loops over
+// them vectorise and may be replaced by memcpy or memcmp.
+template <class T
+    BOOST_STATIC_VIEWS_REQUIRES(ContiguousView<T>)
+BOOST_STATIC_VIEWS_CONSTEXPR auto begin(T const& xs)
+BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
+(
+    xs.data()
+);
+
+template <class T
+    BOOST_STATIC_VIEWS_REQUIRES(ContiguousView<T>)
+BOOST_STATIC_VIEWS_CONSTEXPR auto end(T const& xs)
+BOOST_STATIC_VIEWS_DECLTYPE_NOEXCEPT_RETURN
+(
+    xs.data() + xs.size()
+);
 // clang-format on
 
 /// \brief
@@ -153,6 +171,9 @@ struct view_adaptor_base : private Wrapper {
     /// \}
 
     /// \brief Returns the underlying view.
+
+    /// The rvalue overload moves the underlying view out if the adaptor
+    /// owns it and returns a reference otherwise.
     /// \{
     BOOST_STATIC_VIEWS_PURE
     BOOST_STATIC_VIEWS_CONSTEXPR auto const& parent() const& noexcept
@@ -162,7 +183,7 @@ struct view_adaptor_base : private Wrapper {
         return this->get();
     }
 
-    BOOST_STATIC_VIEWS_CONSTEXPR auto parent()
+    BOOST_STATIC_VIEWS_CONSTEXPR BOOST_STATIC_VIEWS_DECLTYPE_AUTO parent()
         && BOOST_STATIC_VIEWS_NOEXCEPT_IF(
                std::is_nothrow_move_constructible<
                    wrapper_type>::value)
@@ -21,6 +21,19 @@ constexpr bool             View =
         HasIndexOperatorWithType<T>&& HasUnsafeAtWithType<T>;
 #endif
 
+/// \brief A #View whose elements are laid out contiguously in memory.
+
+/// A view `xs` of type `T` is contiguous if `xs.data()` returns a
+/// `T::value_type*` such that `xs.data() + i == &xs.unsafe_at(i)` for all
+/// `0 <= i < xs.size()`. Such views are iterated over with plain pointers.
+#if defined(BOOST_STATIC_VIEWS_CONCEPTS)
+template <class T>
+concept bool ContiguousView = View<T>&& HasDataWithType<T>;
+#else
+template <class T>
+constexpr bool ContiguousView = View<T>&& HasDataWithType<T>;
+#endif
+
 template <class V>
 constexpr auto why_is_my_argument_not_a_view() -> void
 {
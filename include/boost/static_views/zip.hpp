@@ -0,0 +1,254 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/static_views/zip.hpp
+///
+/// \brief Implementation of #zip and #get_element.
+
+#ifndef BOOST_STATIC_VIEWS_ZIP_HPP
+#define BOOST_STATIC_VIEWS_ZIP_HPP
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/utils.hpp"
+#include "detail/wrapper.hpp"
+#include "errors.hpp"
+#include "view_base.hpp"
+#include "view_concept.hpp"
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+BOOST_STATIC_VIEWS_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Smallest of the extents known at compile-time, or dynamic_extent if none
+// is.
+constexpr auto min_extent() noexcept -> std::ptrdiff_t
+{
+    return dynamic_extent;
+}
+
+template <class... Extents>
+constexpr auto min_extent(std::ptrdiff_t const x, Extents const... xs) noexcept
+    -> std::ptrdiff_t
+{
+    return x == dynamic_extent
+               ? min_extent(xs...)
+               : (min_extent(xs...) == dynamic_extent
+                         ? x
+                         : std::min(x, min_extent(xs...)));
+}
+
+/// \brief View of several views ("columns") side by side.
+
+/// The `i`'th element is a `std::tuple` of references to the `i`'th
+/// elements of the columns. The size is the size of the shortest column.
+template <class... Wrappers>
+struct zip_view_impl {
+
+  private:
+    static_assert(sizeof...(Wrappers) > 0,
+        "[INTERNAL] Invalid use of zip_view_impl.");
+
+    std::tuple<Wrappers...> _xs;
+
+    template <class Wrapper>
+    using view_t = std::remove_cv_t<typename Wrapper::value_type>;
+
+    template <std::size_t I>
+    using column_type =
+        view_t<std::tuple_element_t<I, std::tuple<Wrappers...>>>;
+
+    using first_type = column_type<0>;
+
+  public:
+    using value_type = std::tuple<
+        std::remove_cv_t<typename view_t<Wrappers>::value_type>...>;
+    using reference  = std::tuple<typename view_t<Wrappers>::reference...>;
+    using size_type  = typename first_type::size_type;
+    using index_type = typename first_type::index_type;
+
+  private:
+    template <std::size_t... Is>
+    BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto
+    unsafe_at_impl(index_type const i, std::index_sequence<Is...> /*unused*/)
+        const BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+            all(noexcept(std::declval<column_type<Is> const&>().unsafe_at(
+                std::declval<typename column_type<Is>::index_type>()))...))
+            -> reference
+    {
+        return reference{std::get<Is>(_xs).get().unsafe_at(
+            static_cast<typename column_type<Is>::index_type>(i))...};
+    }
+
+    template <std::size_t... Is>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto size_impl(
+        std::index_sequence<Is...> /*unused*/) const noexcept -> size_type
+    {
+        size_type const sizes[] = {
+            static_cast<size_type>(std::get<Is>(_xs).get().size())...};
+        auto n = sizes[0];
+        for (auto const x : sizes) {
+            if (x < n) n = x;
+        }
+        return n;
+    }
+
+  public:
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    explicit zip_view_impl(Wrappers&&... xs) BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+        std::is_nothrow_move_constructible<std::tuple<Wrappers...>>::value)
+        : _xs{std::move(xs)...}
+    {
+    }
+
+    zip_view_impl(zip_view_impl const&) = default;
+    zip_view_impl(zip_view_impl&&)      = default;
+    zip_view_impl& operator=(zip_view_impl const&) = default;
+    zip_view_impl& operator=(zip_view_impl&&) = default;
+
+    /// \brief Returns the smallest of the extents of the columns which
+    /// are known at compile-time.
+    static constexpr auto extent() noexcept -> std::ptrdiff_t
+    {
+        return min_extent(view_t<Wrappers>::extent()...);
+    }
+
+    /// \brief Returns the size of the shortest column.
+    BOOST_STATIC_VIEWS_PURE
+    BOOST_STATIC_VIEWS_CONSTEXPR auto size() const noexcept -> size_type
+    {
+        return size_impl(std::index_sequence_for<Wrappers...>{});
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto unsafe_at(index_type const i) const BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+        noexcept(std::declval<zip_view_impl const&>().unsafe_at_impl(
+            i, std::index_sequence_for<Wrappers...>{}))) -> reference
+    {
+        return unsafe_at_impl(i, std::index_sequence_for<Wrappers...>{});
+    }
+
+    BOOST_STATIC_VIEWS_FORCEINLINE
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator[](index_type const i) const -> reference
+    {
+        if (BOOST_STATIC_VIEWS_UNLIKELY(
+                0 > i || static_cast<size_type>(i) >= size())) {
+            make_out_of_bound_error(
+                "Precondition `0 <= i < size()` not satisfied in "
+                "boost::static_views::zip_view::operator[].");
+            BOOST_STATIC_VIEWS_UNREACHABLE;
+        }
+        return unsafe_at(i);
+    }
+
+    /// \brief Returns the \p I'th column.
+    template <std::size_t I>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto column() const noexcept
+        -> column_type<I> const&
+    {
+        return std::get<I>(_xs).get();
+    }
+
+    /// \brief Returns a pointer to the first element of the \p I'th column.
+
+    /// Only available if the \p I'th column is a #ContiguousView, so loops
+    /// over a single column can still use plain pointers.
+    // clang-format off
+    template <std::size_t I
+        BOOST_STATIC_VIEWS_REQUIRES(ContiguousView<column_type<I>>)
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto data() const noexcept
+    // clang-format on
+    {
+        return column<I>().data();
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto begin() const noexcept
+    {
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::begin(*this);
+    }
+
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto end() const noexcept
+    {
+        return ::BOOST_STATIC_VIEWS_NAMESPACE::end(*this);
+    }
+};
+
+struct zip_impl {
+  private:
+    template <class... Wrappers>
+    BOOST_STATIC_VIEWS_CONSTEXPR auto call_impl(Wrappers... xs) const
+        BOOST_STATIC_VIEWS_AUTO_NOEXCEPT_RETURN(
+            zip_view_impl<Wrappers...>{std::move(xs)...});
+
+  public:
+    // clang-format off
+    template <class V, class... Vs
+        BOOST_STATIC_VIEWS_REQUIRES(
+            all(View<remove_cvref_t<V>>, View<remove_cvref_t<Vs>>...))
+    BOOST_STATIC_VIEWS_CONSTEXPR
+    auto operator()(V&& xs, Vs&&... ys) const
+    // clang-format on
+        BOOST_STATIC_VIEWS_NOEXCEPT_IF(
+            noexcept(std::declval<zip_impl const&>().call_impl(
+                make_wrapper(std::forward<V>(xs)),
+                make_wrapper(std::forward<Vs>(ys))...)))
+    {
+        return call_impl(make_wrapper(std::forward<V>(xs)),
+            make_wrapper(std::forward<Vs>(ys))...);
+    }
+};
+
+template <std::size_t I>
+struct get_element_impl {
+    template <class Tuple>
+    BOOST_STATIC_VIEWS_FORCEINLINE BOOST_STATIC_VIEWS_CONSTEXPR auto operator()(
+        Tuple&& x) const noexcept
+        -> decltype(std::get<I>(std::forward<Tuple>(x)))
+    {
+        return std::get<I>(std::forward<Tuple>(x));
+    }
+};
+
+} // namespace detail
+
+/// \brief Views several views as one view of tuples.
+
+/// `zip(xs, ys, ...)[i]` is `std::tuple<X&, Y&, ...>{xs[i], ys[i], ...}`,
+/// i.e. a tuple of the references of the columns. This lets one keep
+/// columns of a table in separate arrays ("struct of arrays") and still
+/// build e.g. a #static_map keyed on one column and valued on another (see
+/// #get_element). Columns are stored like adaptors store their parents:
+/// lvalues by reference and rvalues by value.
+///
+/// The size is the size of the shortest column, and the extent is the
+/// smallest extent of the columns which is known at compile-time. Columns
+/// are accessible with `column<I>()`, and `data<I>()` returns a pointer to
+/// the elements of a contiguous column.
+BOOST_STATIC_VIEWS_INLINE_VARIABLE(detail::zip_impl, zip)
+
+/// \brief Getter of the \p I'th element of a tuple.
+
+/// `get_element<I>{}(x)` is `std::get<I>(x)`. For elements of a #zip view
+/// this returns the reference into the \p I'th column, so it can be used as
+/// the `GetKey` and `GetMapped` arguments of #make_static_map_impl:
+/// \code
+/// make_static_map(zip(raw_view(keys), raw_view(values)),
+///     get_element<0>{}, get_element<1>{});
+/// \endcode
+template <std::size_t I>
+using get_element = detail::get_element_impl<I>;
+
+BOOST_STATIC_VIEWS_END_NAMESPACE
+
+#endif // BOOST_STATIC_VIEWS_ZIP_HPP
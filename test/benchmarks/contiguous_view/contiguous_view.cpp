@@ -0,0 +1,105 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Sums and compares slices of arrays. Compares iteration with
+// view_iterator, which goes through unsafe_at() of every adaptor, with the
+// plain pointers begin() and end() return for contiguous views.
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/slice.hpp>
+
+namespace sv = boost::static_views;
+
+static std::int32_t numbers[1 << 16];
+static std::int32_t copy_of_numbers[1 << 16];
+
+template <class V>
+auto sum_with_view_iterator(V const& xs) -> std::int32_t
+{
+    sv::view_iterator<V const> first{&xs, 0};
+    sv::view_iterator<V const> last{
+        &xs, static_cast<typename V::index_type>(xs.size())};
+    std::int32_t sum = 0;
+    for (; first != last; ++first) {
+        sum += *first;
+    }
+    return sum;
+}
+
+template <class V>
+auto sum_with_pointers(V const& xs) -> std::int32_t
+{
+    std::int32_t sum = 0;
+    for (auto const x : xs) {
+        sum += x;
+    }
+    return sum;
+}
+
+auto benchmark_sum_view_iterator(benchmark::State& state)
+{
+    std::iota(std::begin(numbers), std::end(numbers), 0);
+    auto const xs = sv::slice(1, (1 << 16) - 1)(sv::raw_view(numbers));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_with_view_iterator(xs));
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * xs.size()));
+}
+
+auto benchmark_sum_pointers(benchmark::State& state)
+{
+    std::iota(std::begin(numbers), std::end(numbers), 0);
+    auto const xs = sv::slice(1, (1 << 16) - 1)(sv::raw_view(numbers));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_with_pointers(xs));
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * xs.size()));
+}
+
+auto benchmark_equal_view_iterator(benchmark::State& state)
+{
+    std::iota(std::begin(numbers), std::end(numbers), 0);
+    std::iota(std::begin(copy_of_numbers), std::end(copy_of_numbers), 0);
+    auto const xs = sv::slice(1, (1 << 16) - 1)(sv::raw_view(numbers));
+    auto const ys =
+        sv::slice(1, (1 << 16) - 1)(sv::raw_view(copy_of_numbers));
+    using iterator = sv::view_iterator<decltype(xs) const>;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::equal(iterator{&xs, 0},
+            iterator{&xs, static_cast<int>(xs.size())}, iterator{&ys, 0}));
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * xs.size()));
+}
+
+auto benchmark_equal_pointers(benchmark::State& state)
+{
+    std::iota(std::begin(numbers), std::end(numbers), 0);
+    std::iota(std::begin(copy_of_numbers), std::end(copy_of_numbers), 0);
+    auto const xs = sv::slice(1, (1 << 16) - 1)(sv::raw_view(numbers));
+    auto const ys =
+        sv::slice(1, (1 << 16) - 1)(sv::raw_view(copy_of_numbers));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::equal(xs.begin(), xs.end(), ys.begin()));
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * xs.size()));
+}
+
+BENCHMARK(benchmark_sum_view_iterator);
+BENCHMARK(benchmark_sum_pointers);
+BENCHMARK(benchmark_equal_view_iterator);
+BENCHMARK(benchmark_equal_pointers);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#!/bin/bash
+
+declare -r SRC_FILE="dispatch_table.cpp"
+declare -r OUT_FILE="benchmark_result"
+
+compile ()
+{
+	g++ -O3 -march=native -std=c++14 -I../../../include \
+		-DNDEBUG \
+		-DBOOST_STATIC_VIEWS_DISABLE_CHECKS \
+		"$SRC_FILE" \
+		-lbenchmark -lpthread
+}
+
+compile || exit 1
+./a.out --benchmark_format=console \
+        --benchmark_out_format=csv \
+        --benchmark_out="$OUT_FILE.csv"
@@ -0,0 +1,171 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Runs a toy bytecode interpreter over a random program. Opcodes are mapped
+// to handlers either by a static_map with function pointers as mapped
+// values or by a dispatch_table. A hand-written switch serves as the
+// baseline.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/dispatch_table.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+namespace sv = boost::static_views;
+
+// X(opcode, name, expression of acc)
+#define OPCODES                                                              \
+    X(0x01, add, acc + 3)                                                    \
+    X(0x02, sub, acc - 5)                                                    \
+    X(0x03, mul, acc * 3)                                                    \
+    X(0x10, shl, acc << 1)                                                   \
+    X(0x11, shr, acc >> 1)                                                   \
+    X(0x20, eor, acc ^ 0x5a5a)                                               \
+    X(0x21, neg, -acc)                                                       \
+    X(0x30, inc, acc + 1)
+
+#define X(code, name, expr)                                                  \
+    auto op_##name(std::uint32_t const acc) noexcept->std::uint32_t          \
+    {                                                                        \
+        return expr;                                                         \
+    }                                                                        \
+    struct do_##name {                                                       \
+        constexpr auto operator()(std::uint32_t const acc) const noexcept    \
+            -> std::uint32_t                                                 \
+        {                                                                    \
+            return expr;                                                     \
+        }                                                                    \
+    };
+OPCODES
+#undef X
+
+auto op_invalid(std::uint32_t const acc) noexcept -> std::uint32_t
+{
+    return acc;
+}
+
+struct do_invalid {
+    constexpr auto operator()(std::uint32_t const acc) const noexcept
+        -> std::uint32_t
+    {
+        return acc;
+    }
+};
+
+struct function_entry {
+    std::uint8_t opcode;
+    auto (*handler)(std::uint32_t) noexcept -> std::uint32_t;
+};
+
+static constexpr function_entry functions[] = {
+#define X(code, name, expr) {code, &op_##name},
+    OPCODES
+#undef X
+};
+
+enum handler_id : std::size_t {
+#define X(code, name, expr) id_##name,
+    OPCODES
+#undef X
+};
+
+struct id_entry {
+    std::uint8_t opcode;
+    std::size_t  handler;
+};
+
+static constexpr id_entry ids[] = {
+#define X(code, name, expr) {code, id_##name},
+    OPCODES
+#undef X
+};
+
+struct handler_of {
+    constexpr auto operator()(function_entry const& x) const noexcept
+    {
+        return x.handler;
+    }
+};
+
+static constexpr auto function_map = sv::make_static_map_impl<>{}(
+    sv::raw_view(functions), &function_entry::opcode, handler_of{});
+
+static constexpr auto table = sv::make_dispatch_table(
+    sv::make_static_map_impl<>{}(
+        sv::raw_view(ids), &id_entry::opcode, &id_entry::handler),
+#define X(code, name, expr) do_##name{},
+    OPCODES
+#undef X
+        do_invalid{});
+
+auto make_program(std::size_t const n) -> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> opcodes = {
+#define X(code, name, expr) code,
+        OPCODES
+#undef X
+            0x7f};
+    std::mt19937                          gen{12345};
+    std::uniform_int_distribution<size_t> dist{0, opcodes.size() - 1};
+    std::vector<std::uint8_t>             program(n);
+    for (auto& x : program) {
+        x = opcodes[dist(gen)];
+    }
+    return program;
+}
+
+template <class Step>
+auto run(benchmark::State& state, Step step)
+{
+    auto const program = make_program(4096);
+    for (auto _ : state) {
+        std::uint32_t acc = 1;
+        for (auto const op : program) {
+            acc = step(op, acc);
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * program.size()));
+}
+
+auto benchmark_switch(benchmark::State& state)
+{
+    run(state, [](std::uint8_t const op, std::uint32_t const acc) {
+        switch (op) {
+#define X(code, name, expr)                                                  \
+    case code: return static_cast<std::uint32_t>(expr);
+            OPCODES
+#undef X
+        default: return acc;
+        }
+    });
+}
+
+auto benchmark_function_pointers(benchmark::State& state)
+{
+    run(state, [](std::uint8_t const op, std::uint32_t const acc) {
+        auto const* const x = function_map.find(op);
+        return x == nullptr ? op_invalid(acc) : x->handler(acc);
+    });
+}
+
+auto benchmark_dispatch_table(benchmark::State& state)
+{
+    run(state, [](std::uint8_t const op, std::uint32_t const acc) {
+        return table(op, acc);
+    });
+}
+
+BENCHMARK(benchmark_switch);
+BENCHMARK(benchmark_function_pointers);
+BENCHMARK(benchmark_dispatch_table);
+
+BENCHMARK_MAIN();
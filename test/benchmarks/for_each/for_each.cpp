@@ -0,0 +1,129 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Sums flatten and through views. Compares external iteration, which calls
+// unsafe_at for every index, with for_each, which uses the native loops of
+// the adaptors, and with hand-written loops.
+
+#include <cstdint>
+#include <numeric>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/chunk.hpp>
+#include <boost/static_views/flatten.hpp>
+#include <boost/static_views/for_each.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/through.hpp>
+
+namespace sv = boost::static_views;
+
+constexpr int size = 1 << 14;
+
+static std::int32_t numbers[size];
+static std::uint16_t permutation[size];
+
+auto init()
+{
+    std::iota(std::begin(numbers), std::end(numbers), 0);
+    for (int i = 0; i < size; ++i) {
+        permutation[i] = static_cast<std::uint16_t>((i * 7919) % size);
+    }
+}
+
+template <class V>
+auto sum_by_index(V const& xs) -> std::int32_t
+{
+    std::int32_t sum = 0;
+    auto const   n   = static_cast<typename V::index_type>(xs.size());
+    for (typename V::index_type i = 0; i < n; ++i) {
+        sum += xs.unsafe_at(i);
+    }
+    return sum;
+}
+
+struct add {
+    std::int32_t& sum;
+
+    auto operator()(std::int32_t const x) const noexcept -> void { sum += x; }
+};
+
+template <class V>
+auto sum_with_for_each(V const& xs) -> std::int32_t
+{
+    std::int32_t sum = 0;
+    sv::for_each(xs, add{sum});
+    return sum;
+}
+
+template <class F>
+auto run(benchmark::State& state, F f)
+{
+    init();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * size);
+}
+
+auto benchmark_flatten_by_index(benchmark::State& state)
+{
+    auto const xs = sv::flatten(sv::chunk(sv::raw_view(numbers), 64));
+    run(state, [&xs]() { return sum_by_index(xs); });
+}
+
+auto benchmark_flatten_for_each(benchmark::State& state)
+{
+    auto const xs = sv::flatten(sv::chunk(sv::raw_view(numbers), 64));
+    run(state, [&xs]() { return sum_with_for_each(xs); });
+}
+
+auto benchmark_flatten_by_hand(benchmark::State& state)
+{
+    run(state, []() {
+        std::int32_t sum = 0;
+        for (int i = 0; i < size; i += 64) {
+            for (int j = 0; j < 64; ++j) {
+                sum += numbers[i + j];
+            }
+        }
+        return sum;
+    });
+}
+
+auto benchmark_through_by_index(benchmark::State& state)
+{
+    auto const xs =
+        sv::through(sv::raw_view(numbers), sv::raw_view(permutation));
+    run(state, [&xs]() { return sum_by_index(xs); });
+}
+
+auto benchmark_through_for_each(benchmark::State& state)
+{
+    auto const xs =
+        sv::through(sv::raw_view(numbers), sv::raw_view(permutation));
+    run(state, [&xs]() { return sum_with_for_each(xs); });
+}
+
+auto benchmark_through_by_hand(benchmark::State& state)
+{
+    run(state, []() {
+        std::int32_t sum = 0;
+        for (auto const i : permutation) {
+            sum += numbers[i];
+        }
+        return sum;
+    });
+}
+
+BENCHMARK(benchmark_flatten_by_index);
+BENCHMARK(benchmark_flatten_for_each);
+BENCHMARK(benchmark_flatten_by_hand);
+BENCHMARK(benchmark_through_by_index);
+BENCHMARK(benchmark_through_for_each);
+BENCHMARK(benchmark_through_by_hand);
+
+BENCHMARK_MAIN();
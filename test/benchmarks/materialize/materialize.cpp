@@ -0,0 +1,96 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Sums a compile-time pipeline of transform, drop and through, either
+// lazily or after materialising it into a std::array.
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/drop.hpp>
+#include <boost/static_views/for_each.hpp>
+#include <boost/static_views/materialize.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/through.hpp>
+#include <boost/static_views/transform.hpp>
+
+namespace sv = boost::static_views;
+
+constexpr int size = 1 << 10;
+
+struct tables {
+    std::int32_t  data[size + 2];
+    std::uint16_t proxy[size];
+};
+
+constexpr auto make_tables() -> tables
+{
+    tables t{};
+    for (int i = 0; i < size + 2; ++i) {
+        t.data[i] = i;
+    }
+    for (int i = 0; i < size; ++i) {
+        t.proxy[i] = static_cast<std::uint16_t>((i * 541) % size);
+    }
+    return t;
+}
+
+static constexpr auto tables_ = make_tables();
+
+struct hash {
+    constexpr auto operator()(std::int32_t const x) const noexcept
+        -> std::int32_t
+    {
+        return (x * 31) ^ (x >> 3);
+    }
+};
+
+static constexpr auto pipeline = sv::through(
+    sv::drop_exactly(sv::transform(sv::raw_view(tables_.data), hash{}),
+        std::integral_constant<int, 2>{}),
+    sv::raw_view(tables_.proxy));
+
+static constexpr auto table = sv::materialize(pipeline);
+
+struct add {
+    std::int32_t& sum;
+
+    auto operator()(std::int32_t const x) const noexcept -> void { sum += x; }
+};
+
+template <class V>
+auto sum(V const& xs) -> std::int32_t
+{
+    std::int32_t result = 0;
+    sv::for_each(xs, add{result});
+    return result;
+}
+
+template <class F>
+auto run(benchmark::State& state, F f)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * size);
+}
+
+auto benchmark_lazy(benchmark::State& state)
+{
+    run(state, []() { return sum(pipeline); });
+}
+
+auto benchmark_materialized(benchmark::State& state)
+{
+    run(state, []() { return sum(sv::raw_view(table)); });
+}
+
+BENCHMARK(benchmark_lazy);
+BENCHMARK(benchmark_materialized);
+
+BENCHMARK_MAIN();
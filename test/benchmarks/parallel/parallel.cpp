@@ -0,0 +1,111 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Reduces and transforms a transform view over 100M ints with 1, 2, 4, ...
+// threads up to the number of cores, and compares with the sequential
+// algorithms.
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/parallel.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/reduce.hpp>
+#include <boost/static_views/transform.hpp>
+
+namespace sv = boost::static_views;
+
+constexpr int size = 100000000;
+
+static std::int32_t numbers[size];
+static std::int32_t output[size];
+
+auto init()
+{
+    static auto const done = []() {
+        for (int i = 0; i < size; ++i) {
+            numbers[i] = static_cast<std::int32_t>(
+                (std::int64_t{i} * 7919) % 1000003);
+            output[i] = 0;
+        }
+        return true;
+    }();
+    static_cast<void>(done);
+}
+
+struct mix {
+    auto operator()(std::int32_t const x) const noexcept -> std::int32_t
+    {
+        auto const y = static_cast<std::uint32_t>(x) * 0x9E3779B1u;
+        return static_cast<std::int32_t>(y ^ (y >> 15));
+    }
+};
+
+static auto const pipeline = sv::transform(sv::raw_view(numbers), mix{});
+
+auto thread_counts(benchmark::internal::Benchmark* b) -> void
+{
+    auto const cores = std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned n = 1; n < cores; n *= 2) {
+        b->Arg(n);
+    }
+    b->Arg(cores);
+}
+
+template <class F>
+auto run(benchmark::State& state, F f)
+{
+    init();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * size);
+}
+
+auto benchmark_reduce(benchmark::State& state)
+{
+    run(state, []() { return sv::reduce(pipeline, std::int64_t{0}); });
+}
+
+auto benchmark_parallel_reduce(benchmark::State& state)
+{
+    auto const threads = static_cast<unsigned>(state.range(0));
+    run(state, [threads]() {
+        return sv::parallel_reduce(
+            pipeline, std::int64_t{0}, std::plus<>{}, threads);
+    });
+}
+
+auto benchmark_transform_into(benchmark::State& state)
+{
+    run(state, []() {
+        auto* out = output;
+        sv::for_each(pipeline, [&out](std::int32_t const x) { *out++ = x; });
+        return out;
+    });
+}
+
+auto benchmark_parallel_transform_into(benchmark::State& state)
+{
+    auto const threads = static_cast<unsigned>(state.range(0));
+    run(state, [threads]() {
+        return sv::parallel_transform_into(
+            sv::raw_view(numbers), output, mix{}, threads);
+    });
+}
+
+BENCHMARK(benchmark_reduce)->UseRealTime();
+BENCHMARK(benchmark_parallel_reduce)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(benchmark_transform_into)->UseRealTime();
+BENCHMARK(benchmark_parallel_transform_into)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares lfold and reduce with std::accumulate, and min_element with
+// std::min_element, over contiguous views of 16K numbers.
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/lfold.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/reduce.hpp>
+
+namespace sv = boost::static_views;
+
+constexpr int size = 1 << 14;
+
+static std::int32_t integers[size];
+static float        floats[size];
+static double       doubles[size];
+
+auto init()
+{
+    for (int i = 0; i < size; ++i) {
+        integers[i] = (i * 7919) % 1000003;
+        floats[i]   = static_cast<float>(integers[i] % 1000) / 8.0f;
+        doubles[i]  = static_cast<double>(floats[i]);
+    }
+}
+
+template <class F>
+auto run(benchmark::State& state, F f)
+{
+    init();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * size);
+}
+
+template <class T>
+auto benchmark_accumulate(benchmark::State& state, T const (&xs)[size])
+{
+    run(state, [&xs]() {
+        return std::accumulate(std::begin(xs), std::end(xs), T{});
+    });
+}
+
+template <class T>
+auto benchmark_lfold(benchmark::State& state, T const (&xs)[size])
+{
+    auto const view = sv::raw_view(xs);
+    run(state, [&view]() { return sv::lfold(view, T{}); });
+}
+
+template <class T>
+auto benchmark_reduce(benchmark::State& state, T const (&xs)[size])
+{
+    auto const view = sv::raw_view(xs);
+    run(state, [&view]() { return sv::reduce(view, T{}); });
+}
+
+auto benchmark_std_min_element(benchmark::State& state)
+{
+    run(state, []() {
+        return std::min_element(std::begin(integers), std::end(integers))
+               - std::begin(integers);
+    });
+}
+
+auto benchmark_min_element(benchmark::State& state)
+{
+    auto const view = sv::raw_view(integers);
+    run(state, [&view]() { return sv::min_element(view); });
+}
+
+BENCHMARK_CAPTURE(benchmark_accumulate, int32, integers);
+BENCHMARK_CAPTURE(benchmark_lfold, int32, integers);
+BENCHMARK_CAPTURE(benchmark_reduce, int32, integers);
+BENCHMARK_CAPTURE(benchmark_accumulate, float, floats);
+BENCHMARK_CAPTURE(benchmark_lfold, float, floats);
+BENCHMARK_CAPTURE(benchmark_reduce, float, floats);
+BENCHMARK_CAPTURE(benchmark_accumulate, double, doubles);
+BENCHMARK_CAPTURE(benchmark_lfold, double, doubles);
+BENCHMARK_CAPTURE(benchmark_reduce, double, doubles);
+BENCHMARK(benchmark_std_min_element);
+BENCHMARK(benchmark_min_element);
+
+BENCHMARK_MAIN();
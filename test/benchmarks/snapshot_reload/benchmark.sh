@@ -0,0 +1,30 @@
+#!/bin/bash
+
+declare -r SRC_FILE="snapshot_reload.cpp"
+declare -r OUT_FILE="benchmark_result"
+
+compile ()
+{
+	declare -ir TABLE_SIZE=$1
+
+	g++ -O3 -march=native -std=c++14 -I../../../include \
+		-DNDEBUG \
+		-DTABLE_SIZE=$TABLE_SIZE \
+		-DBOOST_STATIC_VIEWS_DISABLE_CHECKS \
+		"$SRC_FILE" \
+		-lbenchmark -lpthread
+}
+
+benchmark_one ()
+{
+	declare -ir TABLE_SIZE=$1
+
+	compile $TABLE_SIZE || exit 1
+	./a.out --benchmark_format=console \
+	        --benchmark_out_format=csv \
+	        --benchmark_out="$OUT_FILE.$TABLE_SIZE.csv"
+}
+
+benchmark_one 1024
+benchmark_one 4096
+benchmark_one 16384
@@ -0,0 +1,244 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures read throughput of a runtime-built static_map held in an
+// atomic_snapshot while another thread continuously reloads it.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/atomic_snapshot.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/sequence_traits.hpp>
+#include <boost/static_views/static_map.hpp>
+
+#if !defined(TABLE_SIZE)
+#define TABLE_SIZE 4096
+#endif
+
+namespace sv = boost::static_views;
+
+using key_type    = std::uint32_t;
+using mapped_type = std::uint64_t;
+using field_type  = std::pair<key_type, mapped_type>;
+
+// Allows raw_view to be used with std::vector. The resulting view has
+// dynamic extent.
+namespace boost {
+namespace static_views {
+    template <class T>
+    struct sequence_traits<std::vector<T>>
+        : sequence_traits_default<sequence_traits<std::vector<T>>,
+              std::vector<T>> {
+
+      private:
+        using base = sequence_traits_default<sequence_traits<std::vector<T>>,
+            std::vector<T>>;
+
+      public:
+        using value_type = T;
+        using reference  = std::add_lvalue_reference_t<value_type>;
+        using typename base::size_type;
+
+        template <class S>
+        static constexpr auto size(S& xs) noexcept
+        {
+            return static_cast<size_type>(xs.size());
+        }
+
+        template <class S>
+        static constexpr decltype(auto) at(
+            S& xs, typename base::index_type const i) noexcept
+        {
+            return xs.data()[i];
+        }
+    };
+
+    template <class T>
+    struct sequence_traits<std::vector<T> const>
+        : sequence_traits<std::vector<T>> {
+        using value_type = T const;
+        using reference  = std::add_lvalue_reference_t<value_type>;
+    };
+} // namespace static_views
+} // namespace boost
+
+constexpr std::size_t table_size   = TABLE_SIZE;
+constexpr std::size_t bucket_count = 2 * table_size;
+constexpr std::size_t bucket_size  = 8;
+
+// Keys are i * K mod 2^32 for a random subset of i's. K is odd, so keys are
+// distinct.
+auto key_of(std::uint32_t const i) noexcept -> key_type
+{
+    return i * 2654435761u;
+}
+
+auto make_data(std::uint64_t const version) -> std::vector<field_type>
+{
+    std::vector<field_type> data(table_size);
+    for (std::uint32_t i = 0; i < table_size; ++i) {
+        data[i] = {key_of(i), version};
+    }
+    return data;
+}
+
+auto make_map(std::vector<field_type> const& data)
+{
+    return sv::make_static_map_impl<bucket_count, bucket_size>{}(
+        sv::raw_view(data), &field_type::first, &field_type::second);
+}
+
+struct table {
+    std::vector<field_type> data;
+    decltype(make_map(std::declval<std::vector<field_type> const&>())) map;
+
+    explicit table(std::uint64_t const version)
+        : data{make_data(version)}, map{make_map(data)}
+    {
+    }
+
+    table(table const&) = delete;
+    table(table&&)      = delete;
+};
+
+auto generate_lookup_keys(std::size_t const n, std::uint32_t const seed)
+    -> std::vector<key_type>
+{
+    std::mt19937                                 gen{seed};
+    std::uniform_int_distribution<std::uint32_t> dist{0, 2 * table_size};
+    std::vector<key_type>                        keys(n);
+    // Roughly half of the keys are present in the table.
+    for (auto& k : keys) {
+        k = key_of(dist(gen));
+    }
+    return keys;
+}
+
+// Publishes new tables in a loop until stopped.
+template <class Holder, class Publish>
+struct reloader {
+    std::atomic<bool> _done;
+    std::thread       _thread;
+    std::uint64_t     _reloads;
+
+    reloader(Holder& holder, Publish publish)
+        : _done{false}, _thread{}, _reloads{0}
+    {
+        _thread = std::thread{[this, &holder, publish] {
+            std::uint64_t version = 1;
+            while (!_done.load(std::memory_order_relaxed)) {
+                publish(holder, std::make_unique<table>(version++));
+            }
+            _reloads = version - 1;
+        }};
+    }
+
+    auto stop() -> std::uint64_t
+    {
+        _done = true;
+        _thread.join();
+        return _reloads;
+    }
+};
+
+template <class Holder, class Publish>
+auto make_reloader(Holder& holder, Publish publish)
+{
+    return std::make_unique<reloader<Holder, Publish>>(holder, publish);
+}
+
+// ---------------------------- atomic_snapshot ----------------------------- //
+
+sv::atomic_snapshot<table> snapshot{std::make_unique<table>(0)};
+
+auto publish_snapshot(
+    sv::atomic_snapshot<table>& holder, std::unique_ptr<table> x) -> void
+{
+    holder.publish(std::move(x));
+}
+
+template <bool Reload>
+auto benchmark_snapshot(benchmark::State& state)
+{
+    using reloader_ptr = decltype(make_reloader(snapshot, &publish_snapshot));
+    static reloader_ptr r;
+    if (Reload && state.thread_index() == 0) {
+        r = make_reloader(snapshot, &publish_snapshot);
+    }
+    auto const keys = generate_lookup_keys(
+        1024, static_cast<std::uint32_t>(state.thread_index()));
+
+    for (auto _ : state) {
+        for (auto k : keys) {
+            auto const g = snapshot.read();
+            benchmark::DoNotOptimize(g->map.find(k));
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * keys.size()));
+
+    if (Reload && state.thread_index() == 0) {
+        state.counters["reloads"] = static_cast<double>(r->stop());
+        r.reset();
+    }
+}
+
+// -------------------------- std::shared_ptr -------------------------------- //
+// For comparison: the "obvious" solution using atomic operations on
+// std::shared_ptr.
+
+std::shared_ptr<table const> shared = std::make_shared<table const>(0);
+
+auto publish_shared(
+    std::shared_ptr<table const>& holder, std::unique_ptr<table> x) -> void
+{
+    std::atomic_store(&holder, std::shared_ptr<table const>{std::move(x)});
+}
+
+template <bool Reload>
+auto benchmark_shared_ptr(benchmark::State& state)
+{
+    using reloader_ptr = decltype(make_reloader(shared, &publish_shared));
+    static reloader_ptr r;
+    if (Reload && state.thread_index() == 0) {
+        r = make_reloader(shared, &publish_shared);
+    }
+    auto const keys = generate_lookup_keys(
+        1024, static_cast<std::uint32_t>(state.thread_index()));
+
+    for (auto _ : state) {
+        for (auto k : keys) {
+            auto const p = std::atomic_load(&shared);
+            benchmark::DoNotOptimize(p->map.find(k));
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * keys.size()));
+
+    if (Reload && state.thread_index() == 0) {
+        state.counters["reloads"] = static_cast<double>(r->stop());
+        r.reset();
+    }
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(benchmark_snapshot, false)
+    ->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_snapshot, true)
+    ->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_shared_ptr, false)
+    ->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_shared_ptr, true)
+    ->ThreadRange(1, 32)->UseRealTime();
+// clang-format on
+
+BENCHMARK_MAIN();
@@ -0,0 +1,120 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Point queries against 100K address ranges. Compares static_interval_map
+// with std::upper_bound over the records and with std::map::upper_bound.
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_interval_map.hpp>
+
+namespace sv = boost::static_views;
+
+struct network {
+    std::uint32_t first;
+    std::uint32_t last;
+    std::uint32_t id;
+};
+
+constexpr std::size_t number_of_ranges = 100000;
+
+struct table {
+    network xs[number_of_ranges];
+};
+
+// Ranges of up to 16K addresses separated by gaps of up to 16K addresses,
+// so about half of the queries miss.
+constexpr auto make_table() -> table
+{
+    table         t{};
+    std::uint32_t state = 12345;
+    std::uint32_t next  = 0;
+    for (std::size_t i = 0; i < number_of_ranges; ++i) {
+        state          = state * 1664525u + 1013904223u;
+        auto const gap = (state >> 8) & 0x3FFF;
+        state          = state * 1664525u + 1013904223u;
+        auto const length = (state >> 8) & 0x3FFF;
+        t.xs[i].first     = next + gap;
+        t.xs[i].last      = next + gap + length;
+        t.xs[i].id        = static_cast<std::uint32_t>(i);
+        next              = next + gap + length + 1;
+    }
+    return t;
+}
+
+static constexpr table networks = make_table();
+
+static constexpr auto map = sv::make_static_interval_map(
+    sv::raw_view(networks.xs), &network::first, &network::last, &network::id);
+
+auto make_queries(std::size_t const n) -> std::vector<std::uint32_t>
+{
+    std::mt19937                                 gen{12345};
+    std::uniform_int_distribution<std::uint32_t> address{
+        0, networks.xs[number_of_ranges - 1].last};
+    std::vector<std::uint32_t> queries;
+    for (std::size_t i = 0; i < n; ++i) {
+        queries.push_back(address(gen));
+    }
+    return queries;
+}
+
+template <class Lookup>
+auto run(benchmark::State& state, Lookup lookup)
+{
+    auto const queries = make_queries(4096);
+    for (auto _ : state) {
+        for (auto const x : queries) {
+            benchmark::DoNotOptimize(lookup(x));
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * queries.size()));
+}
+
+auto benchmark_upper_bound(benchmark::State& state)
+{
+    run(state, [](std::uint32_t const x) -> network const* {
+        auto const* const end = networks.xs + number_of_ranges;
+        auto const* const i   = std::upper_bound(networks.xs, end, x,
+            [](std::uint32_t const y, network const& n) {
+                return y < n.first;
+            });
+        if (i == networks.xs) return nullptr;
+        return x <= (i - 1)->last ? i - 1 : nullptr;
+    });
+}
+
+auto benchmark_map_upper_bound(benchmark::State& state)
+{
+    std::map<std::uint32_t, network const*> lows;
+    for (auto const& n : networks.xs) {
+        lows.emplace(n.first, &n);
+    }
+    run(state, [&lows](std::uint32_t const x) -> network const* {
+        auto i = lows.upper_bound(x);
+        if (i == lows.begin()) return nullptr;
+        --i;
+        return x <= i->second->last ? i->second : nullptr;
+    });
+}
+
+auto benchmark_static_interval_map(benchmark::State& state)
+{
+    run(state, [](std::uint32_t const x) { return map.find(x); });
+}
+
+BENCHMARK(benchmark_upper_bound);
+BENCHMARK(benchmark_map_upper_bound);
+BENCHMARK(benchmark_static_interval_map);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,131 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Routes request paths by longest matching prefix. Compares static_trie with
+// a linear scan over all prefixes and with std::map::upper_bound.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_trie.hpp>
+
+namespace sv = boost::static_views;
+
+static constexpr char const* prefixes[] = {"/", "/api/", "/api/v1/",
+    "/api/v1/users/", "/api/v1/users/me", "/api/v1/groups/",
+    "/api/v1/projects/", "/api/v1/search", "/api/v1/admin/",
+    "/api/v1/admin/audit", "/api/v2/", "/api/v2/users/", "/api/v2/groups/",
+    "/api/v2/projects/", "/api/v2/projects/archived", "/api/v2/search",
+    "/api/v2/stream/", "/api/v2/metrics", "/api/internal/",
+    "/api/internal/health", "/auth/", "/auth/login", "/auth/logout",
+    "/auth/oauth/", "/auth/oauth/github", "/auth/oauth/google",
+    "/static/", "/static/css/", "/static/js/", "/static/img/",
+    "/static/fonts/", "/assets/", "/assets/vendor/", "/docs/",
+    "/docs/api/", "/docs/guides/", "/blog/", "/blog/archive/", "/feeds/",
+    "/feeds/atom", "/feeds/rss", "/download/", "/download/nightly/",
+    "/download/stable/", "/u/", "/g/", "/p/", "/.well-known/",
+    "/.well-known/acme-challenge/", "/favicon.ico", "/robots.txt",
+    "/sitemap.xml", "/healthz", "/metrics", "/debug/", "/debug/pprof/",
+    "/ws/", "/ws/notifications", "/graphql", "/graphiql", "/webhooks/",
+    "/webhooks/github", "/webhooks/stripe", "/status"};
+
+struct identity {
+    constexpr auto operator()(char const* const x) const noexcept { return x; }
+};
+
+static constexpr auto trie = sv::make_static_trie_impl<1024>{}(
+    sv::raw_view(prefixes), identity{});
+
+auto make_paths(std::size_t const n) -> std::vector<std::string>
+{
+    static char const* const suffixes[] = {"", "x", "42", "index.html",
+        "42/details", "a/b/c/d/e/f", "?q=static+views"};
+    std::mt19937                          gen{12345};
+    std::uniform_int_distribution<size_t> prefix{
+        0, sizeof(prefixes) / sizeof(prefixes[0]) - 1};
+    std::uniform_int_distribution<size_t> suffix{
+        0, sizeof(suffixes) / sizeof(suffixes[0]) - 1};
+    std::vector<std::string>              paths;
+    for (std::size_t i = 0; i < n; ++i) {
+        paths.push_back(
+            std::string{prefixes[prefix(gen)]} + suffixes[suffix(gen)]);
+    }
+    return paths;
+}
+
+template <class Lookup>
+auto run(benchmark::State& state, Lookup lookup)
+{
+    auto const paths = make_paths(1024);
+    for (auto _ : state) {
+        for (auto const& path : paths) {
+            benchmark::DoNotOptimize(lookup(path));
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * paths.size()));
+}
+
+auto benchmark_linear_scan(benchmark::State& state)
+{
+    run(state, [](std::string const& path) {
+        char const* const* best   = nullptr;
+        std::size_t        length = 0;
+        for (auto const& prefix : prefixes) {
+            auto const n = std::strlen(prefix);
+            if (n >= length && path.compare(0, n, prefix) == 0) {
+                best   = &prefix;
+                length = n;
+            }
+        }
+        return best;
+    });
+}
+
+auto benchmark_map_upper_bound(benchmark::State& state)
+{
+    std::map<std::string, char const* const*> map;
+    for (auto const& prefix : prefixes) {
+        map.emplace(prefix, &prefix);
+    }
+    run(state, [&map](std::string const& path) -> char const* const* {
+        // The predecessor of path is either a prefix of it, or shares a
+        // common prefix with it which is the next candidate.
+        std::string query = path;
+        for (;;) {
+            auto i = map.upper_bound(query);
+            if (i == map.begin()) return nullptr;
+            --i;
+            auto const& key = i->first;
+            auto const  n   = std::min(key.size(), query.size());
+            std::size_t common = 0;
+            while (common < n && key[common] == query[common]) {
+                ++common;
+            }
+            if (common == key.size()) return i->second;
+            query.resize(common);
+        }
+    });
+}
+
+auto benchmark_static_trie(benchmark::State& state)
+{
+    run(state,
+        [](std::string const& path) { return trie.longest_prefix(path); });
+}
+
+BENCHMARK(benchmark_linear_scan);
+BENCHMARK(benchmark_map_upper_bound);
+BENCHMARK(benchmark_static_trie);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the byte-by-byte equal_c used throughout the examples with
+// string_equal for keys of 4 to 256 characters. Strings are equal, i.e. all
+// characters have to be compared, which is what happens on a successful
+// lookup.
+
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/string_equal.hpp>
+#include <boost/static_views/string_pool.hpp>
+
+namespace sv = boost::static_views;
+
+struct equal_c {
+    constexpr auto operator()(char const* const a, char const* const b) const
+        noexcept -> bool
+    {
+        std::size_t i = 0;
+        while (a[i] != '\0' && a[i] == b[i]) {
+            ++i;
+        }
+        return a[i] == b[i];
+    }
+};
+
+auto make_key(std::size_t const n) -> std::string
+{
+    std::string key(n, ' ');
+    for (std::size_t i = 0; i < n; ++i) {
+        key[i] = static_cast<char>('a' + i % 26);
+    }
+    return key;
+}
+
+template <class Equal, class Convert>
+auto run(benchmark::State& state, Equal equal, Convert convert)
+{
+    auto const a = make_key(static_cast<std::size_t>(state.range(0)));
+    auto const b = a;
+    auto       x = convert(a);
+    auto       y = convert(b);
+    for (auto _ : state) {
+        // Keeps the compiler from hoisting the comparison out of the loop.
+        benchmark::DoNotOptimize(x);
+        benchmark::DoNotOptimize(y);
+        benchmark::DoNotOptimize(equal(x, y));
+    }
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * a.size()));
+}
+
+auto as_c_str(std::string const& s) noexcept { return s.c_str(); }
+
+auto as_pooled(std::string const& s) noexcept
+{
+    return sv::pooled_string{s.data(), s.size()};
+}
+
+auto benchmark_equal_c(benchmark::State& state)
+{
+    run(state, equal_c{}, &as_c_str);
+}
+
+auto benchmark_string_equal_c_str(benchmark::State& state)
+{
+    run(state, sv::string_equal{}, &as_c_str);
+}
+
+auto benchmark_string_equal_pooled(benchmark::State& state)
+{
+    run(state, sv::string_equal{}, &as_pooled);
+}
+
+// clang-format off
+#define KEY_LENGTHS \
+    ->Arg(4)->Arg(7)->Arg(8)->Arg(15)->Arg(16)->Arg(31)->Arg(32)->Arg(63) \
+    ->Arg(64)->Arg(100)->Arg(128)->Arg(255)->Arg(256)
+
+BENCHMARK(benchmark_equal_c) KEY_LENGTHS;
+BENCHMARK(benchmark_string_equal_c_str) KEY_LENGTHS;
+BENCHMARK(benchmark_string_equal_pooled) KEY_LENGTHS;
+// clang-format on
+
+BENCHMARK_MAIN();
@@ -0,0 +1,37 @@
+#!/bin/bash
+
+declare -r SRC_FILE="string_pool.cpp"
+declare -r OUT_FILE="benchmark_result"
+
+compile ()
+{
+	g++ -O3 -march=native -std=c++14 -I../../../include \
+		-DNDEBUG \
+		-DBOOST_STATIC_VIEWS_DISABLE_CHECKS \
+		"$SRC_FILE" \
+		-lbenchmark -lpthread
+}
+
+# Lookup latency for both layouts.
+latency ()
+{
+	./a.out --benchmark_format=console \
+	        --benchmark_out_format=csv \
+	        --benchmark_out="$OUT_FILE.csv"
+}
+
+# Cache misses of the cold lookups, if perf is available.
+cache_misses ()
+{
+	command -v perf > /dev/null || return 0
+	for layout in pointer pooled; do
+		perf stat -e cache-misses,L1-dcache-load-misses \
+			-o "$OUT_FILE.$layout.perf" \
+			./a.out --benchmark_filter="benchmark_${layout}_cold/64" \
+			> /dev/null
+	done
+}
+
+compile || exit 1
+latency
+cache_misses
@@ -0,0 +1,231 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares lookups in a static_map whose keys and values are `char const*`
+// string literals with lookups in one built on top of a string_pool.
+//
+// The "cold" variants evict the tables from the cache before every batch of
+// lookups, which is where the contiguous layout is supposed to pay off.
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+#include <boost/static_views/string_pool.hpp>
+
+namespace sv = boost::static_views;
+
+// clang-format off
+#define ELEMENTS(X) \
+    X("hydrogen", "H") \
+    X("helium", "He") \
+    X("lithium", "Li") \
+    X("beryllium", "Be") \
+    X("boron", "B") \
+    X("carbon", "C") \
+    X("nitrogen", "N") \
+    X("oxygen", "O") \
+    X("fluorine", "F") \
+    X("neon", "Ne") \
+    X("sodium", "Na") \
+    X("magnesium", "Mg") \
+    X("aluminium", "Al") \
+    X("silicon", "Si") \
+    X("phosphorus", "P") \
+    X("sulfur", "S") \
+    X("chlorine", "Cl") \
+    X("argon", "Ar") \
+    X("potassium", "K") \
+    X("calcium", "Ca") \
+    X("scandium", "Sc") \
+    X("titanium", "Ti") \
+    X("vanadium", "V") \
+    X("chromium", "Cr") \
+    X("manganese", "Mn") \
+    X("iron", "Fe") \
+    X("cobalt", "Co") \
+    X("nickel", "Ni") \
+    X("copper", "Cu") \
+    X("zinc", "Zn") \
+    X("gallium", "Ga") \
+    X("germanium", "Ge") \
+    X("arsenic", "As") \
+    X("selenium", "Se") \
+    X("bromine", "Br") \
+    X("krypton", "Kr") \
+    X("rubidium", "Rb") \
+    X("strontium", "Sr") \
+    X("yttrium", "Y") \
+    X("zirconium", "Zr") \
+    X("niobium", "Nb") \
+    X("molybdenum", "Mo") \
+    X("technetium", "Tc") \
+    X("ruthenium", "Ru") \
+    X("rhodium", "Rh") \
+    X("palladium", "Pd") \
+    X("silver", "Ag") \
+    X("cadmium", "Cd") \
+    X("indium", "In") \
+    X("tin", "Sn") \
+    X("antimony", "Sb") \
+    X("tellurium", "Te") \
+    X("iodine", "I") \
+    X("xenon", "Xe") \
+    X("caesium", "Cs") \
+    X("barium", "Ba") \
+    X("lanthanum", "La") \
+    X("cerium", "Ce") \
+    X("praseodymium", "Pr") \
+    X("neodymium", "Nd") \
+    X("promethium", "Pm") \
+    X("samarium", "Sm") \
+    X("europium", "Eu") \
+    X("gadolinium", "Gd")
+// clang-format on
+
+constexpr std::size_t bucket_count = 128;
+constexpr std::size_t bucket_size  = 4;
+
+// ------------------------------ char const* ------------------------------ //
+
+struct equal_c {
+    constexpr auto operator()(char const* const a, char const* const b) const
+        noexcept -> bool
+    {
+        std::size_t i = 0;
+        while (a[i] != '\0' && a[i] == b[i]) {
+            ++i;
+        }
+        return a[i] == b[i];
+    }
+};
+
+using pointer_pair = std::pair<char const*, char const*>;
+
+struct get_second {
+    constexpr auto operator()(pointer_pair const& x) const noexcept
+    {
+        return x.second;
+    }
+};
+
+// The trailing empty entry keeps both tables the same, see below.
+#define AS_PAIR(key, value) {key, value},
+static constexpr pointer_pair pointer_data[] = {ELEMENTS(AS_PAIR){"", ""}};
+#undef AS_PAIR
+
+static constexpr auto pointer_map =
+    sv::make_static_map_impl<bucket_count, bucket_size>{}(
+        sv::raw_view(pointer_data), &pointer_pair::first, get_second{},
+        equal_c{});
+
+// ------------------------------ string_pool ------------------------------ //
+
+// ELEMENTS expands to a list with a trailing comma which is terminated by an
+// empty entry.
+#define AS_ARGS(key, value) key, value,
+static constexpr auto pool = sv::make_string_pool_with_values<bucket_count>(
+    ELEMENTS(AS_ARGS) "", "");
+#undef AS_ARGS
+
+static constexpr auto pool_map =
+    sv::make_static_map_impl<bucket_count, bucket_size>{}(
+        sv::raw_view(pool.entries()), pool.key_fn(), pool.value_fn());
+
+// ------------------------------- Benchmarks ------------------------------ //
+
+// Roughly 3/4 of the keys are present in the tables.
+auto generate_lookup_keys(std::size_t const n) -> std::vector<std::string>
+{
+#define AS_STRING(key, value) key, key "x",
+    static char const* const candidates[] = {ELEMENTS(AS_STRING)};
+#undef AS_STRING
+    std::mt19937                               gen{12345};
+    std::uniform_int_distribution<std::size_t> dist{
+        0, 2 * sizeof(candidates) / sizeof(candidates[0]) - 1};
+    std::vector<std::string> keys(n);
+    for (auto& k : keys) {
+        auto const i = dist(gen);
+        k = candidates[i / 2];
+        if (i % 4 == 3) k += "x";
+    }
+    return keys;
+}
+
+// Evicts (most of) the cache hierarchy. This is slow compared to the lookups,
+// so cold benchmarks run a fixed number of iterations.
+auto evict_caches() -> void
+{
+    static std::vector<std::uint64_t> buffer(32 * 1024 * 1024 / 8);
+    for (auto& x : buffer) {
+        benchmark::DoNotOptimize(++x);
+    }
+}
+
+template <class Find>
+auto run(benchmark::State& state, Find find, bool const cold)
+{
+    auto const keys =
+        generate_lookup_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            evict_caches();
+            state.ResumeTiming();
+        }
+        for (auto const& k : keys) {
+            benchmark::DoNotOptimize(find(k.c_str()));
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+auto find_pointer(char const* const k) noexcept
+{
+    auto const* x = pointer_map.find(k);
+    return x == nullptr ? nullptr : x->second;
+}
+
+auto find_pooled(char const* const k) noexcept
+{
+    auto const* x = pool_map.find(k);
+    return x == nullptr ? nullptr : pool.value_fn()(*x).data();
+}
+
+auto benchmark_pointer_hot(benchmark::State& state)
+{
+    run(state, &find_pointer, false);
+}
+
+auto benchmark_pooled_hot(benchmark::State& state)
+{
+    run(state, &find_pooled, false);
+}
+
+auto benchmark_pointer_cold(benchmark::State& state)
+{
+    run(state, &find_pointer, true);
+}
+
+auto benchmark_pooled_cold(benchmark::State& state)
+{
+    run(state, &find_pooled, true);
+}
+
+// clang-format off
+BENCHMARK(benchmark_pointer_hot)->Arg(1024);
+BENCHMARK(benchmark_pooled_hot)->Arg(1024);
+BENCHMARK(benchmark_pointer_cold)->Arg(1)->Arg(16)->Arg(64)->Iterations(1000);
+BENCHMARK(benchmark_pooled_cold)->Arg(1)->Arg(16)->Arg(64)->Iterations(1000);
+// clang-format on
+
+BENCHMARK_MAIN();
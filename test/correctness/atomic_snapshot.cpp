@@ -0,0 +1,97 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <boost/static_views/atomic_snapshot.hpp>
+
+// Counts live instances and detects use-after-free.
+struct tracked {
+    static std::atomic<int> alive;
+
+    int value;
+    int canary;
+
+    explicit tracked(int const x) noexcept : value{x}, canary{0x5eed}
+    {
+        ++alive;
+    }
+    ~tracked()
+    {
+        canary = 0;
+        --alive;
+    }
+};
+std::atomic<int> tracked::alive{0};
+
+auto test_single_thread()
+{
+    {
+        boost::static_views::atomic_snapshot<tracked> snapshot{
+            std::make_unique<tracked>(1)};
+        BOOST_TEST_EQ(snapshot.read()->value, 1);
+        {
+            auto const g = snapshot.read();
+            snapshot.publish(std::make_unique<tracked>(2));
+            // g still refers to the old object which must not be freed.
+            BOOST_TEST_EQ(g->value, 1);
+            BOOST_TEST_EQ(g->canary, 0x5eed);
+            BOOST_TEST_EQ(tracked::alive.load(), 2);
+            // Nested guards see the new object.
+            BOOST_TEST_EQ(snapshot.read()->value, 2);
+            BOOST_TEST_EQ(snapshot.reclaim(), 1u);
+        }
+        BOOST_TEST_EQ(snapshot.reclaim(), 0u);
+        BOOST_TEST_EQ(tracked::alive.load(), 1);
+
+        // Without readers, old objects are freed right away.
+        snapshot.publish(std::make_unique<tracked>(3));
+        BOOST_TEST_EQ(tracked::alive.load(), 1);
+        BOOST_TEST_EQ((*snapshot.read()).value, 3);
+    }
+    BOOST_TEST_EQ(tracked::alive.load(), 0);
+}
+
+auto test_concurrent()
+{
+    {
+        boost::static_views::atomic_snapshot<tracked> snapshot{
+            std::make_unique<tracked>(0)};
+        std::atomic<bool>        done{false};
+        std::atomic<int>         errors{0};
+        std::vector<std::thread> readers;
+        for (auto t = 0; t < 4; ++t) {
+            readers.emplace_back([&] {
+                auto last = 0;
+                while (!done.load()) {
+                    auto const g = snapshot.read();
+                    // Values are published in increasing order.
+                    if (g->canary != 0x5eed || g->value < last) ++errors;
+                    last = g->value;
+                }
+            });
+        }
+        for (auto i = 1; i <= 20000; ++i) {
+            snapshot.publish(std::make_unique<tracked>(i));
+        }
+        done = true;
+        for (auto& t : readers)
+            t.join();
+        BOOST_TEST_EQ(errors.load(), 0);
+        BOOST_TEST_EQ(snapshot.reclaim(), 0u);
+        BOOST_TEST_EQ(tracked::alive.load(), 1);
+    }
+    BOOST_TEST_EQ(tracked::alive.load(), 0);
+}
+
+int main()
+{
+    test_single_thread();
+    test_concurrent();
+    return boost::report_errors();
+}
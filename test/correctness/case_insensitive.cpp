@@ -0,0 +1,121 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cctype>
+#include <string>
+#include <boost/static_views/case_insensitive.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+#include <boost/static_views/string_pool.hpp>
+
+using boost::static_views::case_insensitive_equal;
+using boost::static_views::case_insensitive_hash;
+using boost::static_views::pooled_string;
+
+static constexpr auto headers_pool =
+    boost::static_views::make_string_pool_with_values("Accept", "1",
+        "Accept-Encoding", "2", "Access-Control-Allow-Credentials", "3",
+        "Cache-Control", "4", "Connection", "5", "Content-Length", "6",
+        "Content-Type", "7", "Cookie", "8", "Host", "9", "TE", "10",
+        "Strict-Transport-Security", "11", "User-Agent", "12");
+
+static constexpr auto headers = boost::static_views::make_static_map_impl<>{}(
+    boost::static_views::raw_view(headers_pool.entries()),
+    headers_pool.key_fn(), headers_pool.value_fn(), case_insensitive_equal{},
+    case_insensitive_hash{});
+
+auto swap_case(std::string s) -> std::string
+{
+    for (auto& c : s) {
+        auto const x = static_cast<unsigned char>(c);
+        c = static_cast<char>(
+            std::isupper(x) ? std::tolower(x) : std::toupper(x));
+    }
+    return s;
+}
+
+auto test_equal()
+{
+    constexpr case_insensitive_equal equal{};
+    STATIC_ASSERT(equal(pooled_string{"Content-Type"},
+                      pooled_string{"content-TYPE"}),
+        "");
+    STATIC_ASSERT(!equal(pooled_string{"Content-Type"},
+                      pooled_string{"content-typ"}),
+        "");
+    STATIC_ASSERT(equal("Host", "HOST"), "");
+    STATIC_ASSERT(!equal("Host", "Hosts"), "");
+    // Only letters are folded, even though '@' and '`' or '[' and '{'
+    // differ in the same bit.
+    STATIC_ASSERT(!equal("@", "`"), "");
+    STATIC_ASSERT(!equal(pooled_string{"[@]"}, pooled_string{"{`}"}), "");
+
+    // Every length hits a different branch of the runtime comparison.
+    std::string const base =
+        "Abc-Def_Ghi@Jkl[Mno]Pqr`Stu{Vwx}Yz01-Abc-Def_Ghi";
+    for (std::size_t n = 0; n <= base.size(); ++n) {
+        auto const a = base.substr(0, n);
+        auto const b = swap_case(a);
+        BOOST_TEST(equal(pooled_string{a}, pooled_string{b}));
+        BOOST_TEST(equal(a.c_str(), b.c_str()));
+        for (std::size_t i = 0; i < n; ++i) {
+            auto c = b;
+            c[i]   = static_cast<char>(c[i] ^ 0x20);
+            BOOST_TEST_EQ(equal(pooled_string{a}, pooled_string{c}),
+                std::isalpha(static_cast<unsigned char>(a[i])) != 0);
+            c[i] = '\x80';
+            BOOST_TEST(!equal(pooled_string{a}, pooled_string{c}));
+        }
+    }
+}
+
+auto test_hash()
+{
+    constexpr case_insensitive_hash hash{};
+    STATIC_ASSERT(hash("Content-Type") == hash("CONTENT-TYPE"), "");
+    STATIC_ASSERT(
+        hash("Content-Type") == hash(pooled_string{"content-type"}), "");
+    STATIC_ASSERT(hash("Content-Type") != hash("Content-Typ"), "");
+    STATIC_ASSERT(hash("a") != hash(pooled_string{"a\0", 2}), "");
+
+    // Runtime (word-wise) and compile-time hashes agree.
+    constexpr char const* strings[] = {"", "a", "Host", "Cookie",
+        "Accept-Encoding", "Strict-Transport-Security",
+        "Access-Control-Allow-Credentials"};
+    constexpr std::size_t expected[] = {hash(strings[0]), hash(strings[1]),
+        hash(strings[2]), hash(strings[3]), hash(strings[4]),
+        hash(strings[5]), hash(strings[6])};
+    for (std::size_t i = 0; i < 7; ++i) {
+        std::string const s = strings[i];
+        BOOST_TEST_EQ(hash(s), expected[i]);
+        BOOST_TEST_EQ(hash(swap_case(s)), expected[i]);
+        BOOST_TEST_EQ(hash(s.c_str()), expected[i]);
+    }
+}
+
+auto test_map()
+{
+    STATIC_ASSERT(headers.at("content-length") == "6", "");
+    STATIC_ASSERT(headers.at("te") == "10", "");
+    STATIC_ASSERT(headers.find("Content-Lengths") == nullptr, "");
+
+    for (std::size_t i = 0; i < headers_pool.size(); ++i) {
+        auto const key = headers_pool.key(i);
+        auto const s   = swap_case(std::string{key.data(), key.size()});
+        BOOST_TEST(headers.find(s) == &headers_pool.entries()[i]);
+    }
+    BOOST_TEST(headers.at(std::string{"STRICT-transport-SECURITY"}) == "11");
+    BOOST_TEST(headers.find(std::string{"Strict-Transport-Securit"})
+               == nullptr);
+}
+
+int main()
+{
+    test_equal();
+    test_hash();
+    test_map();
+    return boost::report_errors();
+}
@@ -0,0 +1,116 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cstdint>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <boost/static_views/composite_key.hpp>
+#include <boost/static_views/hash_c.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+struct usb_device {
+    std::uint16_t vendor;
+    std::uint16_t product;
+    int           id;
+};
+
+static constexpr usb_device devices[] = {{0x046d, 0xc52b, 1},
+    {0x046d, 0xc077, 2}, {0x8087, 0x0024, 3}, {0x1d6b, 0x0002, 4},
+    {0x1d6b, 0x0003, 5}, {0x0bda, 0x8153, 6}, {0x05ac, 0x12a8, 7},
+    {0x0781, 0x5583, 8}, {0x046d, 0x0825, 9}, {0x8087, 0x0a2b, 10},
+    {0x0002, 0x1d6b, 11}, {0x0003, 0x1d6b, 12}};
+
+auto test_hash()
+{
+    using boost::static_views::hash_c;
+    constexpr int a = 1;
+    constexpr int b = 2;
+    STATIC_ASSERT(
+        hash_c{}(std::make_pair(1, 2)) == hash_c{}(std::make_tuple(1, 2)), "");
+    STATIC_ASSERT(
+        hash_c{}(std::make_tuple(1, 2)) == hash_c{}(std::tie(a, b)), "");
+    STATIC_ASSERT(
+        hash_c{}(std::make_pair(1, 2)) != hash_c{}(std::make_pair(2, 1)), "");
+    STATIC_ASSERT(noexcept(hash_c{}(
+                      std::declval<std::tuple<int, char const*> const&>())),
+        "");
+    STATIC_ASSERT(hash_c{}(std::make_tuple(1, "abc"))
+                      == hash_c{}(std::make_tuple(
+                             1, static_cast<char const*>("abc"))),
+        "");
+
+    // Small integers have identity hashes, the combination must spread
+    // them anyway.
+    std::set<std::size_t> low_bits;
+    for (std::uint16_t x = 0; x < 16; ++x) {
+        for (std::uint16_t y = 0; y < 16; ++y) {
+            low_bits.insert(hash_c{}(std::make_pair(x, y)) % 1024);
+        }
+    }
+    BOOST_TEST(low_bits.size() > 200);
+}
+
+auto test_map()
+{
+    using boost::static_views::composite_key;
+    static constexpr auto map = boost::static_views::make_static_map_impl<>{}(
+        boost::static_views::raw_view(devices),
+        composite_key(&usb_device::vendor, &usb_device::product),
+        &usb_device::id);
+
+    // The getter returns references to the elements, but lookups take
+    // values.
+    STATIC_ASSERT(
+        (std::is_same<decltype(map.key_fn()(devices[0])),
+            std::tuple<std::uint16_t const&, std::uint16_t const&>>::value),
+        "");
+    STATIC_ASSERT((std::is_same<decltype(map)::key_type,
+                      std::tuple<std::uint16_t, std::uint16_t>>::value),
+        "");
+    STATIC_ASSERT(decltype(map)::bucket_count() == 24, "");
+    STATIC_ASSERT(map.at({0x046d, 0xc077}) == 2, "");
+    STATIC_ASSERT(map.at({0x0003, 0x1d6b}) == 12, "");
+    STATIC_ASSERT(map.find({0x1d6b, 0x0004}) == nullptr, "");
+    STATIC_ASSERT(map.find({0x6b1d, 0x0002}) == nullptr, "");
+
+    // Braced keys are temporaries; they must outlive the lookup at runtime
+    // too.
+    BOOST_TEST_EQ(map.at({0x046d, 0xc077}), 2);
+    BOOST_TEST_EQ(map.at({0x0002, 0x1d6b}), 11);
+    BOOST_TEST(map.find({0x1d6b, 0x0004}) == nullptr);
+
+    std::uint16_t const vendor  = 0x8087;
+    std::uint16_t const product = 0x0a2b;
+    BOOST_TEST_EQ(map.at(std::tie(vendor, product)), 10);
+    BOOST_TEST_THROWS(map.at(std::tie(product, vendor)),
+        boost::static_views::key_not_found_error);
+
+    // Getters may also return by value.
+    struct id_parity {
+        constexpr auto operator()(usb_device const& x) const noexcept
+        {
+            return x.id % 2;
+        }
+    };
+    static constexpr auto parity =
+        boost::static_views::make_static_map_impl<>{}(
+        boost::static_views::raw_view(devices),
+        composite_key(&usb_device::vendor, id_parity{}), &usb_device::id);
+    STATIC_ASSERT((std::is_same<decltype(parity)::key_type,
+                      std::tuple<std::uint16_t, int>>::value),
+        "");
+    BOOST_TEST_EQ(parity.at({0x046d, 0}), 2);
+    BOOST_TEST_EQ(parity.at({0x046d, 1}), 1);
+}
+
+int main()
+{
+    test_hash();
+    test_map();
+    return boost::report_errors();
+}
@@ -0,0 +1,97 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <boost/static_views/drop.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/slice.hpp>
+#include <boost/static_views/take.hpp>
+#include <boost/static_views/through.hpp>
+#include <boost/static_views/transform.hpp>
+
+using boost::static_views::ContiguousView;
+
+static constexpr int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+struct negate {
+    constexpr auto operator()(int const x) const noexcept { return -x; }
+};
+
+auto test_detection()
+{
+    using boost::static_views::raw_view;
+    static constexpr auto xs = raw_view(numbers);
+    STATIC_ASSERT(ContiguousView<decltype(xs)>, "");
+    STATIC_ASSERT(xs.data() == numbers, "");
+
+    static constexpr auto dropped = boost::static_views::drop_exactly(xs, 3);
+    static constexpr auto taken   = boost::static_views::take_exactly(xs, 4);
+    static constexpr auto sliced  = boost::static_views::slice(xs, 2, 7);
+    STATIC_ASSERT(ContiguousView<decltype(dropped)>, "");
+    STATIC_ASSERT(ContiguousView<decltype(taken)>, "");
+    STATIC_ASSERT(ContiguousView<decltype(sliced)>, "");
+    STATIC_ASSERT(dropped.data() == numbers + 3, "");
+    STATIC_ASSERT(taken.data() == numbers, "");
+    STATIC_ASSERT(sliced.data() == numbers + 2, "");
+
+    // Adaptors of adaptors stay contiguous.
+    static constexpr auto nested = boost::static_views::drop_exactly(sliced, 1);
+    STATIC_ASSERT(ContiguousView<decltype(nested)>, "");
+    STATIC_ASSERT(nested.data() == numbers + 3, "");
+
+    std::array<int, 3> array = {{1, 2, 3}};
+    auto const         ys    = raw_view(array);
+    STATIC_ASSERT(ContiguousView<decltype(ys)>, "");
+    BOOST_TEST(ys.data() == array.data());
+
+    // Elements of tuples and of transformed or permuted views are not
+    // stored contiguously.
+    static constexpr std::tuple<int, int> tuple{1, 2};
+    static constexpr int indices[] = {2, 0};
+    STATIC_ASSERT(!ContiguousView<decltype(raw_view(tuple))>, "");
+    STATIC_ASSERT(!ContiguousView<decltype(
+                      boost::static_views::transform(xs, negate{}))>,
+        "");
+    STATIC_ASSERT(!ContiguousView<decltype(boost::static_views::through(
+                      xs, raw_view(indices)))>,
+        "");
+}
+
+auto test_iteration()
+{
+    auto const xs = boost::static_views::slice(
+        boost::static_views::raw_view(numbers), 2, 7);
+    STATIC_ASSERT(
+        (std::is_same<decltype(xs.begin()), int const*>::value), "");
+    BOOST_TEST(xs.begin() == numbers + 2);
+    BOOST_TEST(xs.end() == numbers + 7);
+
+    int sum = 0;
+    for (auto const x : xs) {
+        sum += x;
+    }
+    BOOST_TEST_EQ(sum, 3 + 4 + 5 + 6 + 7);
+
+    int copy[5] = {};
+    std::copy(xs.begin(), xs.end(), copy);
+    BOOST_TEST(std::memcmp(copy, xs.data(), sizeof(copy)) == 0);
+
+    // Non-contiguous views keep using view_iterator.
+    auto const ys = boost::static_views::transform(xs, negate{});
+    BOOST_TEST_EQ(*ys.begin(), -3);
+    BOOST_TEST_EQ(ys.end() - ys.begin(), 5);
+}
+
+int main()
+{
+    test_detection();
+    test_iteration();
+    return boost::report_errors();
+}
@@ -0,0 +1,138 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cstdint>
+#include <string>
+#include <boost/static_views/dispatch_table.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+#include <boost/static_views/string_interner.hpp>
+
+struct instruction {
+    std::uint8_t opcode;
+    int          handler;
+};
+
+static constexpr instruction instructions[] = {
+    {0x01, 0}, {0x02, 1}, {0x10, 2}, {0x11, 2}, {0x20, 7}};
+
+struct do_add {
+    constexpr auto operator()(int const a, int const b) const noexcept
+    {
+        return a + b;
+    }
+};
+
+struct do_sub {
+    constexpr auto operator()(int const a, int const b) const noexcept
+    {
+        return a - b;
+    }
+};
+
+struct do_mul {
+    constexpr auto operator()(int const a, int const b) const noexcept
+    {
+        return a * b;
+    }
+};
+
+struct do_invalid {
+    constexpr auto operator()(int const /*a*/, int const /*b*/) const noexcept
+    {
+        return -1;
+    }
+};
+
+static constexpr auto opcodes = boost::static_views::make_dispatch_table(
+    boost::static_views::make_static_map_impl<>{}(
+        boost::static_views::raw_view(instructions), &instruction::opcode,
+        &instruction::handler),
+    do_add{}, do_sub{}, do_mul{}, do_invalid{});
+
+auto test_opcodes()
+{
+    STATIC_ASSERT(decltype(opcodes)::size() == 3, "");
+    STATIC_ASSERT(opcodes.lookup_id(std::uint8_t{0x02}) == 1, "");
+    STATIC_ASSERT(opcodes.lookup_id(std::uint8_t{0x11}) == 2, "");
+    // Unknown keys and out of range ids go to the fallback.
+    STATIC_ASSERT(opcodes.lookup_id(std::uint8_t{0x03}) == 3, "");
+    STATIC_ASSERT(opcodes.lookup_id(std::uint8_t{0x20}) == 3, "");
+    STATIC_ASSERT(opcodes(std::uint8_t{0x01}, 3, 4) == 7, "");
+    STATIC_ASSERT(opcodes(std::uint8_t{0x10}, 3, 4) == 12, "");
+    STATIC_ASSERT(opcodes.call(1, 3, 4) == -1, "");
+    STATIC_ASSERT(noexcept(opcodes.lookup_id(std::uint8_t{})), "");
+
+    int acc = 1;
+    for (std::uint8_t const op : {0x01, 0x10, 0x02, 0x11, 0x7f}) {
+        acc = opcodes(op, acc, 2);
+    }
+    BOOST_TEST_EQ(acc, -1);
+}
+
+static constexpr auto commands_pool =
+    boost::static_views::make_string_pool("push", "pop", "clear");
+
+struct interpreter {
+    std::string stack;
+    int         errors;
+};
+
+struct do_push {
+    auto operator()(interpreter& x, char const c) const { x.stack += c; }
+};
+
+struct do_pop {
+    auto operator()(interpreter& x, char const /*c*/) const
+    {
+        if (x.stack.empty()) {
+            ++x.errors;
+        }
+        else {
+            x.stack.pop_back();
+        }
+    }
+};
+
+struct do_clear {
+    auto operator()(interpreter& x, char const /*c*/) const { x.stack.clear(); }
+};
+
+struct do_unknown {
+    auto operator()(interpreter& x, char const /*c*/) const { ++x.errors; }
+};
+
+auto test_commands()
+{
+    static constexpr auto commands = boost::static_views::make_dispatch_table(
+        boost::static_views::make_string_interner(commands_pool), do_push{},
+        do_pop{}, do_clear{}, do_unknown{});
+    STATIC_ASSERT(commands.lookup_id("clear") == 2, "");
+    STATIC_ASSERT(commands.lookup_id("peek") == 3, "");
+    STATIC_ASSERT((std::is_same<decltype(commands("pop",
+                                    std::declval<interpreter&>(), 'a')),
+                      void>::value),
+        "");
+
+    interpreter x{{}, 0};
+    commands("push", x, 'a');
+    commands("push", x, 'b');
+    commands(std::string{"pop"}.c_str(), x, ' ');
+    commands("push", x, 'c');
+    BOOST_TEST_EQ(x.stack, "ac");
+    commands("peek", x, ' ');
+    commands("clear", x, ' ');
+    commands("pop", x, ' ');
+    BOOST_TEST_EQ(x.stack, "");
+    BOOST_TEST_EQ(x.errors, 2);
+}
+
+int main()
+{
+    test_opcodes();
+    test_commands();
+    return boost::report_errors();
+}
@@ -0,0 +1,123 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <vector>
+#include <boost/static_views/chunk.hpp>
+#include <boost/static_views/flatten.hpp>
+#include <boost/static_views/for_each.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/through.hpp>
+#include <boost/static_views/transform.hpp>
+
+namespace sv = boost::static_views;
+
+static constexpr int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+static constexpr int indices[] = {11, 0, 5, 5, 2};
+
+struct sum_until_negative {
+    constexpr auto operator()(int& acc, int const x) const -> bool
+    {
+        if (x < 0) return false;
+        acc += x;
+        return true;
+    }
+};
+
+struct sum_first_n {
+    int n;
+
+    constexpr auto operator()(int& acc, int const x) -> bool
+    {
+        acc += x;
+        return --n != 0;
+    }
+};
+
+struct negate {
+    constexpr auto operator()(int const x) const noexcept { return -x; }
+};
+
+struct record {
+    std::vector<int>& xs;
+
+    auto operator()(int const x) const -> void { xs.push_back(x); }
+};
+
+template <class V>
+auto elements(V const& xs) -> std::vector<int>
+{
+    std::vector<int> ys;
+    sv::for_each(xs, record{ys});
+    return ys;
+}
+
+template <class V>
+auto elements_by_index(V const& xs) -> std::vector<int>
+{
+    std::vector<int> ys;
+    for (int i = 0; i < static_cast<int>(xs.size()); ++i) {
+        ys.push_back(xs.unsafe_at(i));
+    }
+    return ys;
+}
+
+auto test_fold_while()
+{
+    static constexpr int xs[] = {1, 2, -3, 4};
+    STATIC_ASSERT(sv::fold_while(sv::raw_view(xs), 0, sum_until_negative{})
+                      == 3,
+        "");
+    STATIC_ASSERT(
+        sv::fold_while(sv::raw_view(numbers), 0, sum_until_negative{}) == 78,
+        "");
+    STATIC_ASSERT(
+        sv::fold_while(sv::raw_view(numbers), 0, sum_first_n{4}) == 10, "");
+    STATIC_ASSERT(sv::for_each_while(sv::raw_view(numbers), negate{}), "");
+}
+
+auto test_adaptors()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+    static constexpr auto ys = sv::raw_view(indices);
+
+    // Native implementations visit the same elements in the same order as
+    // unsafe_at.
+    auto const flat = sv::flatten(sv::chunk(xs, 3));
+    BOOST_TEST(elements(flat) == elements_by_index(flat));
+    BOOST_TEST(elements(flat) == elements_by_index(xs));
+
+    auto const static_flat =
+        sv::flatten(sv::chunk(xs, std::integral_constant<int, 4>{}));
+    BOOST_TEST(elements(static_flat) == elements_by_index(xs));
+
+    auto const permuted = sv::through(xs, ys);
+    BOOST_TEST(elements(permuted) == elements_by_index(permuted));
+    BOOST_TEST((elements(permuted) == std::vector<int>{12, 1, 6, 6, 3}));
+
+    auto const negated = sv::transform(sv::through(xs, ys), negate{});
+    BOOST_TEST(elements(negated) == elements_by_index(negated));
+
+    // Early exit from inside a nested loop.
+    BOOST_TEST_EQ(sv::fold_while(flat, 0, sum_first_n{5}), 15);
+    BOOST_TEST_EQ(sv::fold_while(negated, 0, sum_until_negative{}), 0);
+
+    auto const chunks = sv::chunk(xs, 4);
+    BOOST_TEST_EQ(chunks.size(), 3u);
+    int count = 0;
+    sv::for_each(chunks, [&count](auto const& chunk) {
+        BOOST_TEST_EQ(chunk.size(), 4u);
+        BOOST_TEST_EQ(chunk.unsafe_at(0), 4 * count + 1);
+        ++count;
+    });
+    BOOST_TEST_EQ(count, 3);
+}
+
+int main()
+{
+    test_fold_while();
+    test_adaptors();
+    return boost::report_errors();
+}
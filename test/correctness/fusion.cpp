@@ -0,0 +1,148 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <boost/static_views/for_each.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/slice.hpp>
+#include <boost/static_views/through.hpp>
+
+namespace sv = boost::static_views;
+
+static constexpr int numbers[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static constexpr std::size_t odd[]   = {1, 3, 5, 7, 9, 11};
+static constexpr std::size_t order[] = {5, 0, 2, 2, 4, 1};
+
+template <class T>
+using plain_t = std::remove_cv_t<T>;
+
+template <std::size_t N>
+using int_c = std::integral_constant<int, N>;
+
+auto test_drop_take()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+
+    constexpr auto a = sv::drop_exactly(sv::drop_exactly(xs, 2), 3);
+    STATIC_ASSERT((std::is_same<plain_t<decltype(a)>,
+                      decltype(sv::drop_exactly(xs, 5))>::value),
+        "");
+    STATIC_ASSERT(a.size() == 7 && a[0] == 5, "");
+
+    constexpr auto b = sv::take_exactly(sv::take_exactly(xs, 9), 4);
+    STATIC_ASSERT((std::is_same<plain_t<decltype(b)>,
+                      decltype(sv::take_exactly(xs, 4))>::value),
+        "");
+    STATIC_ASSERT(b.size() == 4 && b[3] == 3, "");
+
+    // A drop of a take becomes a take of a drop.
+    constexpr auto c = sv::drop_exactly(sv::take_exactly(xs, 9), 4);
+    STATIC_ASSERT((std::is_same<plain_t<decltype(c)>,
+                      decltype(sv::take_exactly(sv::drop_exactly(xs, 4), 5))>::
+                          value),
+        "");
+    STATIC_ASSERT(c.size() == 5 && c[0] == 4 && c[4] == 8, "");
+
+    constexpr auto d = sv::drop_exactly(
+        sv::take_exactly(sv::drop_exactly(sv::take_exactly(xs, 11), 1), 9),
+        2);
+    STATIC_ASSERT((std::is_same<plain_t<decltype(d)>, plain_t<decltype(c)>>::
+                          value),
+        "");
+    STATIC_ASSERT(d.size() == 7 && d[0] == 3 && d[6] == 9, "");
+}
+
+auto test_static_extents()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+
+    constexpr auto a = sv::drop_exactly(sv::drop_exactly(xs, int_c<2>{}),
+        int_c<3>{});
+    STATIC_ASSERT(plain_t<decltype(a)>::extent() == 7, "");
+    STATIC_ASSERT((std::is_same<plain_t<decltype(a)>,
+                      decltype(sv::drop_exactly(xs, int_c<5>{}))>::value),
+        "");
+
+    // Lengths known at compile-time stay known.
+    constexpr auto b = sv::drop_exactly(
+        sv::take_exactly(xs, int_c<8>{}), int_c<3>{});
+    STATIC_ASSERT(plain_t<decltype(b)>::extent() == 5, "");
+    STATIC_ASSERT(b.size() == 5 && b[0] == 3, "");
+
+    static constexpr auto c = sv::take_exactly(
+        sv::drop_exactly(sv::raw_view(numbers), 3), int_c<4>{});
+    STATIC_ASSERT(plain_t<decltype(c)>::extent() == 4, "");
+    constexpr auto d = sv::take_exactly(c, int_c<2>{});
+    STATIC_ASSERT(plain_t<decltype(d)>::extent() == 2, "");
+    STATIC_ASSERT(d.size() == 2 && d[1] == 4, "");
+}
+
+auto test_slice()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+
+    constexpr auto a = sv::slice(sv::slice(sv::slice(xs, 1, 11), 2, 9), 1, 5);
+    STATIC_ASSERT((std::is_same<plain_t<decltype(a)>,
+                      plain_t<decltype(sv::slice(xs, 4, 8))>>::value),
+        "");
+    STATIC_ASSERT(a.size() == 4 && a[0] == 4 && a[3] == 7, "");
+
+    // Views owned by the chain are moved into the fused view, so its size
+    // does not depend on the length of the chain.
+    auto const b = sv::slice(
+        sv::drop_exactly(sv::slice(sv::raw_view(numbers), 1, 11), 2), 1, 5);
+    auto const c = sv::slice(sv::raw_view(numbers), 4, 8);
+    STATIC_ASSERT(sizeof(b) == sizeof(c), "");
+    BOOST_TEST_EQ(b.size(), 4u);
+    for (auto i = 0; i < 4; ++i) {
+        BOOST_TEST_EQ(b[i], c[i]);
+    }
+    BOOST_TEST_THROWS(b[4], sv::out_of_bound);
+}
+
+auto test_through()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+    static constexpr auto ps = sv::raw_view(odd);
+    static constexpr auto qs = sv::raw_view(order);
+
+    // xs is looked up through a single composed proxy.
+    constexpr auto a = sv::through(sv::through(xs, ps), qs);
+    STATIC_ASSERT((std::is_same<plain_t<decltype(a)>,
+                      plain_t<decltype(sv::through(xs, sv::through(ps, qs)))>>::
+                          value),
+        "");
+    STATIC_ASSERT(plain_t<decltype(a)>::extent() == 6, "");
+    STATIC_ASSERT(a.size() == 6, "");
+    STATIC_ASSERT(a[0] == 11 && a[1] == 1 && a[2] == 5 && a[3] == 5, "");
+    STATIC_ASSERT(a[4] == 9 && a[5] == 3, "");
+
+    // The parent and the proxy used to be ambiguous bases when they had the
+    // same type.
+    constexpr auto b = sv::through(qs, qs);
+    STATIC_ASSERT(b[0] == 1 && b[1] == 5 && b[5] == 0, "");
+
+    auto const c = sv::through(
+        sv::through(sv::through(xs, qs), qs), sv::raw_view(order));
+    auto sum = 0;
+    sv::for_each(c, [&sum](int const x) { sum += x; });
+    auto expected = 0;
+    for (auto const i : order) {
+        expected += numbers[order[order[i]]];
+    }
+    BOOST_TEST_EQ(c[0], numbers[order[order[order[0]]]]);
+    BOOST_TEST_EQ(sum, expected);
+}
+
+int main()
+{
+    test_drop_take();
+    test_static_extents();
+    test_slice();
+    test_through();
+    return boost::report_errors();
+}
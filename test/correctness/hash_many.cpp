@@ -0,0 +1,122 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/static_views/hash_c.hpp>
+#include <boost/static_views/hash_many.hpp>
+
+template <class T>
+auto test_integral()
+{
+    std::mt19937                     gen{12345};
+    std::uniform_int_distribution<T> dist{
+        std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+    // Not a multiple of 16 to exercise the tail.
+    std::vector<T> keys(53);
+    for (auto& x : keys)
+        x = dist(gen);
+    std::vector<std::size_t> hashes(keys.size());
+
+    boost::static_views::hash_many(keys.data(), keys.size(), hashes.data());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        BOOST_TEST_EQ(hashes[i], boost::static_views::hash_c{}(keys[i]));
+    }
+
+    boost::static_views::hash_n<4>(keys.data(), hashes.data());
+    boost::static_views::hash_n<8>(keys.data() + 4, hashes.data() + 4);
+    for (std::size_t i = 0; i < 12; ++i) {
+        BOOST_TEST_EQ(hashes[i], boost::static_views::hash_c{}(keys[i]));
+    }
+}
+
+auto test_fixed(std::size_t const width)
+{
+    std::mt19937                       gen{width};
+    std::uniform_int_distribution<int> length{0, static_cast<int>(width)};
+    // Includes bytes >= 128 to check that chars are treated as unsigned.
+    std::uniform_int_distribution<int> byte{1, 255};
+    std::size_t const                  n = 37;
+
+    std::vector<char> data(n * width, '\0');
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const l = static_cast<std::size_t>(length(gen));
+        for (std::size_t j = 0; j < l; ++j) {
+            data[i * width + j] = static_cast<char>(byte(gen));
+        }
+        // Garbage after an embedded NUL must be ignored.
+        if (l + 1 < width) data[i * width + l + 1] = 'x';
+    }
+
+    std::vector<std::size_t> hashes(n);
+    boost::static_views::hash_many(data.data(), width, n, hashes.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        std::string const key{data.data() + i * width,
+            data.data() + i * width + width};
+        BOOST_TEST_EQ(hashes[i], boost::static_views::hash_c{}(key.c_str()));
+    }
+
+    boost::static_views::hash_n<4>(data.data(), width, hashes.data());
+    boost::static_views::hash_n<8>(
+        data.data() + 4 * width, width, hashes.data() + 4);
+    boost::static_views::hash_n<16>(
+        data.data() + 12 * width, width, hashes.data() + 12);
+    for (std::size_t i = 0; i < 28; ++i) {
+        std::string const key{data.data() + i * width,
+            data.data() + i * width + width};
+        BOOST_TEST_EQ(hashes[i], boost::static_views::hash_c{}(key.c_str()));
+    }
+}
+
+// hash_n<N> must read exactly N keys and write exactly N hashes, even when
+// N is smaller than the vector width.
+template <std::size_t N>
+auto test_exact(std::size_t const width)
+{
+    std::vector<char> data(N * width, '\0');
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < (i + 1) % (width + 1); ++j) {
+            data[i * width + j] = static_cast<char>('a' + (i + j) % 26);
+        }
+    }
+    constexpr auto           sentinel = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> hashes(N + 8, sentinel);
+
+    boost::static_views::hash_n<N>(data.data(), width, hashes.data());
+    for (std::size_t i = 0; i < N; ++i) {
+        std::string const key{data.data() + i * width,
+            data.data() + i * width + width};
+        BOOST_TEST_EQ(hashes[i], boost::static_views::hash_c{}(key.c_str()));
+    }
+    for (std::size_t i = N; i < hashes.size(); ++i) {
+        BOOST_TEST_EQ(hashes[i], sentinel);
+    }
+}
+
+int main()
+{
+    // The same test is also built with -mavx2 and -mavx512f. Those builds
+    // can only run on CPUs which support the instructions.
+#if defined(__AVX512F__)
+    if (!__builtin_cpu_supports("avx512f")) return 0;
+#elif defined(__AVX2__)
+    if (!__builtin_cpu_supports("avx2")) return 0;
+#endif
+    test_integral<std::int8_t>();
+    test_integral<std::uint16_t>();
+    test_integral<int>();
+    test_integral<long long>();
+    test_integral<unsigned long>();
+    for (std::size_t width = 1; width <= 40; ++width) {
+        test_fixed(width);
+        test_exact<4>(width);
+        test_exact<8>(width);
+        test_exact<16>(width);
+    }
+    return boost::report_errors();
+}
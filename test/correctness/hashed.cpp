@@ -25,9 +25,39 @@ auto test_make()
     STATIC_ASSERT(boost::static_views::View<ys_type>, "");
 }
 
+auto test_statistics()
+{
+    struct hasher {
+        constexpr auto operator()(int const x) const noexcept
+        {
+            return static_cast<std::size_t>(x);
+        }
+    };
+
+    static constexpr int  xs_data[7] = {1, 2, 3, 4, 5, 6, 7};
+    static constexpr auto xs = boost::static_views::raw_view(xs_data);
+    static constexpr auto ys = boost::static_views::hashed<5, 3>(xs, hasher{});
+    // Buckets: {5}, {1, 6}, {2, 7}, {3}, {4}
+    static constexpr auto stats = ys.statistics();
+
+    STATIC_ASSERT(stats.element_count == 7, "");
+    STATIC_ASSERT(stats.bucket_count == 5, "");
+    STATIC_ASSERT(stats.empty_bucket_count == 0, "");
+    STATIC_ASSERT(stats.max_occupancy == 2, "");
+    STATIC_ASSERT(stats.occupancy_histogram[0] == 0, "");
+    STATIC_ASSERT(stats.occupancy_histogram[1] == 3, "");
+    STATIC_ASSERT(stats.occupancy_histogram[2] == 2, "");
+    STATIC_ASSERT(stats.occupancy_histogram[3] == 0, "");
+    STATIC_ASSERT(stats.max_probe_length == 2, "");
+    STATIC_ASSERT(stats.total_probe_length == 9, "");
+    STATIC_ASSERT(stats.load_factor() == 7.0 / 5.0, "");
+    STATIC_ASSERT(stats.mean_probe_length() == 9.0 / 7.0, "");
+    STATIC_ASSERT(stats.bytes == sizeof(ys), "");
+}
 
 int main()
 {
     test_make();
+    test_statistics();
     return boost::report_errors();
 }
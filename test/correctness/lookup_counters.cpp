@@ -0,0 +1,88 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <thread>
+#include <utility>
+#include <boost/static_views/lookup_counters.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+using value_type = std::pair<int const, char const*>;
+static constexpr value_type map_data[] = {
+    {5, "apple"}, {8, "pear"}, {0, "banana"}, {2, "plum"}};
+
+auto test_disabled()
+{
+    // The default policy keeps lookups constexpr.
+    static constexpr auto cmap = boost::static_views::make_static_map_impl<
+        0, 0, boost::static_views::no_lookup_counters>{}(
+        boost::static_views::raw_view(map_data), &value_type::first,
+        &value_type::second);
+    STATIC_ASSERT(cmap.find(8) == &map_data[1], "");
+    STATIC_ASSERT(cmap.find(10) == nullptr, "");
+}
+
+auto test_counters()
+{
+    struct tag;
+    using counters = boost::static_views::lookup_counters<tag>;
+
+    // All keys land in a single bucket, so the number of key_equal calls is
+    // predictable.
+    struct hasher {
+        constexpr auto operator()(int const) const noexcept -> std::size_t
+        {
+            return 0;
+        }
+    };
+
+    static constexpr auto cmap =
+        boost::static_views::make_packed_static_map_impl<1, counters>{}(
+            boost::static_views::raw_view(map_data), &value_type::first,
+            &value_type::second, std::equal_to<>{}, hasher{});
+
+    BOOST_TEST_EQ(cmap.find(5), &map_data[0]); // 1 comparison
+    BOOST_TEST_EQ(cmap.find(2), &map_data[3]); // 4 comparisons
+    BOOST_TEST_EQ(cmap.find(7), nullptr);      // 4 comparisons
+
+    auto stats = counters::collect();
+    BOOST_TEST_EQ(stats.lookups, 3u);
+    BOOST_TEST_EQ(stats.hits, 2u);
+    BOOST_TEST_EQ(stats.key_equal_calls, 9u);
+    BOOST_TEST_EQ(stats.mean_probes(), 3.0);
+
+    // Counters of other threads are aggregated too, including the ones which
+    // have already finished.
+    std::thread worker{[] {
+        for (auto i = 0; i < 10; ++i) {
+            if (cmap.find(8) != &map_data[1]) std::terminate();
+        }
+    }};
+    worker.join();
+    stats = counters::collect();
+    BOOST_TEST_EQ(stats.lookups, 13u);
+    BOOST_TEST_EQ(stats.hits, 12u);
+    BOOST_TEST_EQ(stats.key_equal_calls, 29u);
+
+    counters::reset();
+    stats = counters::collect();
+    BOOST_TEST_EQ(stats.lookups, 0u);
+    BOOST_TEST_EQ(cmap.count(0), 1u);
+    stats = counters::collect();
+    BOOST_TEST_EQ(stats.lookups, 1u);
+    BOOST_TEST_EQ(stats.hit_rate(), 1.0);
+
+    // Counters are per tag.
+    BOOST_TEST_EQ(
+        boost::static_views::lookup_counters<void>::collect().lookups, 0u);
+}
+
+int main()
+{
+    test_disabled();
+    test_counters();
+    return boost::report_errors();
+}
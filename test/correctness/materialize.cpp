@@ -0,0 +1,77 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <array>
+#include <type_traits>
+#include <boost/static_views/drop.hpp>
+#include <boost/static_views/errors.hpp>
+#include <boost/static_views/materialize.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/reduce.hpp>
+#include <boost/static_views/through.hpp>
+#include <boost/static_views/transform.hpp>
+
+namespace sv = boost::static_views;
+
+static constexpr int           numbers[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr unsigned char indices[] = {3, 0, 5, 5};
+
+struct square {
+    constexpr auto operator()(int const x) const noexcept { return x * x; }
+};
+
+auto test_materialize()
+{
+    // drop with a compile-time count has a static extent.
+    static constexpr auto table = sv::materialize(
+        sv::through(sv::drop_exactly(sv::transform(sv::raw_view(numbers),
+                                         square{}),
+                        std::integral_constant<int, 2>{}),
+            sv::raw_view(indices)));
+    STATIC_ASSERT((std::is_same<decltype(table),
+                      std::array<int, 4> const>::value),
+        "");
+    STATIC_ASSERT(table[0] == 36 && table[1] == 9, "");
+    STATIC_ASSERT(table[2] == 64 && table[3] == 64, "");
+
+    // The result can be viewed again, and is contiguous.
+    static constexpr auto view = sv::raw_view(table);
+    STATIC_ASSERT(sv::ContiguousView<std::remove_cv_t<decltype(view)>>, "");
+    STATIC_ASSERT(sv::reduce(view, 0) == 36 + 9 + 64 + 64, "");
+    STATIC_ASSERT(view[1] == 9, "");
+
+    static constexpr auto empty =
+        sv::materialize(sv::drop_exactly(sv::raw_view(numbers),
+            std::integral_constant<int, 8>{}));
+    STATIC_ASSERT(empty.size() == 0, "");
+}
+
+auto test_to_array()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+    static constexpr auto ys = sv::to_array<5>(sv::drop_exactly(xs, 3));
+    STATIC_ASSERT((std::is_same<decltype(ys),
+                      std::array<int, 5> const>::value),
+        "");
+    STATIC_ASSERT(ys[0] == 4 && ys[4] == 8, "");
+
+    // The extent of drop(xs, n) with a run-time n is only an upper bound.
+    auto const n = static_cast<int>(sizeof(numbers) / sizeof(int)) - 6;
+    BOOST_TEST_THROWS(
+        sv::materialize(sv::drop_exactly(xs, n)), sv::out_of_bound);
+    BOOST_TEST_THROWS(sv::to_array<3>(sv::drop_exactly(xs, n)),
+        sv::out_of_bound);
+    auto const zs = sv::to_array<6>(sv::drop_exactly(xs, n));
+    BOOST_TEST_EQ(zs[0], 3);
+    BOOST_TEST_EQ(zs[5], 8);
+}
+
+int main()
+{
+    test_materialize();
+    test_to_array();
+    return boost::report_errors();
+}
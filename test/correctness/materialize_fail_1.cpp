@@ -0,0 +1,18 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/static_views/drop.hpp>
+#include <boost/static_views/materialize.hpp>
+#include <boost/static_views/raw_view.hpp>
+
+static constexpr int numbers[] = {1, 2, 3, 4, 5};
+
+int main()
+{
+    // The view has 3 elements, but its extent is 5.
+    static constexpr auto xs = boost::static_views::materialize(
+        boost::static_views::drop_exactly(
+            boost::static_views::raw_view(numbers), 2));
+}
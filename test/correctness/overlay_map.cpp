@@ -0,0 +1,161 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/static_views/overlay_map.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+using value_type = std::pair<int const, int>;
+static constexpr value_type map_data[] = {{1, 10}, {2, 20}, {3, 30}};
+
+static constexpr auto cmap = boost::static_views::make_static_map_impl<>{}(
+    boost::static_views::raw_view(map_data), &value_type::first,
+    &value_type::second);
+
+auto test_single_thread()
+{
+    auto const overlay = boost::static_views::make_overlay_map<4>(cmap);
+    BOOST_TEST_EQ(overlay->capacity(), 4u);
+    BOOST_TEST_EQ(&overlay->base(), &cmap);
+
+    // Without overrides, the static map is used.
+    BOOST_TEST_EQ(overlay->at(2), 20);
+    BOOST_TEST_EQ(overlay->count(4), 0u);
+
+    // Override an existing key and add a new one.
+    BOOST_TEST(overlay->insert_or_assign(2, 200));
+    BOOST_TEST(overlay->insert_or_assign(4, 40));
+    BOOST_TEST_EQ(overlay->at(2), 200);
+    BOOST_TEST_EQ(overlay->at(4), 40);
+    BOOST_TEST_EQ(overlay->at(1), 10);
+    BOOST_TEST_EQ(cmap.at(2), 20);
+
+    // Tombstones hide entries of both the static map and the overlay.
+    BOOST_TEST(overlay->erase(1));
+    BOOST_TEST(overlay->erase(4));
+    BOOST_TEST_EQ(overlay->count(1), 0u);
+    BOOST_TEST_EQ(overlay->count(4), 0u);
+    BOOST_TEST_THROWS(overlay->at(1), boost::static_views::key_not_found_error);
+    BOOST_TEST(overlay->insert_or_assign(1, 100));
+    BOOST_TEST_EQ(overlay->at(1), 100);
+
+    // Three slots are taken (keys 1, 2, 4), so one more new key fits.
+    BOOST_TEST(overlay->insert_or_assign(5, 50));
+    BOOST_TEST(!overlay->insert_or_assign(6, 60));
+    BOOST_TEST(overlay->insert_or_assign(5, 55));
+    BOOST_TEST_EQ(overlay->at(5), 55);
+
+    overlay->clear();
+    BOOST_TEST_EQ(overlay->at(1), 10);
+    BOOST_TEST_EQ(overlay->at(2), 20);
+    BOOST_TEST_EQ(overlay->count(5), 0u);
+    BOOST_TEST(overlay->insert_or_assign(6, 60));
+    BOOST_TEST_EQ(overlay->at(6), 60);
+}
+
+auto test_concurrent_readers()
+{
+    auto const overlay = boost::static_views::make_overlay_map<8>(cmap);
+
+    std::atomic<bool>        done{false};
+    std::atomic<int>         errors{0};
+    std::vector<std::thread> readers;
+    for (auto t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                int x;
+                // Key 2 is always either 20 or a multiple of 1000 written
+                // below; key 3 is never touched.
+                if (!overlay->find(2, x) || (x != 20 && x % 1000 != 0))
+                    ++errors;
+                if (!overlay->find(3, x) || x != 30) ++errors;
+            }
+        });
+    }
+    for (auto i = 1; i <= 10000; ++i) {
+        overlay->insert_or_assign(2, 1000 * i);
+        if (i % 1000 == 0) overlay->clear();
+    }
+    done = true;
+    for (auto& t : readers)
+        t.join();
+    BOOST_TEST_EQ(errors.load(), 0);
+}
+
+struct c_string_equal {
+    constexpr auto operator()(char const* a, char const* b) const noexcept
+        -> bool
+    {
+        while (*a != '\0' && *a == *b) {
+            ++a;
+            ++b;
+        }
+        return *a == *b;
+    }
+};
+
+struct c_string_hash {
+    constexpr auto operator()(char const* a) const noexcept -> std::size_t
+    {
+        std::size_t h = 0;
+        for (; *a != '\0'; ++a)
+            h = 37 * h + static_cast<unsigned char>(*a);
+        return h;
+    }
+};
+
+// Keys are pointers, so the side table has to compare them like the static
+// map does, i.e. by contents rather than by address.
+auto test_runtime_keys()
+{
+    using entry = std::pair<char const*, int>;
+    static constexpr entry entries[] = {{"one", 1}, {"two", 2}, {"three", 3}};
+    static constexpr auto names =
+        boost::static_views::make_static_map_impl<>{}(
+            boost::static_views::raw_view(entries), &entry::first,
+            &entry::second, c_string_equal{}, c_string_hash{});
+
+    auto const overlay = boost::static_views::make_overlay_map<4>(names);
+
+    // The side table stores the pointers, so every inserted key needs a
+    // buffer of its own. Lookups use yet another buffer.
+    char two[] = "two", four[] = "four", one[] = "one", three[] = "three";
+    BOOST_TEST(overlay->insert_or_assign(two, 22));
+    BOOST_TEST(overlay->insert_or_assign(four, 4));
+    BOOST_TEST(overlay->erase(one));
+
+    char key[8];
+    std::strcpy(key, "two");
+    BOOST_TEST_EQ(overlay->at(key), 22);
+    std::strcpy(key, "four");
+    BOOST_TEST_EQ(overlay->at(key), 4);
+    std::strcpy(key, "one");
+    BOOST_TEST_EQ(overlay->count(key), 0u);
+    std::strcpy(key, "three");
+    BOOST_TEST_EQ(overlay->at(key), 3);
+
+    // Keys 'two', 'four', 'one' and 'three' fill the side table, but
+    // existing keys can still be overridden.
+    BOOST_TEST(overlay->insert_or_assign(three, 33));
+    BOOST_TEST(!overlay->insert_or_assign("five", 5));
+    BOOST_TEST(overlay->insert_or_assign("two", 222));
+    BOOST_TEST_EQ(overlay->at(key), 33);
+    std::strcpy(key, "two");
+    BOOST_TEST_EQ(overlay->at(key), 222);
+}
+
+int main()
+{
+    test_single_thread();
+    test_concurrent_readers();
+    test_runtime_keys();
+    return boost::report_errors();
+}
@@ -0,0 +1,153 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <utility>
+#include <boost/static_views/packed_hashed.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+struct hasher {
+    constexpr auto operator()(int const x) const noexcept
+    {
+        return static_cast<std::size_t>(x);
+    }
+};
+
+auto test_make()
+{
+    static constexpr int  xs_data[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    static constexpr auto xs_lvalue   = boost::static_views::raw_view(xs_data);
+
+    auto const ys = boost::static_views::packed_hashed<6>(xs_lvalue, hasher{});
+    using ys_type = std::remove_cv_t<decltype(ys)>;
+    STATIC_ASSERT(boost::static_views::View<ys_type>, "");
+    STATIC_ASSERT(ys_type::extent() == 6, "");
+}
+
+auto test_buckets()
+{
+    // All elements land in bucket 1, which would overflow any reasonably
+    // sized hashed<..., BucketSize>.
+    static constexpr int  xs_data[6] = {1, 4, 7, 10, 13, 3};
+    static constexpr auto xs = boost::static_views::raw_view(xs_data);
+    static constexpr auto ys =
+        boost::static_views::packed_hashed<3>(xs, hasher{});
+
+    STATIC_ASSERT(ys.bucket_size(0) == 1, "");
+    STATIC_ASSERT(ys.bucket_size(1) == 5, "");
+    STATIC_ASSERT(ys.bucket_size(2) == 0, "");
+    STATIC_ASSERT(ys[0].size() == 1 && ys[0][0] == 3, "");
+    // Order of elements within a bucket is preserved.
+    STATIC_ASSERT(ys[1][0] == 1 && ys[1][1] == 4 && ys[1][2] == 7
+                      && ys[1][3] == 10 && ys[1][4] == 13,
+        "");
+    STATIC_ASSERT(ys[4].size() == 5, "");
+    STATIC_ASSERT(ys[2].size() == 0, "");
+}
+
+auto test_duplicates()
+{
+    static constexpr int  xs_data[7] = {1, 4, 1, 2, 4, 2, 5};
+    static constexpr auto xs = boost::static_views::raw_view(xs_data);
+    static constexpr auto ys = boost::static_views::packed_hashed<3>(
+        xs, hasher{}, std::equal_to<>{});
+
+    STATIC_ASSERT(ys.bucket_size(0) == 0, "");
+    STATIC_ASSERT(ys.bucket_size(1) == 2, "");
+    STATIC_ASSERT(ys.bucket_size(2) == 2, "");
+    STATIC_ASSERT(ys[1][0] == 1 && ys[1][1] == 4, "");
+    STATIC_ASSERT(ys[2][0] == 2 && ys[2][1] == 5, "");
+}
+
+auto test_static_map()
+{
+    using value_type = std::pair<int const, char const*>;
+    static constexpr value_type map_data[] = {
+        {5, "apple"}, {8, "pear"}, {0, "banana"}, {2, "plum"}};
+
+    static constexpr auto cmap =
+        boost::static_views::make_packed_static_map_impl<2>{}(
+            boost::static_views::raw_view(map_data), &value_type::first,
+            &value_type::second);
+
+    STATIC_ASSERT(cmap.size() == 4, "");
+    STATIC_ASSERT(cmap.find(8) == &map_data[1], "");
+    STATIC_ASSERT(cmap.find(2) == &map_data[3], "");
+    STATIC_ASSERT(cmap.find(10) == nullptr, "");
+    STATIC_ASSERT(cmap.count(0) == 1, "");
+    BOOST_TEST_EQ(cmap.at(5), map_data[0].second);
+
+    // Buckets: {8, 0, 2}, {5}
+    static constexpr auto stats = cmap.statistics();
+    STATIC_ASSERT(stats.element_count == 4, "");
+    STATIC_ASSERT(stats.max_probe_length == 3, "");
+    STATIC_ASSERT(stats.occupancy_histogram[1] == 1, "");
+    STATIC_ASSERT(stats.occupancy_histogram[3] == 1, "");
+    STATIC_ASSERT(stats.total_probe_length == 7, "");
+    BOOST_TEST_EQ(cmap[0], map_data[2].second);
+}
+
+// Elements have no operator==, and keys are compared by absolute value, so
+// duplicate removal has to go through GetKey and KeyEqual.
+struct entry {
+    int         key;
+    char const* name;
+};
+
+struct entry_key {
+    constexpr auto operator()(entry const& x) const noexcept { return x.key; }
+};
+
+struct entry_name {
+    constexpr auto operator()(entry const& x) const noexcept { return x.name; }
+};
+
+struct equal_abs {
+    constexpr auto operator()(int const x, int const y) const noexcept
+    {
+        return (x < 0 ? -x : x) == (y < 0 ? -y : y);
+    }
+};
+
+struct hasher_abs {
+    constexpr auto operator()(int const x) const noexcept
+    {
+        return static_cast<std::size_t>(x < 0 ? -x : x);
+    }
+};
+
+auto test_custom_key_equal()
+{
+    static constexpr entry entries[] = {
+        {3, "three"}, {-4, "minus four"}, {-3, "minus three"}, {7, "seven"}};
+
+    static constexpr auto cmap =
+        boost::static_views::make_packed_static_map_impl<2>{}(
+            boost::static_views::raw_view(entries), entry_key{}, entry_name{},
+            equal_abs{}, hasher_abs{});
+    static constexpr auto hmap = boost::static_views::make_static_map_impl<>{}(
+        boost::static_views::raw_view(entries), entry_key{}, entry_name{},
+        equal_abs{}, hasher_abs{});
+
+    // -3 is a duplicate of 3 and is dropped.
+    STATIC_ASSERT(cmap.find(-3) == &entries[0], "");
+    STATIC_ASSERT(cmap.find(4) == &entries[1], "");
+    STATIC_ASSERT(cmap.find(5) == nullptr, "");
+    STATIC_ASSERT(hmap.find(-3) == &entries[0], "");
+    STATIC_ASSERT(hmap.find(-7) == &entries[3], "");
+    BOOST_TEST_EQ(cmap.at(3), entries[0].name);
+    BOOST_TEST_EQ(hmap.at(4), entries[1].name);
+}
+
+int main()
+{
+    test_make();
+    test_buckets();
+    test_duplicates();
+    test_static_map();
+    test_custom_key_equal();
+    return boost::report_errors();
+}
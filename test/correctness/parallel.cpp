@@ -0,0 +1,131 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <boost/static_views/parallel.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/take.hpp>
+#include <boost/static_views/transform.hpp>
+
+namespace sv = boost::static_views;
+
+// Several grains per worker.
+constexpr int size = 200003;
+
+static std::int32_t numbers[size];
+
+// Runs the workers one after another, so the first one steals all grains
+// of the others.
+struct serial_executor {
+    unsigned workers;
+
+    auto concurrency() const noexcept -> unsigned { return workers; }
+
+    template <class Function>
+    auto operator()(Function&& f) const -> void
+    {
+        for (unsigned i = 0; i < workers; ++i) {
+            f(i);
+        }
+    }
+};
+
+struct mark {
+    std::unique_ptr<std::atomic<int>[]>& visits;
+
+    auto operator()(std::int32_t const x) const -> void
+    {
+        visits[static_cast<std::size_t>(x)].fetch_add(1);
+    }
+};
+
+struct to_double {
+    auto operator()(std::int32_t const x) const noexcept -> double
+    {
+        return 1.0 / (1.0 + x);
+    }
+};
+
+struct throw_on_last {
+    auto operator()(std::int32_t const x) const -> void
+    {
+        if (x == size - 1) throw std::runtime_error{"last"};
+    }
+};
+
+template <class Executor>
+auto test_for_each(Executor const& executor, int const n)
+{
+    std::unique_ptr<std::atomic<int>[]> visits{new std::atomic<int>[size]};
+    for (int i = 0; i < size; ++i) {
+        visits[i].store(0);
+    }
+    sv::parallel_for_each(
+        sv::take_exactly(sv::raw_view(numbers), n), mark{visits}, executor);
+    for (int i = 0; i < size; ++i) {
+        BOOST_TEST_EQ(visits[i].load(), i < n ? 1 : 0);
+    }
+}
+
+auto test_for_each()
+{
+    for (auto const n : {0, 1, 1000, size}) {
+        test_for_each(sv::thread_executor{4}, n);
+        test_for_each(serial_executor{7}, n);
+    }
+    BOOST_TEST_THROWS(
+        sv::parallel_for_each(sv::raw_view(numbers), throw_on_last{}, 3),
+        std::runtime_error);
+}
+
+auto test_reduce()
+{
+    auto const xs       = sv::raw_view(numbers);
+    auto const expected = std::accumulate(
+        std::begin(numbers), std::end(numbers), std::int64_t{5});
+    BOOST_TEST_EQ(sv::parallel_reduce(xs, std::int64_t{5}), expected);
+    BOOST_TEST_EQ(sv::parallel_reduce(xs, std::int64_t{5}, std::plus<>{}, 3),
+        expected);
+    BOOST_TEST_EQ(sv::parallel_reduce(xs, std::int64_t{5}, std::plus<>{},
+                      serial_executor{5}),
+        expected);
+    BOOST_TEST_EQ(sv::parallel_reduce(sv::take_exactly(xs, 0), 5), 5);
+    BOOST_TEST_EQ(sv::parallel_reduce(sv::take_exactly(xs, 1), 5), 5);
+
+    // The grains do not depend on scheduling, so neither does rounding.
+    auto const ys = sv::transform(xs, to_double{});
+    auto const a  = sv::parallel_reduce(ys, 0.0, std::plus<>{}, 4);
+    auto const b =
+        sv::parallel_reduce(ys, 0.0, std::plus<>{}, serial_executor{4});
+    BOOST_TEST_EQ(a, b);
+}
+
+auto test_transform_into()
+{
+    std::vector<double> out(size + 1, -1.0);
+    auto const last = sv::parallel_transform_into(
+        sv::raw_view(numbers), out.begin(), to_double{}, 5);
+    BOOST_TEST(last == out.begin() + size);
+    for (int i = 0; i < size; ++i) {
+        BOOST_TEST_EQ(out[static_cast<std::size_t>(i)], 1.0 / (1.0 + i));
+    }
+    BOOST_TEST_EQ(out.back(), -1.0);
+}
+
+int main()
+{
+    std::iota(std::begin(numbers), std::end(numbers), 0);
+    test_for_each();
+    test_reduce();
+    test_transform_into();
+    return boost::report_errors();
+}
@@ -0,0 +1,79 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <functional>
+#include <memory>
+#include <random>
+#include <boost/static_views/hashed.hpp>
+#include <boost/static_views/parallel_hashed.hpp>
+#include <boost/static_views/raw_view.hpp>
+
+struct hasher {
+    constexpr auto operator()(int const x) const noexcept
+    {
+        return static_cast<std::size_t>(x);
+    }
+};
+
+static int xs_data[5000];
+
+template <class View1, class View2>
+auto check_same_layout(View1 const& xs, View2 const& ys)
+{
+    BOOST_TEST_EQ(xs.bucket_count(), ys.bucket_count());
+    for (std::size_t h = 0; h < xs.bucket_count(); ++h) {
+        auto const a = xs[h];
+        auto const b = ys[h];
+        BOOST_TEST_EQ(a.size(), b.size());
+        for (std::size_t i = 0; i < a.size() && i < b.size(); ++i) {
+            BOOST_TEST_EQ(&a[i], &b[i]);
+        }
+    }
+}
+
+auto test_layout()
+{
+    auto const xs = boost::static_views::raw_view(xs_data);
+    // Stack allocation is fine for such small views.
+    auto const expected = boost::static_views::hashed<1031, 32>(xs, hasher{});
+    for (unsigned threads : {1u, 2u, 3u, 8u, 0u}) {
+        auto const ys =
+            boost::static_views::parallel_hashed<1031, 32>(xs, hasher{}, threads);
+        check_same_layout(expected, *ys);
+    }
+}
+
+auto test_duplicates()
+{
+    auto const xs       = boost::static_views::raw_view(xs_data);
+    auto const expected = boost::static_views::hashed<97, 64>(
+        xs, hasher{}, std::equal_to<>{});
+    for (unsigned threads : {1u, 4u, 7u}) {
+        auto const ys = boost::static_views::parallel_hashed<97, 64>(
+            xs, hasher{}, std::equal_to<>{}, threads);
+        check_same_layout(expected, *ys);
+    }
+}
+
+auto test_full_bucket()
+{
+    auto const xs = boost::static_views::raw_view(xs_data);
+    BOOST_TEST_THROWS((boost::static_views::parallel_hashed<2, 1>(xs, hasher{}, 2)),
+        boost::static_views::full_bucket);
+}
+
+int main()
+{
+    std::mt19937                       gen{42};
+    std::uniform_int_distribution<int> dist{0, 1000};
+    for (auto& x : xs_data)
+        x = dist(gen);
+
+    test_layout();
+    test_duplicates();
+    test_full_bucket();
+    return boost::report_errors();
+}
@@ -0,0 +1,137 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <boost/static_views/chunk.hpp>
+#include <boost/static_views/flatten.hpp>
+#include <boost/static_views/lfold.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/reduce.hpp>
+#include <boost/static_views/take.hpp>
+#include <boost/static_views/through.hpp>
+#include <boost/static_views/transform.hpp>
+
+namespace sv = boost::static_views;
+
+static constexpr int numbers[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 9};
+static constexpr int indices[] = {11, 0, 5, 5, 2};
+
+struct is_odd {
+    constexpr auto operator()(int const x) const noexcept { return x % 2 != 0; }
+};
+
+struct negate {
+    constexpr auto operator()(int const x) const noexcept { return -x; }
+};
+
+struct greater {
+    constexpr auto operator()(int const x, int const y) const noexcept
+    {
+        return x > y;
+    }
+};
+
+auto test_folds()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+    STATIC_ASSERT(sv::lfold(xs, 0) == 53, "");
+    STATIC_ASSERT(sv::rfold(xs, 0) == 53, "");
+    STATIC_ASSERT(sv::lfold(xs, 0, std::minus<>{}) == -53, "");
+    // 3 - (1 - (4 - ... (9 - 0)))
+    STATIC_ASSERT(sv::rfold(xs, 0, std::minus<>{}) == -5, "");
+    STATIC_ASSERT(sv::lfold(sv::raw_view(indices), 1, std::multiplies<>{})
+                      == 11 * 0 * 5 * 5 * 2,
+        "");
+}
+
+auto test_reduce()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+    STATIC_ASSERT(sv::reduce(xs, 0) == 53, "");
+    STATIC_ASSERT(sv::reduce(xs, 100) == 153, "");
+    STATIC_ASSERT(sv::reduce(sv::transform(xs, negate{}), 0) == -53, "");
+    STATIC_ASSERT(sv::reduce(xs, 1, std::multiplies<>{}) == 4374000, "");
+    STATIC_ASSERT(
+        sv::reduce(sv::through(xs, sv::raw_view(indices)), 0) == 34, "");
+
+    // Every length around the number of accumulators.
+    std::array<std::int64_t, 300> ys{};
+    std::iota(std::begin(ys), std::end(ys), -100);
+    std::array<double, 300> zs{};
+    std::iota(std::begin(zs), std::end(zs), 0.5);
+    for (std::size_t n = 0; n <= ys.size(); ++n) {
+        auto const first = sv::raw_view(ys);
+        auto const view  = sv::take_exactly(first, static_cast<int>(n));
+        BOOST_TEST_EQ(sv::reduce(view, std::int64_t{7}),
+            std::accumulate(ys.begin(), ys.begin() + n, std::int64_t{7}));
+        BOOST_TEST_EQ(sv::reduce(sv::transform(view, std::negate<>{}), 0L),
+            -std::accumulate(ys.begin(), ys.begin() + n, 0L));
+        // The sums are exact, so the order of additions does not matter.
+        auto const doubles = sv::take_exactly(
+            sv::raw_view(zs), static_cast<int>(n));
+        BOOST_TEST_EQ(sv::reduce(doubles, 0.0),
+            std::accumulate(zs.begin(), zs.begin() + n, 0.0));
+    }
+
+    auto const flat = sv::flatten(sv::chunk(xs, 3));
+    BOOST_TEST_EQ(sv::reduce(flat, 0), 53);
+
+    // std::plus<std::uint8_t> wraps every partial sum, even though the
+    // accumulator is an int.
+    std::array<std::uint8_t, 40> bytes{};
+    bytes.fill(200);
+    BOOST_TEST_EQ(sv::reduce(sv::raw_view(bytes), 0, std::plus<std::uint8_t>{}),
+        std::accumulate(
+            bytes.begin(), bytes.end(), 0, std::plus<std::uint8_t>{}));
+}
+
+auto test_count_if()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+    STATIC_ASSERT(sv::count_if(xs, is_odd{}) == 9, "");
+    STATIC_ASSERT(sv::count_if(sv::transform(xs, negate{}), is_odd{}) == 9, "");
+    STATIC_ASSERT(sv::count_if(sv::raw_view(indices), is_odd{}) == 3, "");
+}
+
+auto test_min_max()
+{
+    static constexpr auto xs = sv::raw_view(numbers);
+    // Ties are broken by the first occurrence.
+    STATIC_ASSERT(sv::min_element(xs) == 1, "");
+    STATIC_ASSERT(sv::max_element(xs) == 5, "");
+    STATIC_ASSERT(sv::min_element(xs, greater{}) == 5, "");
+    STATIC_ASSERT(sv::max_element(xs, greater{}) == 1, "");
+    STATIC_ASSERT(sv::min_element(sv::transform(xs, negate{})) == 5, "");
+    STATIC_ASSERT(sv::min_element(sv::take_exactly(xs, 0)) == 0, "");
+
+    std::array<std::int16_t, 200> ys{};
+    for (std::size_t i = 0; i < ys.size(); ++i) {
+        ys[i] = static_cast<std::int16_t>((i * 37) % 101);
+    }
+    for (std::size_t n = 1; n <= ys.size(); ++n) {
+        auto const view =
+            sv::take_exactly(sv::raw_view(ys), static_cast<int>(n));
+        BOOST_TEST_EQ(sv::min_element(view),
+            std::min_element(ys.begin(), ys.begin() + n) - ys.begin());
+        BOOST_TEST_EQ(sv::max_element(view),
+            std::max_element(ys.begin(), ys.begin() + n) - ys.begin());
+        BOOST_TEST_EQ(sv::min_element(sv::transform(view, negate{})),
+            std::max_element(ys.begin(), ys.begin() + n) - ys.begin());
+    }
+}
+
+int main()
+{
+    test_folds();
+    test_reduce();
+    test_count_if();
+    test_min_max();
+    return boost::report_errors();
+}
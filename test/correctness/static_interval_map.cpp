@@ -0,0 +1,148 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cstdint>
+#include <string>
+#include <boost/static_views/drop.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_interval_map.hpp>
+
+struct network {
+    std::uint32_t first;
+    std::uint32_t last;
+    char const*   name;
+};
+
+static constexpr network networks[] = {{0x00000000, 0x00FFFFFF, "this"},
+    {0x0A000000, 0x0AFFFFFF, "private-10"},
+    {0x7F000000, 0x7FFFFFFF, "loopback"},
+    {0xA9FE0000, 0xA9FEFFFF, "link-local"},
+    {0xAC100000, 0xAC1FFFFF, "private-172"},
+    {0xC0A80000, 0xC0A8FFFF, "private-192"},
+    {0xE0000000, 0xEFFFFFFF, "multicast"},
+    {0xFFFFFFFF, 0xFFFFFFFF, "broadcast"}};
+
+static constexpr auto special = boost::static_views::make_static_interval_map(
+    boost::static_views::raw_view(networks), &network::first, &network::last,
+    &network::name);
+
+template <class Map>
+constexpr auto name_of(Map const& map, std::uint32_t const x) -> char const*
+{
+    auto const* const element = map.find(x);
+    return element == nullptr ? "" : element->name;
+}
+
+auto test_find()
+{
+    STATIC_ASSERT(special.size() == 8, "");
+    STATIC_ASSERT(special.find(0x00000000) == &networks[0], "");
+    STATIC_ASSERT(special.find(0x0A000000) == &networks[1], "");
+    STATIC_ASSERT(special.find(0x0AFFFFFF) == &networks[1], "");
+    STATIC_ASSERT(special.find(0x0B000000) == nullptr, "");
+    STATIC_ASSERT(special.find(0x09FFFFFF) == nullptr, "");
+    STATIC_ASSERT(special.find(0xC0A80101) == &networks[5], "");
+    STATIC_ASSERT(special.find(0xFFFFFFFE) == nullptr, "");
+    STATIC_ASSERT(special.find(0xFFFFFFFF) == &networks[7], "");
+    STATIC_ASSERT(special.count(0x7F000001) == 1, "");
+    STATIC_ASSERT(special.count(0x08080808) == 0, "");
+    STATIC_ASSERT(special.at(0xAC100001)[8] == '1', "");
+
+    BOOST_TEST_EQ(std::string{special.at(0xE00000FB)}, "multicast");
+    BOOST_TEST_EQ(std::string{name_of(special, 0xA9FE0001)}, "link-local");
+    BOOST_TEST_THROWS(
+        special.at(0x08080808), boost::static_views::key_not_found_error);
+}
+
+struct range {
+    int lo;
+    int hi;
+    int value;
+};
+
+static constexpr range ranges[] = {{-10, -5, 0}, {-4, -4, 1}, {0, 3, 2},
+    {5, 5, 3}, {6, 9, 4}, {20, 30, 5}, {31, 31, 6}};
+
+// Compares with a linear scan for all keys around all the boundaries.
+template <class Map, std::size_t N>
+auto check_against_scan(Map const& map, range const (&xs)[N])
+{
+    for (int x = xs[0].lo - 3; x <= xs[N - 1].hi + 3; ++x) {
+        range const* expected = nullptr;
+        for (auto const& r : xs) {
+            if (r.lo <= x && x <= r.hi) expected = &r;
+        }
+        BOOST_TEST(map.find(x) == expected);
+    }
+}
+
+auto test_every_size()
+{
+    using boost::static_views::make_static_interval_map;
+    using boost::static_views::raw_view;
+    static constexpr range one[]  = {{1, 2, 0}};
+    static constexpr range two[]  = {{1, 2, 0}, {4, 4, 1}};
+    static constexpr auto  map_1  = make_static_interval_map(
+        raw_view(one), &range::lo, &range::hi, &range::value);
+    static constexpr auto  map_2  = make_static_interval_map(
+        raw_view(two), &range::lo, &range::hi, &range::value);
+    static constexpr auto  map_7  = make_static_interval_map(
+        raw_view(ranges), &range::lo, &range::hi, &range::value);
+    STATIC_ASSERT(map_7.at(-4) == 1, "");
+    STATIC_ASSERT(map_7.at(31) == 6, "");
+    STATIC_ASSERT(map_7.find(4) == nullptr, "");
+    check_against_scan(map_1, one);
+    check_against_scan(map_2, two);
+    check_against_scan(map_7, ranges);
+}
+
+auto test_shorter_than_extent(int const n)
+{
+    using boost::static_views::drop_exactly;
+    using boost::static_views::make_static_interval_map;
+    using boost::static_views::raw_view;
+    static constexpr range four[] = {
+        {1, 2, 0}, {4, 4, 1}, {6, 8, 2}, {9, 9, 3}};
+    // The size of the view is only known at run-time, and is smaller than
+    // its extent.
+    auto const map = make_static_interval_map(drop_exactly(raw_view(four), n),
+        &range::lo, &range::hi, &range::value);
+    BOOST_TEST_EQ(map.size(), 2u);
+    BOOST_TEST(map.find(1) == nullptr);
+    BOOST_TEST(map.find(4) == nullptr);
+    BOOST_TEST(map.find(5) == nullptr);
+    BOOST_TEST(map.find(7) == &four[2]);
+    BOOST_TEST_EQ(map.at(9), 3);
+    BOOST_TEST(map.find(10) == nullptr);
+}
+
+auto test_invalid()
+{
+    using boost::static_views::invalid_intervals_error;
+    using boost::static_views::make_static_interval_map;
+    using boost::static_views::raw_view;
+    range const empty[]       = {{1, 2, 0}, {5, 4, 1}};
+    range const overlapping[] = {{1, 2, 0}, {2, 4, 1}};
+    range const unsorted[]    = {{5, 6, 0}, {1, 2, 1}};
+    BOOST_TEST_THROWS(make_static_interval_map(raw_view(empty), &range::lo,
+                          &range::hi, &range::value),
+        invalid_intervals_error);
+    BOOST_TEST_THROWS(make_static_interval_map(raw_view(overlapping),
+                          &range::lo, &range::hi, &range::value),
+        invalid_intervals_error);
+    BOOST_TEST_THROWS(make_static_interval_map(raw_view(unsorted),
+                          &range::lo, &range::hi, &range::value),
+        invalid_intervals_error);
+}
+
+int main()
+{
+    test_find();
+    test_every_size();
+    test_shorter_than_extent(2);
+    test_invalid();
+    return boost::report_errors();
+}
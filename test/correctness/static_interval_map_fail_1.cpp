@@ -0,0 +1,20 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_interval_map.hpp>
+
+struct range {
+    int lo;
+    int hi;
+};
+
+// [3, 5] and [5, 8] overlap at 5.
+static constexpr range ranges[] = {{0, 2}, {3, 5}, {5, 8}};
+
+static constexpr auto map = boost::static_views::make_static_interval_map(
+    boost::static_views::raw_view(ranges), &range::lo, &range::hi, &range::lo);
+
+int main() {}
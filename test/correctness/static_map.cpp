@@ -0,0 +1,161 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <tuple>
+#include <utility>
+#include <boost/static_views/drop.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+struct equal_c {
+    constexpr auto operator()(char const* a, char const* b) const noexcept
+        -> bool
+    {
+        while (*a != '\0' && *a == *b) {
+            ++a;
+            ++b;
+        }
+        return *a == *b;
+    }
+};
+
+using value_type = std::pair<char const*, int>;
+static constexpr value_type names_data[] = {
+    {"apple", 1}, {"pear", 2}, {"banana", 3}};
+static constexpr value_type prices_data[] = {
+    {"pear", 20}, {"banana", 30}, {"plum", 40}, {"cherry", 50}};
+
+static constexpr auto names =
+    boost::static_views::make_static_map_impl<13, 2>{}(
+        boost::static_views::raw_view(names_data), &value_type::first,
+        &value_type::second, equal_c{});
+static constexpr auto prices =
+    boost::static_views::make_static_map_impl<11, 2>{}(
+        boost::static_views::raw_view(prices_data), &value_type::first,
+        &value_type::second, equal_c{});
+
+auto test_hash_of()
+{
+    STATIC_ASSERT(names.hash_of("pear") == boost::static_views::hash_c{}("pear"),
+        "");
+    STATIC_ASSERT(names.hash_of("plum") == prices.hash_of("plum"), "");
+}
+
+auto test_find_hashed()
+{
+    STATIC_ASSERT(
+        names.find_hashed("banana", names.hash_of("banana")) == &names_data[2],
+        "");
+    STATIC_ASSERT(names.find_hashed("plum", names.hash_of("plum")) == nullptr,
+        "");
+    STATIC_ASSERT(
+        prices.find_hashed("plum", names.hash_of("plum")) == &prices_data[2],
+        "");
+}
+
+auto test_find_all()
+{
+    constexpr auto pear = boost::static_views::find_all("pear", names, prices);
+    STATIC_ASSERT(std::get<0>(pear) == &names_data[1], "");
+    STATIC_ASSERT(std::get<1>(pear) == &prices_data[0], "");
+
+    constexpr auto apple =
+        boost::static_views::find_all("apple", names, prices, names);
+    STATIC_ASSERT(std::get<0>(apple) == &names_data[0], "");
+    STATIC_ASSERT(std::get<1>(apple) == nullptr, "");
+    STATIC_ASSERT(std::get<2>(apple) == &names_data[0], "");
+
+    auto const cherry = boost::static_views::find_all("cherry", names, prices);
+    BOOST_TEST(std::get<0>(cherry) == nullptr);
+    BOOST_TEST(std::get<1>(cherry) != nullptr);
+    BOOST_TEST_EQ(std::get<1>(cherry)->second, 50);
+}
+
+auto test_static_at()
+{
+    BOOST_TEST_EQ(BOOST_STATIC_VIEWS_STATIC_AT(prices, "cherry"), 50);
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201603
+    // With C++17 constexpr lambdas, the result is a constant expression.
+    constexpr auto banana = BOOST_STATIC_VIEWS_STATIC_AT(names, "banana");
+    STATIC_ASSERT(banana == 3, "");
+#endif
+#if defined(__cpp_nontype_template_parameter_auto)
+    static constexpr char plum[] = "plum";
+    STATIC_ASSERT(
+        (boost::static_views::static_at<prices, plum>() == 40), "");
+#endif
+}
+
+auto test_backend_selection()
+{
+    using int_pair = std::pair<int, long>;
+    static constexpr int_pair small_data[] = {{1, 10}, {2, 20}, {1, 30}};
+
+    // Tiny maps use a linear scan unless bucket parameters are given.
+    static constexpr auto linear = boost::static_views::make_static_map_impl<>{}(
+        boost::static_views::raw_view(small_data), &int_pair::first,
+        &int_pair::second);
+    static constexpr auto hashed =
+        boost::static_views::make_static_map_impl<4, 2>{}(
+            boost::static_views::raw_view(small_data), &int_pair::first,
+            &int_pair::second);
+    STATIC_ASSERT(decltype(linear)::bucket_count() == 1, "");
+    STATIC_ASSERT(decltype(hashed)::bucket_count() == 4, "");
+    // Strings (and maps of names above) use the hashed backend sooner.
+    STATIC_ASSERT(decltype(names)::bucket_count() == 13, "");
+
+    // The first of several equal keys wins in both cases.
+    STATIC_ASSERT(linear.find(1) == &small_data[0], "");
+    STATIC_ASSERT(hashed.find(1) == &small_data[0], "");
+    STATIC_ASSERT(linear.at(2) == 20, "");
+    STATIC_ASSERT(linear.find(3) == nullptr, "");
+    STATIC_ASSERT(linear.hash_of(2) == hashed.hash_of(2), "");
+    STATIC_ASSERT(std::get<1>(boost::static_views::find_all(2, hashed, linear))
+                      == &small_data[1],
+        "");
+    STATIC_ASSERT(linear.statistics().max_probe_length == 3, "");
+
+    // A linear map can also be requested explicitly.
+    static constexpr auto forced =
+        boost::static_views::make_linear_static_map_impl<>{}(
+            boost::static_views::raw_view(prices_data), &value_type::first,
+            &value_type::second, equal_c{});
+    STATIC_ASSERT(decltype(forced)::bucket_count() == 1, "");
+    STATIC_ASSERT(forced.find("plum") == &prices_data[2], "");
+    STATIC_ASSERT(forced.find("apple") == nullptr, "");
+    BOOST_TEST_EQ(forced.at("cherry"), 50);
+}
+
+auto test_linear_shorter_than_extent(int const n)
+{
+    using int_pair = std::pair<int, long>;
+    static constexpr int_pair data[] = {{7, 70}, {3, 30}, {5, 50}, {9, 90}};
+
+    // The extent of a drop_exactly view is that of its parent, but its size
+    // is only known at run-time.
+    auto const xs = boost::static_views::drop_exactly(
+        boost::static_views::raw_view(data), n);
+    auto const map = boost::static_views::make_static_map_impl<>{}(
+        xs, &int_pair::first, &int_pair::second);
+    STATIC_ASSERT(decltype(map)::bucket_count() == 1, "");
+    BOOST_TEST(map.find(7) == nullptr);
+    BOOST_TEST(map.find(3) == nullptr);
+    BOOST_TEST(map.find(5) == &data[2]);
+    BOOST_TEST_EQ(map.at(9), 90);
+    BOOST_TEST_EQ(map.statistics().element_count, 2u);
+    BOOST_TEST_EQ(map.statistics().max_probe_length, 2u);
+}
+
+int main()
+{
+    test_hash_of();
+    test_find_hashed();
+    test_find_all();
+    test_static_at();
+    test_backend_selection();
+    test_linear_shorter_than_extent(2);
+    return boost::report_errors();
+}
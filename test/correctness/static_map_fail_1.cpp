@@ -0,0 +1,20 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <utility>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+using value_type = std::pair<int, long>;
+static constexpr value_type data[] = {{1, 10}, {2, 20}};
+static constexpr auto       map = boost::static_views::make_static_map_impl<>{}(
+    boost::static_views::raw_view(data), &value_type::first,
+    &value_type::second);
+
+int main()
+{
+    // Key 3 is not in the map
+    return static_cast<int>(BOOST_STATIC_VIEWS_STATIC_AT(map, 3));
+}
@@ -0,0 +1,120 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <string>
+#include <boost/static_views/drop.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_trie.hpp>
+#include <boost/static_views/string_pool.hpp>
+
+struct route {
+    char const* prefix;
+    int         handler;
+};
+
+static constexpr route routes[] = {{"/api/", 1}, {"/", 0}, {"/api/v2/", 2},
+    {"/static/", 3}, {"/api/v1/", 4}, {"/api/v2/admin", 5},
+    {"/static/", 6}, {"/assets", 7}};
+
+static constexpr auto router = boost::static_views::make_static_trie_impl<64>{}(
+    boost::static_views::raw_view(routes), &route::prefix);
+
+template <class Trie>
+constexpr auto handler_of(Trie const& trie, char const* const path) -> int
+{
+    auto const* const x = trie.longest_prefix(path);
+    return x == nullptr ? -1 : x->handler;
+}
+
+auto test_longest_prefix()
+{
+    STATIC_ASSERT(router.size() == 8, "");
+    // "/static/" is there twice, so it shares all nodes.
+    STATIC_ASSERT(router.node_count() == 28, "");
+    STATIC_ASSERT(handler_of(router, "/api/v2/users") == 2, "");
+    STATIC_ASSERT(handler_of(router, "/api/v2/admin/x") == 5, "");
+    STATIC_ASSERT(handler_of(router, "/api/v2") == 1, "");
+    STATIC_ASSERT(handler_of(router, "/api/v3/") == 1, "");
+    STATIC_ASSERT(handler_of(router, "/index.html") == 0, "");
+    // The first of several equal keys wins.
+    STATIC_ASSERT(handler_of(router, "/static/x.css") == 3, "");
+    STATIC_ASSERT(handler_of(router, "api") == -1, "");
+    STATIC_ASSERT(handler_of(router, "") == -1, "");
+
+    std::string const paths[] = {"/api/v1/", "/api/v1", "/assets/logo.svg",
+        "/assets", "/asset", "/api/v2/admi", "/api/v2/admins", "x/api/"};
+    int const expected[] = {4, 1, 7, 7, 0, 2, 5, -1};
+    for (std::size_t i = 0; i < 8; ++i) {
+        auto const* const x = router.longest_prefix(paths[i]);
+        BOOST_TEST_EQ(x == nullptr ? -1 : x->handler, expected[i]);
+    }
+}
+
+auto test_starts_with_any()
+{
+    static constexpr auto pool = boost::static_views::make_string_pool(
+        "GET ", "HEAD ", "POST ", "PUT ", "DELETE ");
+    static constexpr auto methods =
+        boost::static_views::make_static_trie_impl<32>{}(
+            boost::static_views::raw_view(pool.entries()), pool.key_fn());
+    STATIC_ASSERT(methods.starts_with_any("GET /index.html"), "");
+    STATIC_ASSERT(!methods.starts_with_any("GETS /index.html"), "");
+    STATIC_ASSERT(!methods.starts_with_any("PU"), "");
+    STATIC_ASSERT(methods.longest_prefix("DELETE /x") == &pool.entries()[4],
+        "");
+    BOOST_TEST(methods.starts_with_any(std::string{"PUT /upload"}));
+    BOOST_TEST(!methods.starts_with_any(std::string{"PATCH /upload"}));
+    BOOST_TEST(router.starts_with_any(std::string{"/"}));
+    BOOST_TEST(!router.starts_with_any(std::string{}));
+}
+
+// More than 16 edges leave the root, so lookups need several SIMD loads.
+static constexpr char const* letters[] = {"a", "b", "c", "d", "e", "f", "g",
+    "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r", "s", "t", "u",
+    "v", "w", "x", "y", "z", "zz", "\xff"};
+
+struct identity {
+    constexpr auto operator()(char const* const x) const noexcept { return x; }
+};
+
+auto test_fan_out()
+{
+    static constexpr auto trie =
+        boost::static_views::make_static_trie_impl<29>{}(
+            boost::static_views::raw_view(letters), identity{});
+    for (std::size_t i = 0; i < 28; ++i) {
+        std::string const s = std::string{letters[i]} + "zz";
+        BOOST_TEST_EQ(trie.longest_prefix(s) - letters,
+            static_cast<std::ptrdiff_t>(i == 25 ? 26 : i));
+    }
+    BOOST_TEST(trie.longest_prefix(std::string{"A"}) == nullptr);
+    BOOST_TEST(trie.longest_prefix(std::string{"\xfe"}) == nullptr);
+}
+
+auto test_shorter_than_extent(int const n)
+{
+    // Only the last six routes are used. Their number is only known at
+    // run-time and is smaller than the extent of the view.
+    auto const trie = boost::static_views::make_static_trie_impl<32>{}(
+        boost::static_views::drop_exactly(
+            boost::static_views::raw_view(routes), n),
+        &route::prefix);
+    BOOST_TEST_EQ(trie.size(), 6u);
+    BOOST_TEST_EQ(handler_of(trie, "/api/v2/users"), 2);
+    BOOST_TEST_EQ(handler_of(trie, "/api/v2/admin/x"), 5);
+    BOOST_TEST_EQ(handler_of(trie, "/static/x.css"), 3);
+    BOOST_TEST_EQ(handler_of(trie, "/api/v3/"), -1);
+    BOOST_TEST_EQ(handler_of(trie, "/index.html"), -1);
+}
+
+int main()
+{
+    test_longest_prefix();
+    test_starts_with_any();
+    test_fan_out();
+    test_shorter_than_extent(2);
+    return boost::report_errors();
+}
@@ -0,0 +1,19 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_trie.hpp>
+
+static constexpr char const* prefixes[] = {"/api/", "/static/"};
+
+struct identity {
+    constexpr auto operator()(char const* const x) const noexcept { return x; }
+};
+
+// The trie needs 1 + 5 + 7 = 13 nodes.
+static constexpr auto trie = boost::static_views::make_static_trie_impl<12>{}(
+    boost::static_views::raw_view(prefixes), identity{});
+
+int main() {}
@@ -0,0 +1,82 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <string>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+#include <boost/static_views/string_equal.hpp>
+#include <boost/static_views/string_pool.hpp>
+
+auto test_constexpr()
+{
+    using boost::static_views::pooled_string;
+    constexpr boost::static_views::string_equal equal{};
+    STATIC_ASSERT(equal("abc", "abc"), "");
+    STATIC_ASSERT(!equal("abc", "abd"), "");
+    STATIC_ASSERT(!equal("abc", "ab"), "");
+    STATIC_ASSERT(equal("", ""), "");
+    STATIC_ASSERT(equal(pooled_string{"hello"}, pooled_string{"hello"}), "");
+    STATIC_ASSERT(!equal(pooled_string{"hello"}, pooled_string{"hellO"}), "");
+    STATIC_ASSERT(
+        !equal(pooled_string{"hello"}, pooled_string("hello", 4)), "");
+}
+
+// Compares every length up to 300 with a mismatch at every position. This
+// covers all combinations of full and overlapping chunks.
+auto test_runtime()
+{
+    boost::static_views::string_equal const equal{};
+    for (std::size_t n = 0; n <= 300; ++n) {
+        std::string a(n, 'x');
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<char>('a' + i % 26);
+        }
+        std::string b = a;
+        BOOST_TEST(equal(a, b));
+        BOOST_TEST(equal(a.c_str(), b.c_str()));
+        for (std::size_t i = 0; i < n; ++i) {
+            b[i] = '#';
+            BOOST_TEST(!equal(a, b));
+            BOOST_TEST(!equal(a.c_str(), b.c_str()));
+            BOOST_TEST(!equal(boost::static_views::pooled_string{a.c_str()},
+                boost::static_views::pooled_string{b.c_str()}));
+            b[i] = a[i];
+        }
+        BOOST_TEST(!equal(a, a + 'x'));
+    }
+}
+
+struct get_first {
+    constexpr auto operator()(std::pair<char const*, int> const& x) const
+        noexcept
+    {
+        return x.first;
+    }
+};
+
+auto test_map()
+{
+    static constexpr std::pair<char const*, int> data[] = {{"one", 1},
+        {"two", 2}, {"three", 3}, {"four", 4}, {"five", 5}, {"six", 6},
+        {"seven", 7}, {"eight", 8}, {"nine", 9}, {"ten", 10}};
+    static constexpr auto map =
+        boost::static_views::make_static_map_impl<16, 3>{}(
+            boost::static_views::raw_view(data), get_first{},
+            &std::pair<char const*, int>::second,
+            boost::static_views::string_equal{});
+    STATIC_ASSERT(map.at("seven") == 7, "");
+    STATIC_ASSERT(map.find("eleven") == nullptr, "");
+    std::string const key = "nine";
+    BOOST_TEST_EQ(map.at(key.c_str()), 9);
+}
+
+int main()
+{
+    test_constexpr();
+    test_runtime();
+    test_map();
+    return boost::report_errors();
+}
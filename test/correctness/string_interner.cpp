@@ -0,0 +1,75 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <string>
+#include <boost/static_views/string_interner.hpp>
+
+static constexpr auto methods_pool = boost::static_views::make_string_pool(
+    "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE");
+static constexpr auto methods =
+    boost::static_views::make_string_interner(methods_pool);
+
+static constexpr auto keywords_pool = boost::static_views::make_string_pool(
+    "auto", "break", "case", "char", "const", "continue", "default", "do",
+    "double", "else", "enum", "extern", "float", "for", "goto", "if", "int",
+    "long", "register", "return");
+static constexpr auto keywords =
+    boost::static_views::make_string_interner<64, 2>(keywords_pool);
+
+auto classify(std::string const& method) -> int
+{
+    switch (methods.lookup_id(method.c_str())) {
+    case methods.id_of("GET"):
+    case methods.id_of("HEAD"): return 1;
+    case methods.id_of("POST"):
+    case methods.id_of("PUT"): return 2;
+    default: return 0;
+    }
+}
+
+auto test_ids()
+{
+    STATIC_ASSERT(methods.size() == 8, "");
+    STATIC_ASSERT(methods.id_of("GET") == 0, "");
+    STATIC_ASSERT(methods.id_of("TRACE") == 7, "");
+    STATIC_ASSERT(methods.lookup_id("PATCH") == methods.size(), "");
+    STATIC_ASSERT(methods.name_of(4) == "DELETE", "");
+    STATIC_ASSERT(keywords.size() == 20, "");
+    STATIC_ASSERT(keywords.id_of("return") == 19, "");
+    STATIC_ASSERT(keywords.lookup_id("while") == 20, "");
+
+    for (std::size_t i = 0; i < keywords.size(); ++i) {
+        auto const name = keywords.name_of(i);
+        BOOST_TEST_EQ(
+            keywords.lookup_id(std::string{name.data(), name.size()}), i);
+    }
+    BOOST_TEST_THROWS(
+        methods.id_of("get"), boost::static_views::key_not_found_error);
+#if defined(BOOST_STATIC_VIEWS_HAVE_STRING_VIEW)
+    std::string_view const line = "POST /index.html";
+    BOOST_TEST_EQ(methods.lookup_id(line.substr(0, 4)), 2u);
+#endif
+}
+
+auto test_dispatch()
+{
+    BOOST_TEST_EQ(classify("GET"), 1);
+    BOOST_TEST_EQ(classify("PUT"), 2);
+    BOOST_TEST_EQ(classify("TRACE"), 0);
+    BOOST_TEST_EQ(classify("PUTS"), 0);
+
+    // Ids index plain arrays, with the fallback stored last.
+    int const costs[methods.size() + 1] = {1, 1, 5, 5, 3, 9, 1, 1, -1};
+    BOOST_TEST_EQ(costs[methods.lookup_id("CONNECT")], 9);
+    BOOST_TEST_EQ(costs[methods.lookup_id("BREW")], -1);
+}
+
+int main()
+{
+    test_ids();
+    test_dispatch();
+    return boost::report_errors();
+}
@@ -0,0 +1,21 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/static_views/string_interner.hpp>
+
+static constexpr auto pool =
+    boost::static_views::make_string_pool("GET", "PUT");
+static constexpr auto methods =
+    boost::static_views::make_string_interner(pool);
+
+int main(int argc, char** argv)
+{
+    switch (methods.lookup_id(argv[argc - 1])) {
+    case methods.id_of("GET"): return 1;
+    // "PATCH" is not one of the strings
+    case methods.id_of("PATCH"): return 2;
+    default: return 0;
+    }
+}
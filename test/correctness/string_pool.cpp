@@ -0,0 +1,111 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cstring>
+#include <boost/static_views/hash_c.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+#include <boost/static_views/string_pool.hpp>
+
+static constexpr auto colours =
+    boost::static_views::make_string_pool_with_values("red", "#ff0000",
+        "green", "#00ff00", "blue", "#0000ff", "", "empty");
+
+// Laid out for word_map below.
+static constexpr auto words = boost::static_views::make_string_pool<32>(
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+    "india", "juliett", "kilo", "lima");
+
+struct entry_index {
+    constexpr auto operator()(
+        boost::static_views::string_pool_entry const& x) const noexcept
+    {
+        return static_cast<std::size_t>(&x - words.entries());
+    }
+};
+
+// Returns whether keys of lower buckets are stored before those of higher
+// ones.
+template <class Pool>
+constexpr auto in_bucket_order(
+    Pool const& pool, std::size_t const bucket_count) -> bool
+{
+    using boost::static_views::hash_c;
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        for (std::size_t j = 0; j < pool.size(); ++j) {
+            auto const a = hash_c{}(pool.key(i)) % bucket_count;
+            auto const b = hash_c{}(pool.key(j)) % bucket_count;
+            if (a < b && pool.entries()[i].key > pool.entries()[j].key)
+                return false;
+        }
+    }
+    return true;
+}
+
+auto test_layout()
+{
+    // Length prefix, characters and NUL for each of the 8 strings.
+    STATIC_ASSERT(colours.bytes() == 5 + 9 + 7 + 9 + 6 + 9 + 2 + 7, "");
+    STATIC_ASSERT(colours.size() == 4, "");
+    // Values follow their keys.
+    STATIC_ASSERT(
+        colours.entries()[0].value == colours.entries()[0].key + 5, "");
+    STATIC_ASSERT(
+        colours.entries()[1].value == colours.entries()[1].key + 7, "");
+    STATIC_ASSERT(colours.key(2) == "blue", "");
+    STATIC_ASSERT(colours.key(3).size() == 0, "");
+    STATIC_ASSERT(words.key(11) == "lima", "");
+    STATIC_ASSERT(words.entries()[11].value == 0, "");
+    STATIC_ASSERT(in_bucket_order(colours, 2 * colours.size()), "");
+    STATIC_ASSERT(in_bucket_order(words, 32), "");
+
+    // Values are NUL-terminated, so they can be used as C strings.
+    BOOST_TEST_EQ(std::strcmp(colours.value_fn()(colours.entries()[1]).data(),
+                      "#00ff00"),
+        0);
+
+    STATIC_ASSERT(boost::static_views::pooled_string{"abc"}.size() == 3, "");
+    STATIC_ASSERT(boost::static_views::pooled_string{"abc"}
+                      != boost::static_views::pooled_string("abcd", 3 + 1),
+        "");
+    STATIC_ASSERT(boost::static_views::hash_c{}(
+                      boost::static_views::pooled_string{"hotel"})
+                      == boost::static_views::hash_c{}("hotel"),
+        "");
+}
+
+auto test_map()
+{
+    static constexpr auto colour_map =
+        boost::static_views::make_static_map_impl<>{}(
+            boost::static_views::raw_view(colours.entries()), colours.key_fn(),
+            colours.value_fn());
+    STATIC_ASSERT(colour_map.at("green") == "#00ff00", "");
+    STATIC_ASSERT(colour_map.at("") == "empty", "");
+    STATIC_ASSERT(colour_map.find("gree") == nullptr, "");
+    STATIC_ASSERT(colour_map.find("greens") == nullptr, "");
+    BOOST_TEST_THROWS(
+        colour_map.at("yellow"), boost::static_views::key_not_found_error);
+
+    // Keys only, with mapped values being indices into some other array.
+    static constexpr auto word_map =
+        boost::static_views::make_static_map_impl<32, 2>{}(
+            boost::static_views::raw_view(words.entries()), words.key_fn(),
+            entry_index{});
+    STATIC_ASSERT(word_map.at("alpha") == 0, "");
+    STATIC_ASSERT(word_map.at("kilo") == 10, "");
+    STATIC_ASSERT(word_map.count("mike") == 0, "");
+
+    char buffer[] = "foxtrot";
+    BOOST_TEST_EQ(word_map.at(buffer), 5u);
+}
+
+int main()
+{
+    test_layout();
+    test_map();
+    return boost::report_errors();
+}
@@ -0,0 +1,186 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "testing.hpp"
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+#include <boost/static_views/take.hpp>
+#include <boost/static_views/zip.hpp>
+
+namespace sv = boost::static_views;
+
+// A table stored as a struct of arrays. names has an extra element which is
+// not part of the zip.
+static constexpr int         codes[]  = {404, 200, 301, 500, 418, 204};
+static constexpr char const* names[]  = {"Not Found", "OK",
+    "Moved Permanently", "Internal Server Error", "I'm a teapot",
+    "No Content", "unused"};
+static constexpr double      weights[] = {0.5, 1.0, 0.25, 2.0, 0.125, 4.0};
+
+template <class T>
+using plain_t = std::remove_cv_t<T>;
+
+auto test_view()
+{
+    static constexpr auto xs =
+        sv::zip(sv::raw_view(codes), sv::raw_view(names));
+    using zip_type = plain_t<decltype(xs)>;
+
+    STATIC_ASSERT(sv::View<zip_type>, "");
+    STATIC_ASSERT((std::is_same<zip_type::reference,
+                      std::tuple<int const&, char const* const&>>::value),
+        "");
+    STATIC_ASSERT((std::is_same<zip_type::value_type,
+                      std::tuple<int, char const*>>::value),
+        "");
+    STATIC_ASSERT(zip_type::extent() == 6, "");
+    STATIC_ASSERT(xs.size() == 6, "");
+    STATIC_ASSERT(std::get<0>(xs[3]) == 500, "");
+    STATIC_ASSERT(&std::get<1>(xs[4]) == &names[4], "");
+
+    // Contiguity is kept per column.
+    STATIC_ASSERT(xs.data<0>() == codes, "");
+    STATIC_ASSERT(xs.data<1>() == names, "");
+    STATIC_ASSERT(&xs.column<1>()[2] == &names[2], "");
+
+    BOOST_TEST_THROWS(xs[6], sv::out_of_bound);
+
+    auto i = 0;
+    for (auto const x : xs) {
+        BOOST_TEST_EQ(std::get<0>(x), codes[i]);
+        BOOST_TEST_EQ(std::strcmp(std::get<1>(x), names[i]), 0);
+        ++i;
+    }
+    BOOST_TEST_EQ(i, 6);
+}
+
+// A view whose size is only known at runtime.
+struct prefix_view {
+    using value_type = int const;
+    using reference  = int const&;
+    using size_type  = unsigned;
+    using index_type = int;
+
+    size_type n;
+
+    static constexpr auto extent() noexcept -> std::ptrdiff_t
+    {
+        return sv::dynamic_extent;
+    }
+    constexpr auto size() const noexcept -> size_type { return n; }
+    constexpr auto unsafe_at(index_type const i) const noexcept -> reference
+    {
+        return codes[i];
+    }
+    constexpr auto operator[](index_type const i) const -> reference
+    {
+        return codes[i];
+    }
+};
+
+auto test_extents()
+{
+    static constexpr auto ws = sv::raw_view(weights);
+
+    // The smallest extent known at compile-time wins.
+    constexpr auto a = sv::zip(ws, sv::raw_view(codes),
+        sv::take_exactly(
+            sv::raw_view(names), std::integral_constant<int, 4>{}));
+    STATIC_ASSERT(plain_t<decltype(a)>::extent() == 4, "");
+    STATIC_ASSERT(a.size() == 4, "");
+    STATIC_ASSERT(std::get<2>(a[3])[0] == 'I', "");
+
+    // Columns of unknown size are ignored by extent() but not by size().
+    STATIC_ASSERT(sv::View<prefix_view>, "");
+    constexpr auto b = sv::zip(prefix_view{3}, ws);
+    STATIC_ASSERT(plain_t<decltype(b)>::extent() == 6, "");
+    STATIC_ASSERT(b.size() == 3, "");
+    STATIC_ASSERT(std::get<0>(b[2]) == 301, "");
+    STATIC_ASSERT(std::get<1>(b[2]) == 0.25, "");
+
+    constexpr auto c = sv::zip(prefix_view{2}, prefix_view{5});
+    STATIC_ASSERT(plain_t<decltype(c)>::extent() == sv::dynamic_extent, "");
+    STATIC_ASSERT(c.size() == 2, "");
+    BOOST_TEST_THROWS(c[2], sv::out_of_bound);
+}
+
+auto test_map()
+{
+    using sv::get_element;
+    static constexpr auto hashed = sv::make_static_map_impl<32, 2>{}(
+        sv::zip(sv::raw_view(codes), sv::raw_view(names)), get_element<0>{},
+        get_element<1>{});
+    static constexpr auto packed = sv::make_packed_static_map_impl<>{}(
+        sv::zip(sv::raw_view(codes), sv::raw_view(weights)), get_element<0>{},
+        get_element<1>{});
+    static constexpr auto linear = sv::make_linear_static_map_impl<>{}(
+        sv::zip(sv::raw_view(codes), sv::raw_view(names)), get_element<0>{},
+        get_element<1>{});
+
+    STATIC_ASSERT(hashed.find(418) != nullptr, "");
+    STATIC_ASSERT(hashed.find(302) == nullptr, "");
+    STATIC_ASSERT(hashed.find(301).index() == 2, "");
+    STATIC_ASSERT(hashed.at(200)[0] == 'O', "");
+    STATIC_ASSERT(packed.at(500) == 2.0, "");
+    STATIC_ASSERT(linear.find(204) != nullptr, "");
+    STATIC_ASSERT(linear.find(1) == nullptr, "");
+
+    // Mapped values are references into the columns rather than copies.
+    BOOST_TEST_EQ(&hashed[404], &names[0]);
+    BOOST_TEST_EQ(&packed[204], &weights[5]);
+    BOOST_TEST_EQ(&std::get<1>(*linear.find(500)), &names[3]);
+    BOOST_TEST_THROWS(hashed.at(302), sv::key_not_found_error);
+
+    auto const all = sv::find_all(418, hashed, linear);
+    BOOST_TEST_EQ(std::get<0>(all).index(), 4);
+    BOOST_TEST_EQ(std::get<1>(all).index(), 4);
+    BOOST_TEST(!std::get<0>(sv::find_all(1, hashed, linear)));
+}
+
+auto test_pointers()
+{
+    struct entry {
+        int code;
+        int id;
+    };
+    struct get_code {
+        constexpr auto operator()(entry const& x) const noexcept -> int
+        {
+            return x.code;
+        }
+    };
+    struct get_id {
+        constexpr auto operator()(entry const& x) const noexcept -> int
+        {
+            return x.id;
+        }
+    };
+    static constexpr entry entries[] = {{404, 1}, {200, 2}};
+    static constexpr auto  map       = sv::make_static_map_impl<>{}(
+        sv::raw_view(entries), get_code{}, get_id{});
+    // Views of lvalues still give plain pointers.
+    STATIC_ASSERT(
+        (std::is_same<decltype(map.find(200)), entry const*>::value), "");
+    BOOST_TEST_EQ(map.find(200), &entries[1]);
+
+    using zip_map = plain_t<decltype(sv::make_static_map_impl<>{}(
+        sv::zip(sv::raw_view(codes), sv::raw_view(names)),
+        sv::get_element<0>{}, sv::get_element<1>{}))>;
+    constexpr zip_map::pointer p{};
+    STATIC_ASSERT(p == nullptr && !p, "");
+}
+
+int main()
+{
+    test_view();
+    test_extents();
+    test_map();
+    test_pointers();
+    return boost::report_errors();
+}
@@ -0,0 +1,3 @@
+#include <boost/static_views/atomic_snapshot.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/case_insensitive.hpp>
+
+int main() {}
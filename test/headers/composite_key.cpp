@@ -0,0 +1,3 @@
+#include <boost/static_views/composite_key.hpp>
+
+int main() {}
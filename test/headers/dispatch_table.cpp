@@ -0,0 +1,3 @@
+#include <boost/static_views/dispatch_table.hpp>
+
+int main() {}
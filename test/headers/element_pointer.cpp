@@ -0,0 +1,3 @@
+#include <boost/static_views/detail/element_pointer.hpp>
+
+int main(void) {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/for_each.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/hash_many.hpp>
+
+int main() {}
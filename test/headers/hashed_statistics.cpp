@@ -0,0 +1,3 @@
+#include <boost/static_views/hashed_statistics.hpp>
+
+int main() {}
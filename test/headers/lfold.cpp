@@ -0,0 +1,3 @@
+#include <boost/static_views/lfold.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/linear_scan.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/lookup_counters.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/materialize.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/overlay_map.hpp>
+
+int main() {}
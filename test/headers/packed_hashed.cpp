@@ -0,0 +1,3 @@
+#include <boost/static_views/packed_hashed.hpp>
+
+int main() {}
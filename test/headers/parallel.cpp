@@ -0,0 +1,3 @@
+#include <boost/static_views/parallel.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/parallel_hashed.hpp>
+
+int main() {}
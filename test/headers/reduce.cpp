@@ -0,0 +1,3 @@
+#include <boost/static_views/reduce.hpp>
+
+int main() {}
@@ -0,0 +1,3 @@
+#include <boost/static_views/static_interval_map.hpp>
+
+int main() {}
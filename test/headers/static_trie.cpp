@@ -0,0 +1,3 @@
+#include <boost/static_views/static_trie.hpp>
+
+int main() {}
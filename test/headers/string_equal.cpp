@@ -0,0 +1,3 @@
+#include <boost/static_views/string_equal.hpp>
+
+int main() {}
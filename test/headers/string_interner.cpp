@@ -0,0 +1,3 @@
+#include <boost/static_views/string_interner.hpp>
+
+int main() {}
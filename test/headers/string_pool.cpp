@@ -0,0 +1,3 @@
+#include <boost/static_views/string_pool.hpp>
+
+int main() {}
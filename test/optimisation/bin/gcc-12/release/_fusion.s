@@ -0,0 +1,1685 @@
+
+bin/gcc-12/release/_fusion:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000002000 <_init>:
+    2000:	48 83 ec 08          	sub    $0x8,%rsp
+    2004:	48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 5fd0 <__gmon_start__@Base>
+    200b:	48 85 c0             	test   %rax,%rax
+    200e:	74 02                	je     2012 <_init+0x12>
+    2010:	ff d0                	call   *%rax
+    2012:	48 83 c4 08          	add    $0x8,%rsp
+    2016:	c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000002020 <_ZSt9terminatev@plt-0x10>:
+    2020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    2026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    202c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002030 <_ZSt9terminatev@plt>:
+    2030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 6000 <_ZSt9terminatev@GLIBCXX_3.4>
+    2036:	68 00 00 00 00       	push   $0x0
+    203b:	e9 e0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002040 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>:
+    2040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 6008 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@GLIBCXX_3.4.21>
+    2046:	68 01 00 00 00       	push   $0x1
+    204b:	e9 d0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002050 <strlen@plt>:
+    2050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 6010 <strlen@GLIBC_2.2.5>
+    2056:	68 02 00 00 00       	push   $0x2
+    205b:	e9 c0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002060 <__cxa_allocate_exception@plt>:
+    2060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 6018 <__cxa_allocate_exception@CXXABI_1.3>
+    2066:	68 03 00 00 00       	push   $0x3
+    206b:	e9 b0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002070 <_ZSt20__throw_length_errorPKc@plt>:
+    2070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 6020 <_ZSt20__throw_length_errorPKc@GLIBCXX_3.4>
+    2076:	68 04 00 00 00       	push   $0x4
+    207b:	e9 a0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002080 <__cxa_free_exception@plt>:
+    2080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 6028 <__cxa_free_exception@CXXABI_1.3>
+    2086:	68 05 00 00 00       	push   $0x5
+    208b:	e9 90 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002090 <memcpy@plt>:
+    2090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 6030 <memcpy@GLIBC_2.14>
+    2096:	68 06 00 00 00       	push   $0x6
+    209b:	e9 80 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020a0 <__cxa_atexit@plt>:
+    20a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 6038 <__cxa_atexit@GLIBC_2.2.5>
+    20a6:	68 07 00 00 00       	push   $0x7
+    20ab:	e9 70 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020b0 <_ZdlPvm@plt>:
+    20b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 6040 <_ZdlPvm@CXXABI_1.3.9>
+    20b6:	68 08 00 00 00       	push   $0x8
+    20bb:	e9 60 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020c0 <_ZNSt13runtime_errorD2Ev@plt>:
+    20c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 6048 <_ZNSt13runtime_errorD2Ev@GLIBCXX_3.4>
+    20c6:	68 09 00 00 00       	push   $0x9
+    20cb:	e9 50 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020d0 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>:
+    20d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 6050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@GLIBCXX_3.4.21>
+    20d6:	68 0a 00 00 00       	push   $0xa
+    20db:	e9 40 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020e0 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_c@plt>:
+    20e0:	ff 25 72 3f 00 00    	jmp    *0x3f72(%rip)        # 6058 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_c@GLIBCXX_3.4>
+    20e6:	68 0b 00 00 00       	push   $0xb
+    20eb:	e9 30 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020f0 <_ZNSt13runtime_errorC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE@plt>:
+    20f0:	ff 25 6a 3f 00 00    	jmp    *0x3f6a(%rip)        # 6060 <_ZNSt13runtime_errorC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE@GLIBCXX_3.4.21>
+    20f6:	68 0c 00 00 00       	push   $0xc
+    20fb:	e9 20 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002100 <strtol@plt>:
+    2100:	ff 25 62 3f 00 00    	jmp    *0x3f62(%rip)        # 6068 <strtol@GLIBC_2.2.5>
+    2106:	68 0d 00 00 00       	push   $0xd
+    210b:	e9 10 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002110 <_ZNSt8ios_base4InitC1Ev@plt>:
+    2110:	ff 25 5a 3f 00 00    	jmp    *0x3f5a(%rip)        # 6070 <_ZNSt8ios_base4InitC1Ev@GLIBCXX_3.4>
+    2116:	68 0e 00 00 00       	push   $0xe
+    211b:	e9 00 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002120 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm@plt>:
+    2120:	ff 25 52 3f 00 00    	jmp    *0x3f52(%rip)        # 6078 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm@GLIBCXX_3.4.21>
+    2126:	68 0f 00 00 00       	push   $0xf
+    212b:	e9 f0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002130 <__cxa_throw@plt>:
+    2130:	ff 25 4a 3f 00 00    	jmp    *0x3f4a(%rip)        # 6080 <__cxa_throw@CXXABI_1.3>
+    2136:	68 10 00 00 00       	push   $0x10
+    213b:	e9 e0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002140 <_ZNSolsEi@plt>:
+    2140:	ff 25 42 3f 00 00    	jmp    *0x3f42(%rip)        # 6088 <_ZNSolsEi@GLIBCXX_3.4>
+    2146:	68 11 00 00 00       	push   $0x11
+    214b:	e9 d0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002150 <_Unwind_Resume@plt>:
+    2150:	ff 25 3a 3f 00 00    	jmp    *0x3f3a(%rip)        # 6090 <_Unwind_Resume@GCC_3.0>
+    2156:	68 12 00 00 00       	push   $0x12
+    215b:	e9 c0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002160 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@plt>:
+    2160:	ff 25 32 3f 00 00    	jmp    *0x3f32(%rip)        # 6098 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@GLIBCXX_3.4.21>
+    2166:	68 13 00 00 00       	push   $0x13
+    216b:	e9 b0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002170 <_ZNSt13runtime_errorC2EPKc@plt>:
+    2170:	ff 25 2a 3f 00 00    	jmp    *0x3f2a(%rip)        # 60a0 <_ZNSt13runtime_errorC2EPKc@GLIBCXX_3.4.21>
+    2176:	68 14 00 00 00       	push   $0x14
+    217b:	e9 a0 fe ff ff       	jmp    2020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000002180 <__cxa_finalize@plt>:
+    2180:	ff 25 2a 3e 00 00    	jmp    *0x3e2a(%rip)        # 5fb0 <__cxa_finalize@GLIBC_2.2.5>
+    2186:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000002190 <_ZN5boost12static_views6detail17make_out_of_boundEPKc>:
+    2190:	55                   	push   %rbp
+    2191:	48 89 fd             	mov    %rdi,%rbp
+    2194:	bf 18 00 00 00       	mov    $0x18,%edi
+    2199:	53                   	push   %rbx
+    219a:	48 83 ec 18          	sub    $0x18,%rsp
+    219e:	48 8d 05 3b 3b 00 00 	lea    0x3b3b(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    21a5:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    21a9:	48 83 c0 18          	add    $0x18,%rax
+    21ad:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    21b2:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    21b7:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    21bb:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    21bf:	e8 9c fe ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    21c4:	48 89 ee             	mov    %rbp,%rsi
+    21c7:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    21cb:	48 89 c3             	mov    %rax,%rbx
+    21ce:	e8 9d ff ff ff       	call   2170 <_ZNSt13runtime_errorC2EPKc@plt>
+    21d3:	0f 28 14 24          	movaps (%rsp),%xmm2
+    21d7:	48 8d 15 62 0a 00 00 	lea    0xa62(%rip),%rdx        # 2c40 <_ZN5boost12static_views12out_of_boundD1Ev>
+    21de:	48 89 df             	mov    %rbx,%rdi
+    21e1:	48 8d 35 28 3a 00 00 	lea    0x3a28(%rip),%rsi        # 5c10 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    21e8:	0f 11 13             	movups %xmm2,(%rbx)
+    21eb:	e8 40 ff ff ff       	call   2130 <__cxa_throw@plt>
+    21f0:	48 89 c5             	mov    %rax,%rbp
+    21f3:	48 89 df             	mov    %rbx,%rdi
+    21f6:	e8 85 fe ff ff       	call   2080 <__cxa_free_exception@plt>
+    21fb:	48 89 ef             	mov    %rbp,%rdi
+    21fe:	e8 4d ff ff ff       	call   2150 <_Unwind_Resume@plt>
+
+0000000000002203 <_ZN5boost12static_views6detail16make_full_bucketEPKc>:
+    2203:	55                   	push   %rbp
+    2204:	48 89 fd             	mov    %rdi,%rbp
+    2207:	bf 18 00 00 00       	mov    $0x18,%edi
+    220c:	53                   	push   %rbx
+    220d:	48 83 ec 18          	sub    $0x18,%rsp
+    2211:	48 8d 05 38 3b 00 00 	lea    0x3b38(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2218:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    221c:	48 83 c0 18          	add    $0x18,%rax
+    2220:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2225:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    222a:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    222e:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2232:	e8 29 fe ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2237:	48 89 ee             	mov    %rbp,%rsi
+    223a:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    223e:	48 89 c3             	mov    %rax,%rbx
+    2241:	e8 2a ff ff ff       	call   2170 <_ZNSt13runtime_errorC2EPKc@plt>
+    2246:	0f 28 14 24          	movaps (%rsp),%xmm2
+    224a:	48 8d 15 5f 0a 00 00 	lea    0xa5f(%rip),%rdx        # 2cb0 <_ZN5boost12static_views11full_bucketD1Ev>
+    2251:	48 89 df             	mov    %rbx,%rdi
+    2254:	48 8d 35 dd 39 00 00 	lea    0x39dd(%rip),%rsi        # 5c38 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    225b:	0f 11 13             	movups %xmm2,(%rbx)
+    225e:	e8 cd fe ff ff       	call   2130 <__cxa_throw@plt>
+    2263:	48 89 c5             	mov    %rax,%rbp
+    2266:	48 89 df             	mov    %rbx,%rdi
+    2269:	e8 12 fe ff ff       	call   2080 <__cxa_free_exception@plt>
+    226e:	48 89 ef             	mov    %rbp,%rdi
+    2271:	e8 da fe ff ff       	call   2150 <_Unwind_Resume@plt>
+
+0000000000002276 <_ZN5boost12static_views6detail17make_out_of_boundEv>:
+    2276:	55                   	push   %rbp
+    2277:	bf 18 00 00 00       	mov    $0x18,%edi
+    227c:	53                   	push   %rbx
+    227d:	48 83 ec 18          	sub    $0x18,%rsp
+    2281:	48 8d 05 58 3a 00 00 	lea    0x3a58(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    2288:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    228c:	48 83 c0 18          	add    $0x18,%rax
+    2290:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2295:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    229a:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    229e:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    22a2:	e8 b9 fd ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    22a7:	48 8d 35 37 1f 00 00 	lea    0x1f37(%rip),%rsi        # 41e5 <_IO_stdin_used+0x1e5>
+    22ae:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    22b2:	48 89 c3             	mov    %rax,%rbx
+    22b5:	e8 b6 fe ff ff       	call   2170 <_ZNSt13runtime_errorC2EPKc@plt>
+    22ba:	0f 28 14 24          	movaps (%rsp),%xmm2
+    22be:	48 8d 15 7b 09 00 00 	lea    0x97b(%rip),%rdx        # 2c40 <_ZN5boost12static_views12out_of_boundD1Ev>
+    22c5:	48 89 df             	mov    %rbx,%rdi
+    22c8:	48 8d 35 41 39 00 00 	lea    0x3941(%rip),%rsi        # 5c10 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    22cf:	0f 11 13             	movups %xmm2,(%rbx)
+    22d2:	e8 59 fe ff ff       	call   2130 <__cxa_throw@plt>
+    22d7:	48 89 c5             	mov    %rax,%rbp
+    22da:	48 89 df             	mov    %rbx,%rdi
+    22dd:	e8 9e fd ff ff       	call   2080 <__cxa_free_exception@plt>
+    22e2:	48 89 ef             	mov    %rbp,%rdi
+    22e5:	e8 66 fe ff ff       	call   2150 <_Unwind_Resume@plt>
+
+00000000000022ea <_ZN5boost12static_views6detail16make_full_bucketEv>:
+    22ea:	55                   	push   %rbp
+    22eb:	bf 18 00 00 00       	mov    $0x18,%edi
+    22f0:	53                   	push   %rbx
+    22f1:	48 83 ec 18          	sub    $0x18,%rsp
+    22f5:	48 8d 05 54 3a 00 00 	lea    0x3a54(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    22fc:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2300:	48 83 c0 18          	add    $0x18,%rax
+    2304:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2309:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    230e:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2312:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2316:	e8 45 fd ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    231b:	48 8d 35 d8 1e 00 00 	lea    0x1ed8(%rip),%rsi        # 41fa <_IO_stdin_used+0x1fa>
+    2322:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    2326:	48 89 c3             	mov    %rax,%rbx
+    2329:	e8 42 fe ff ff       	call   2170 <_ZNSt13runtime_errorC2EPKc@plt>
+    232e:	0f 28 14 24          	movaps (%rsp),%xmm2
+    2332:	48 8d 15 77 09 00 00 	lea    0x977(%rip),%rdx        # 2cb0 <_ZN5boost12static_views11full_bucketD1Ev>
+    2339:	48 89 df             	mov    %rbx,%rdi
+    233c:	48 8d 35 f5 38 00 00 	lea    0x38f5(%rip),%rsi        # 5c38 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2343:	0f 11 13             	movups %xmm2,(%rbx)
+    2346:	e8 e5 fd ff ff       	call   2130 <__cxa_throw@plt>
+    234b:	48 89 c5             	mov    %rax,%rbp
+    234e:	48 89 df             	mov    %rbx,%rdi
+    2351:	e8 2a fd ff ff       	call   2080 <__cxa_free_exception@plt>
+    2356:	48 89 ef             	mov    %rbp,%rdi
+    2359:	e8 f2 fd ff ff       	call   2150 <_Unwind_Resume@plt>
+    235e:	66 90                	xchg   %ax,%ax
+
+0000000000002360 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_13raw_view_implIA100_ivEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>:
+    2360:	83 fe 64             	cmp    $0x64,%esi
+    2363:	77 06                	ja     236b <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_13raw_view_implIA100_ivEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0xb>
+    2365:	48 8b 07             	mov    (%rdi),%rax
+    2368:	89 f2                	mov    %esi,%edx
+    236a:	c3                   	ret
+    236b:	55                   	push   %rbp
+    236c:	bf 18 00 00 00       	mov    $0x18,%edi
+    2371:	53                   	push   %rbx
+    2372:	50                   	push   %rax
+    2373:	e8 e8 fc ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2378:	48 8d 0d c9 1c 00 00 	lea    0x1cc9(%rip),%rcx        # 4048 <_IO_stdin_used+0x48>
+    237f:	ba c4 00 00 00       	mov    $0xc4,%edx
+    2384:	48 8d 35 f5 1c 00 00 	lea    0x1cf5(%rip),%rsi        # 4080 <_IO_stdin_used+0x80>
+    238b:	48 89 c7             	mov    %rax,%rdi
+    238e:	48 89 c3             	mov    %rax,%rbx
+    2391:	e8 aa 0b 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2396:	48 8d 15 83 09 00 00 	lea    0x983(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    239d:	48 8d 35 44 38 00 00 	lea    0x3844(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    23a4:	48 89 df             	mov    %rbx,%rdi
+    23a7:	e8 84 fd ff ff       	call   2130 <__cxa_throw@plt>
+    23ac:	48 89 c5             	mov    %rax,%rbp
+    23af:	48 89 df             	mov    %rbx,%rdi
+    23b2:	e8 c9 fc ff ff       	call   2080 <__cxa_free_exception@plt>
+    23b7:	48 89 ef             	mov    %rbp,%rdi
+    23ba:	e8 91 fd ff ff       	call   2150 <_Unwind_Resume@plt>
+    23bf:	90                   	nop
+
+00000000000023c0 <_ZNK5boost12static_views6detail17take_exactly_implclINS1_14drop_view_implINS0_7wrapperINS1_13raw_view_implIA100_ivEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>:
+    23c0:	85 d2                	test   %edx,%edx
+    23c2:	78 1e                	js     23e2 <_ZNK5boost12static_views6detail17take_exactly_implclINS1_14drop_view_implINS0_7wrapperINS1_13raw_view_implIA100_ivEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0x22>
+    23c4:	48 89 f8             	mov    %rdi,%rax
+    23c7:	8b 7e 08             	mov    0x8(%rsi),%edi
+    23ca:	b9 64 00 00 00       	mov    $0x64,%ecx
+    23cf:	29 f9                	sub    %edi,%ecx
+    23d1:	39 ca                	cmp    %ecx,%edx
+    23d3:	7f 0d                	jg     23e2 <_ZNK5boost12static_views6detail17take_exactly_implclINS1_14drop_view_implINS0_7wrapperINS1_13raw_view_implIA100_ivEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0x22>
+    23d5:	48 8b 0e             	mov    (%rsi),%rcx
+    23d8:	89 78 08             	mov    %edi,0x8(%rax)
+    23db:	89 50 10             	mov    %edx,0x10(%rax)
+    23de:	48 89 08             	mov    %rcx,(%rax)
+    23e1:	c3                   	ret
+    23e2:	55                   	push   %rbp
+    23e3:	bf 18 00 00 00       	mov    $0x18,%edi
+    23e8:	53                   	push   %rbx
+    23e9:	50                   	push   %rax
+    23ea:	e8 71 fc ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    23ef:	48 8d 0d ba 1c 00 00 	lea    0x1cba(%rip),%rcx        # 40b0 <_IO_stdin_used+0xb0>
+    23f6:	ba a9 00 00 00       	mov    $0xa9,%edx
+    23fb:	48 8d 35 e6 1c 00 00 	lea    0x1ce6(%rip),%rsi        # 40e8 <_IO_stdin_used+0xe8>
+    2402:	48 89 c7             	mov    %rax,%rdi
+    2405:	48 89 c3             	mov    %rax,%rbx
+    2408:	e8 33 0b 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    240d:	48 8d 15 0c 09 00 00 	lea    0x90c(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    2414:	48 8d 35 cd 37 00 00 	lea    0x37cd(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    241b:	48 89 df             	mov    %rbx,%rdi
+    241e:	e8 0d fd ff ff       	call   2130 <__cxa_throw@plt>
+    2423:	48 89 c5             	mov    %rax,%rbp
+    2426:	48 89 df             	mov    %rbx,%rdi
+    2429:	e8 52 fc ff ff       	call   2080 <__cxa_free_exception@plt>
+    242e:	48 89 ef             	mov    %rbp,%rdi
+    2431:	e8 1a fd ff ff       	call   2150 <_Unwind_Resume@plt>
+    2436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    243d:	00 00 00 
+
+0000000000002440 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>:
+    2440:	55                   	push   %rbp
+    2441:	53                   	push   %rbx
+    2442:	48 83 ec 08          	sub    $0x8,%rsp
+    2446:	85 d2                	test   %edx,%edx
+    2448:	78 36                	js     2480 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0x40>
+    244a:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    244d:	39 ca                	cmp    %ecx,%edx
+    244f:	7f 2f                	jg     2480 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0x40>
+    2451:	29 d1                	sub    %edx,%ecx
+    2453:	03 56 08             	add    0x8(%rsi),%edx
+    2456:	48 89 f8             	mov    %rdi,%rax
+    2459:	48 8b 3e             	mov    (%rsi),%rdi
+    245c:	83 fa 64             	cmp    $0x64,%edx
+    245f:	0f 87 83 00 00 00    	ja     24e8 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0xa8>
+    2465:	be 64 00 00 00       	mov    $0x64,%esi
+    246a:	48 89 38             	mov    %rdi,(%rax)
+    246d:	29 d6                	sub    %edx,%esi
+    246f:	89 50 08             	mov    %edx,0x8(%rax)
+    2472:	89 48 10             	mov    %ecx,0x10(%rax)
+    2475:	39 f1                	cmp    %esi,%ecx
+    2477:	7f 45                	jg     24be <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0x7e>
+    2479:	48 83 c4 08          	add    $0x8,%rsp
+    247d:	5b                   	pop    %rbx
+    247e:	5d                   	pop    %rbp
+    247f:	c3                   	ret
+    2480:	bf 18 00 00 00       	mov    $0x18,%edi
+    2485:	e8 d6 fb ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    248a:	48 8d 0d b7 1b 00 00 	lea    0x1bb7(%rip),%rcx        # 4048 <_IO_stdin_used+0x48>
+    2491:	ba c4 00 00 00       	mov    $0xc4,%edx
+    2496:	48 8d 35 e3 1b 00 00 	lea    0x1be3(%rip),%rsi        # 4080 <_IO_stdin_used+0x80>
+    249d:	48 89 c7             	mov    %rax,%rdi
+    24a0:	48 89 c3             	mov    %rax,%rbx
+    24a3:	e8 98 0a 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    24a8:	48 8d 15 71 08 00 00 	lea    0x871(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    24af:	48 8d 35 32 37 00 00 	lea    0x3732(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    24b6:	48 89 df             	mov    %rbx,%rdi
+    24b9:	e8 72 fc ff ff       	call   2130 <__cxa_throw@plt>
+    24be:	bf 18 00 00 00       	mov    $0x18,%edi
+    24c3:	e8 98 fb ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    24c8:	48 8d 0d 81 1c 00 00 	lea    0x1c81(%rip),%rcx        # 4150 <_IO_stdin_used+0x150>
+    24cf:	ba 3f 00 00 00       	mov    $0x3f,%edx
+    24d4:	48 8d 35 0d 1c 00 00 	lea    0x1c0d(%rip),%rsi        # 40e8 <_IO_stdin_used+0xe8>
+    24db:	48 89 c7             	mov    %rax,%rdi
+    24de:	48 89 c3             	mov    %rax,%rbx
+    24e1:	e8 5a 0a 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    24e6:	eb c0                	jmp    24a8 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0x68>
+    24e8:	bf 18 00 00 00       	mov    $0x18,%edi
+    24ed:	e8 6e fb ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    24f2:	48 8d 0d 1f 1c 00 00 	lea    0x1c1f(%rip),%rcx        # 4118 <_IO_stdin_used+0x118>
+    24f9:	ba 42 00 00 00       	mov    $0x42,%edx
+    24fe:	48 8d 35 7b 1b 00 00 	lea    0x1b7b(%rip),%rsi        # 4080 <_IO_stdin_used+0x80>
+    2505:	48 89 c7             	mov    %rax,%rdi
+    2508:	48 89 c3             	mov    %rax,%rbx
+    250b:	e8 30 0a 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2510:	eb 96                	jmp    24a8 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0x68>
+    2512:	48 89 c5             	mov    %rax,%rbp
+    2515:	48 89 df             	mov    %rbx,%rdi
+    2518:	e8 63 fb ff ff       	call   2080 <__cxa_free_exception@plt>
+    251d:	48 89 ef             	mov    %rbp,%rdi
+    2520:	e8 2b fc ff ff       	call   2150 <_Unwind_Resume@plt>
+    2525:	eb eb                	jmp    2512 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0xd2>
+    2527:	eb e9                	jmp    2512 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0+0xd2>
+    2529:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002530 <main>:
+    2530:	55                   	push   %rbp
+    2531:	66 0f ef ed          	pxor   %xmm5,%xmm5
+    2535:	31 c0                	xor    %eax,%eax
+    2537:	48 8d 0d e2 3d 00 00 	lea    0x3de2(%rip),%rcx        # 6320 <_ZL4data>
+    253e:	53                   	push   %rbx
+    253f:	66 0f 6f f5          	movdqa %xmm5,%xmm6
+    2543:	48 8d 15 36 3c 00 00 	lea    0x3c36(%rip),%rdx        # 6180 <_ZL7indices>
+    254a:	48 83 ec 08          	sub    $0x8,%rsp
+    254e:	66 0f 6f 1d 8a 1e 00 	movdqa 0x1e8a(%rip),%xmm3        # 43e0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits+0x100>
+    2555:	00 
+    2556:	66 0f 6f 25 62 1e 00 	movdqa 0x1e62(%rip),%xmm4        # 43c0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits+0xe0>
+    255d:	00 
+    255e:	66 0f 6f 3d 6a 1e 00 	movdqa 0x1e6a(%rip),%xmm7        # 43d0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits+0xf0>
+    2565:	00 
+    2566:	66 0f 66 f3          	pcmpgtd %xmm3,%xmm6
+    256a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2570:	66 0f 6f c4          	movdqa %xmm4,%xmm0
+    2574:	66 0f 6f d5          	movdqa %xmm5,%xmm2
+    2578:	66 44 0f 6f c6       	movdqa %xmm6,%xmm8
+    257d:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+    2581:	0f 29 04 01          	movaps %xmm0,(%rcx,%rax,1)
+    2585:	66 44 0f 6f ce       	movdqa %xmm6,%xmm9
+    258a:	66 0f fe e7          	paddd  %xmm7,%xmm4
+    258e:	66 0f 72 f1 03       	pslld  $0x3,%xmm1
+    2593:	66 0f fa c8          	psubd  %xmm0,%xmm1
+    2597:	66 0f 66 d1          	pcmpgtd %xmm1,%xmm2
+    259b:	66 44 0f f4 c1       	pmuludq %xmm1,%xmm8
+    25a0:	66 0f 6f c1          	movdqa %xmm1,%xmm0
+    25a4:	66 0f f4 c3          	pmuludq %xmm3,%xmm0
+    25a8:	66 0f f4 d3          	pmuludq %xmm3,%xmm2
+    25ac:	66 41 0f d4 d0       	paddq  %xmm8,%xmm2
+    25b1:	66 44 0f 6f c5       	movdqa %xmm5,%xmm8
+    25b6:	66 0f 73 f2 20       	psllq  $0x20,%xmm2
+    25bb:	66 0f d4 c2          	paddq  %xmm2,%xmm0
+    25bf:	66 0f 6f d1          	movdqa %xmm1,%xmm2
+    25c3:	66 0f 73 d2 20       	psrlq  $0x20,%xmm2
+    25c8:	66 0f 70 c0 dd       	pshufd $0xdd,%xmm0,%xmm0
+    25cd:	66 44 0f 66 c2       	pcmpgtd %xmm2,%xmm8
+    25d2:	66 44 0f f4 ca       	pmuludq %xmm2,%xmm9
+    25d7:	66 0f f4 d3          	pmuludq %xmm3,%xmm2
+    25db:	66 44 0f f4 c3       	pmuludq %xmm3,%xmm8
+    25e0:	66 45 0f d4 c1       	paddq  %xmm9,%xmm8
+    25e5:	66 41 0f 73 f0 20    	psllq  $0x20,%xmm8
+    25eb:	66 41 0f d4 d0       	paddq  %xmm8,%xmm2
+    25f0:	66 0f 70 d2 dd       	pshufd $0xdd,%xmm2,%xmm2
+    25f5:	66 0f 62 c2          	punpckldq %xmm2,%xmm0
+    25f9:	66 0f 72 e0 05       	psrad  $0x5,%xmm0
+    25fe:	66 0f 6f d0          	movdqa %xmm0,%xmm2
+    2602:	66 0f 72 f2 01       	pslld  $0x1,%xmm2
+    2607:	66 0f fe d0          	paddd  %xmm0,%xmm2
+    260b:	66 0f 72 f2 03       	pslld  $0x3,%xmm2
+    2610:	66 0f fe c2          	paddd  %xmm2,%xmm0
+    2614:	66 0f 72 f0 02       	pslld  $0x2,%xmm0
+    2619:	66 0f fa c8          	psubd  %xmm0,%xmm1
+    261d:	0f 29 0c 02          	movaps %xmm1,(%rdx,%rax,1)
+    2621:	48 83 c0 10          	add    $0x10,%rax
+    2625:	48 3d 90 01 00 00    	cmp    $0x190,%rax
+    262b:	0f 85 3f ff ff ff    	jne    2570 <main+0x40>
+    2631:	31 db                	xor    %ebx,%ebx
+    2633:	83 ff 01             	cmp    $0x1,%edi
+    2636:	7e 12                	jle    264a <main+0x11a>
+    2638:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+    263c:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2641:	31 f6                	xor    %esi,%esi
+    2643:	e8 b8 fa ff ff       	call   2100 <strtol@plt>
+    2648:	89 c3                	mov    %eax,%ebx
+    264a:	89 df                	mov    %ebx,%edi
+    264c:	e8 4f 03 00 00       	call   29a0 <_Z5test1i>
+    2651:	89 df                	mov    %ebx,%edi
+    2653:	89 c5                	mov    %eax,%ebp
+    2655:	e8 06 04 00 00       	call   2a60 <_Z5test2i>
+    265a:	39 c5                	cmp    %eax,%ebp
+    265c:	75 60                	jne    26be <main+0x18e>
+    265e:	89 df                	mov    %ebx,%edi
+    2660:	e8 bb 04 00 00       	call   2b20 <_Z5test3i>
+    2665:	89 df                	mov    %ebx,%edi
+    2667:	89 c5                	mov    %eax,%ebp
+    2669:	e8 42 05 00 00       	call   2bb0 <_Z5test4i>
+    266e:	39 c5                	cmp    %eax,%ebp
+    2670:	75 4c                	jne    26be <main+0x18e>
+    2672:	89 df                	mov    %ebx,%edi
+    2674:	e8 27 03 00 00       	call   29a0 <_Z5test1i>
+    2679:	48 8b 3d 40 39 00 00 	mov    0x3940(%rip),%rdi        # 5fc0 <_ZSt4cout@GLIBCXX_3.4>
+    2680:	89 c6                	mov    %eax,%esi
+    2682:	e8 b9 fa ff ff       	call   2140 <_ZNSolsEi@plt>
+    2687:	be 20 00 00 00       	mov    $0x20,%esi
+    268c:	48 89 c7             	mov    %rax,%rdi
+    268f:	e8 4c fa ff ff       	call   20e0 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_c@plt>
+    2694:	89 df                	mov    %ebx,%edi
+    2696:	48 89 c5             	mov    %rax,%rbp
+    2699:	e8 82 04 00 00       	call   2b20 <_Z5test3i>
+    269e:	48 89 ef             	mov    %rbp,%rdi
+    26a1:	89 c6                	mov    %eax,%esi
+    26a3:	e8 98 fa ff ff       	call   2140 <_ZNSolsEi@plt>
+    26a8:	be 0a 00 00 00       	mov    $0xa,%esi
+    26ad:	48 89 c7             	mov    %rax,%rdi
+    26b0:	e8 2b fa ff ff       	call   20e0 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_c@plt>
+    26b5:	48 83 c4 08          	add    $0x8,%rsp
+    26b9:	31 c0                	xor    %eax,%eax
+    26bb:	5b                   	pop    %rbx
+    26bc:	5d                   	pop    %rbp
+    26bd:	c3                   	ret
+    26be:	e8 6d f9 ff ff       	call   2030 <_ZSt9terminatev@plt>
+    26c3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    26ca:	00 00 00 00 
+    26ce:	66 90                	xchg   %ax,%ax
+
+00000000000026d0 <_GLOBAL__sub_I_fusion.cpp>:
+    26d0:	41 55                	push   %r13
+    26d2:	48 8d 05 a7 3a 00 00 	lea    0x3aa7(%rip),%rax        # 6180 <_ZL7indices>
+    26d9:	41 54                	push   %r12
+    26db:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    26e0:	55                   	push   %rbp
+    26e1:	48 8d 2d 38 3c 00 00 	lea    0x3c38(%rip),%rbp        # 6320 <_ZL4data>
+    26e8:	66 0f 6f d0          	movdqa %xmm0,%xmm2
+    26ec:	53                   	push   %rbx
+    26ed:	66 48 0f 6e cd       	movq   %rbp,%xmm1
+    26f2:	48 8d 1d b7 3d 00 00 	lea    0x3db7(%rip),%rbx        # 64b0 <_ZStL8__ioinit>
+    26f9:	66 0f 6c d2          	punpcklqdq %xmm2,%xmm2
+    26fd:	66 0f 6c c8          	punpcklqdq %xmm0,%xmm1
+    2701:	48 89 df             	mov    %rbx,%rdi
+    2704:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+    270b:	0f 29 0c 24          	movaps %xmm1,(%rsp)
+    270f:	4c 8d 6c 24 40       	lea    0x40(%rsp),%r13
+    2714:	0f 29 54 24 10       	movaps %xmm2,0x10(%rsp)
+    2719:	e8 f2 f9 ff ff       	call   2110 <_ZNSt8ios_base4InitC1Ev@plt>
+    271e:	48 8b 3d bb 38 00 00 	mov    0x38bb(%rip),%rdi        # 5fe0 <_ZNSt8ios_base4InitD1Ev@GLIBCXX_3.4>
+    2725:	48 89 de             	mov    %rbx,%rsi
+    2728:	48 8d 15 81 39 00 00 	lea    0x3981(%rip),%rdx        # 60b0 <__dso_handle>
+    272f:	48 8d 5c 24 60       	lea    0x60(%rsp),%rbx
+    2734:	e8 67 f9 ff ff       	call   20a0 <__cxa_atexit@plt>
+    2739:	48 8d 7c 24 28       	lea    0x28(%rsp),%rdi
+    273e:	48 89 6c 24 28       	mov    %rbp,0x28(%rsp)
+    2743:	44 8b 25 6e 39 00 00 	mov    0x396e(%rip),%r12d        # 60b8 <_ZL6offset>
+    274a:	44 89 e6             	mov    %r12d,%esi
+    274d:	e8 0e fc ff ff       	call   2360 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_13raw_view_implIA100_ivEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>
+    2752:	48 8d 74 24 30       	lea    0x30(%rsp),%rsi
+    2757:	48 89 df             	mov    %rbx,%rdi
+    275a:	48 89 54 24 38       	mov    %rdx,0x38(%rsp)
+    275f:	ba 5a 00 00 00       	mov    $0x5a,%edx
+    2764:	48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    2769:	e8 52 fc ff ff       	call   23c0 <_ZNK5boost12static_views6detail17take_exactly_implclINS1_14drop_view_implINS0_7wrapperINS1_13raw_view_implIA100_ivEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>
+    276e:	44 89 e2             	mov    %r12d,%edx
+    2771:	48 89 de             	mov    %rbx,%rsi
+    2774:	4c 89 ef             	mov    %r13,%rdi
+    2777:	e8 c4 fc ff ff       	call   2440 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>
+    277c:	83 7c 24 50 4f       	cmpl   $0x4f,0x50(%rsp)
+    2781:	0f 8e a5 00 00 00    	jle    282c <_GLOBAL__sub_I_fusion.cpp+0x15c>
+    2787:	48 8b 44 24 40       	mov    0x40(%rsp),%rax
+    278c:	8b 54 24 48          	mov    0x48(%rsp),%edx
+    2790:	c7 44 24 70 50 00 00 	movl   $0x50,0x70(%rsp)
+    2797:	00 
+    2798:	48 89 44 24 60       	mov    %rax,0x60(%rsp)
+    279d:	b8 64 00 00 00       	mov    $0x64,%eax
+    27a2:	29 d0                	sub    %edx,%eax
+    27a4:	89 54 24 68          	mov    %edx,0x68(%rsp)
+    27a8:	83 f8 4f             	cmp    $0x4f,%eax
+    27ab:	0f 8e b9 00 00 00    	jle    286a <_GLOBAL__sub_I_fusion.cpp+0x19a>
+    27b1:	44 89 e2             	mov    %r12d,%edx
+    27b4:	48 89 de             	mov    %rbx,%rsi
+    27b7:	48 8d 3d a2 39 00 00 	lea    0x39a2(%rip),%rdi        # 6160 <_ZL5chain>
+    27be:	e8 7d fc ff ff       	call   2440 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_14take_view_implINS0_7wrapperINS1_14drop_view_implINS5_INS1_13raw_view_implIA100_ivEEEELln1EEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>
+    27c3:	8b 05 ef 38 00 00    	mov    0x38ef(%rip),%eax        # 60b8 <_ZL6offset>
+    27c9:	4c 89 ef             	mov    %r13,%rdi
+    27cc:	48 89 6c 24 40       	mov    %rbp,0x40(%rsp)
+    27d1:	8d 34 40             	lea    (%rax,%rax,2),%esi
+    27d4:	e8 87 fb ff ff       	call   2360 <_ZNK5boost12static_views6detail17drop_exactly_implclINS1_13raw_view_implIA100_ivEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>
+    27d9:	48 89 de             	mov    %rbx,%rsi
+    27dc:	48 8d 3d 5d 39 00 00 	lea    0x395d(%rip),%rdi        # 6140 <_ZL6window>
+    27e3:	48 89 54 24 68       	mov    %rdx,0x68(%rsp)
+    27e8:	ba 4f 00 00 00       	mov    $0x4f,%edx
+    27ed:	48 89 44 24 60       	mov    %rax,0x60(%rsp)
+    27f2:	e8 c9 fb ff ff       	call   23c0 <_ZNK5boost12static_views6detail17take_exactly_implclINS1_14drop_view_implINS0_7wrapperINS1_13raw_view_implIA100_ivEEEELln1EEEvEEDaOT_NSt11remove_cv_t10index_typeE.isra.0>
+    27f7:	66 0f 6f 1c 24       	movdqa (%rsp),%xmm3
+    27fc:	66 0f 6f 64 24 10    	movdqa 0x10(%rsp),%xmm4
+    2802:	0f 29 1d 17 39 00 00 	movaps %xmm3,0x3917(%rip)        # 6120 <_ZL6lookup>
+    2809:	0f 29 25 20 39 00 00 	movaps %xmm4,0x3920(%rip)        # 6130 <_ZL6lookup+0x10>
+    2810:	0f 29 1d e9 38 00 00 	movaps %xmm3,0x38e9(%rip)        # 6100 <_ZL13single_lookup>
+    2817:	0f 29 25 f2 38 00 00 	movaps %xmm4,0x38f2(%rip)        # 6110 <_ZL13single_lookup+0x10>
+    281e:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+    2825:	5b                   	pop    %rbx
+    2826:	5d                   	pop    %rbp
+    2827:	41 5c                	pop    %r12
+    2829:	41 5d                	pop    %r13
+    282b:	c3                   	ret
+    282c:	bf 18 00 00 00       	mov    $0x18,%edi
+    2831:	e8 2a f8 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2836:	48 8d 0d 73 18 00 00 	lea    0x1873(%rip),%rcx        # 40b0 <_IO_stdin_used+0xb0>
+    283d:	ba a9 00 00 00       	mov    $0xa9,%edx
+    2842:	48 8d 35 9f 18 00 00 	lea    0x189f(%rip),%rsi        # 40e8 <_IO_stdin_used+0xe8>
+    2849:	48 89 c7             	mov    %rax,%rdi
+    284c:	48 89 c3             	mov    %rax,%rbx
+    284f:	e8 ec 06 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2854:	48 8d 15 c5 04 00 00 	lea    0x4c5(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    285b:	48 8d 35 86 33 00 00 	lea    0x3386(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2862:	48 89 df             	mov    %rbx,%rdi
+    2865:	e8 c6 f8 ff ff       	call   2130 <__cxa_throw@plt>
+    286a:	bf 18 00 00 00       	mov    $0x18,%edi
+    286f:	e8 ec f7 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2874:	48 8d 0d d5 18 00 00 	lea    0x18d5(%rip),%rcx        # 4150 <_IO_stdin_used+0x150>
+    287b:	ba 3f 00 00 00       	mov    $0x3f,%edx
+    2880:	48 8d 35 61 18 00 00 	lea    0x1861(%rip),%rsi        # 40e8 <_IO_stdin_used+0xe8>
+    2887:	48 89 c7             	mov    %rax,%rdi
+    288a:	48 89 c3             	mov    %rax,%rbx
+    288d:	e8 ae 06 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2892:	eb c0                	jmp    2854 <_GLOBAL__sub_I_fusion.cpp+0x184>
+    2894:	48 89 c5             	mov    %rax,%rbp
+    2897:	48 89 df             	mov    %rbx,%rdi
+    289a:	e8 e1 f7 ff ff       	call   2080 <__cxa_free_exception@plt>
+    289f:	48 89 ef             	mov    %rbp,%rdi
+    28a2:	e8 a9 f8 ff ff       	call   2150 <_Unwind_Resume@plt>
+    28a7:	eb eb                	jmp    2894 <_GLOBAL__sub_I_fusion.cpp+0x1c4>
+    28a9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000028b0 <_start>:
+    28b0:	31 ed                	xor    %ebp,%ebp
+    28b2:	49 89 d1             	mov    %rdx,%r9
+    28b5:	5e                   	pop    %rsi
+    28b6:	48 89 e2             	mov    %rsp,%rdx
+    28b9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    28bd:	50                   	push   %rax
+    28be:	54                   	push   %rsp
+    28bf:	45 31 c0             	xor    %r8d,%r8d
+    28c2:	31 c9                	xor    %ecx,%ecx
+    28c4:	48 8d 3d 65 fc ff ff 	lea    -0x39b(%rip),%rdi        # 2530 <main>
+    28cb:	ff 15 e7 36 00 00    	call   *0x36e7(%rip)        # 5fb8 <__libc_start_main@GLIBC_2.34>
+    28d1:	f4                   	hlt
+    28d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    28d9:	00 00 00 
+    28dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000028e0 <deregister_tm_clones>:
+    28e0:	48 8d 3d f1 37 00 00 	lea    0x37f1(%rip),%rdi        # 60d8 <__TMC_END__>
+    28e7:	48 8d 05 ea 37 00 00 	lea    0x37ea(%rip),%rax        # 60d8 <__TMC_END__>
+    28ee:	48 39 f8             	cmp    %rdi,%rax
+    28f1:	74 15                	je     2908 <deregister_tm_clones+0x28>
+    28f3:	48 8b 05 ce 36 00 00 	mov    0x36ce(%rip),%rax        # 5fc8 <_ITM_deregisterTMCloneTable@Base>
+    28fa:	48 85 c0             	test   %rax,%rax
+    28fd:	74 09                	je     2908 <deregister_tm_clones+0x28>
+    28ff:	ff e0                	jmp    *%rax
+    2901:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2908:	c3                   	ret
+    2909:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002910 <register_tm_clones>:
+    2910:	48 8d 3d c1 37 00 00 	lea    0x37c1(%rip),%rdi        # 60d8 <__TMC_END__>
+    2917:	48 8d 35 ba 37 00 00 	lea    0x37ba(%rip),%rsi        # 60d8 <__TMC_END__>
+    291e:	48 29 fe             	sub    %rdi,%rsi
+    2921:	48 89 f0             	mov    %rsi,%rax
+    2924:	48 c1 ee 3f          	shr    $0x3f,%rsi
+    2928:	48 c1 f8 03          	sar    $0x3,%rax
+    292c:	48 01 c6             	add    %rax,%rsi
+    292f:	48 d1 fe             	sar    %rsi
+    2932:	74 14                	je     2948 <register_tm_clones+0x38>
+    2934:	48 8b 05 9d 36 00 00 	mov    0x369d(%rip),%rax        # 5fd8 <_ITM_registerTMCloneTable@Base>
+    293b:	48 85 c0             	test   %rax,%rax
+    293e:	74 08                	je     2948 <register_tm_clones+0x38>
+    2940:	ff e0                	jmp    *%rax
+    2942:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2948:	c3                   	ret
+    2949:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002950 <__do_global_dtors_aux>:
+    2950:	f3 0f 1e fa          	endbr64
+    2954:	80 3d 85 37 00 00 00 	cmpb   $0x0,0x3785(%rip)        # 60e0 <completed.0>
+    295b:	75 2b                	jne    2988 <__do_global_dtors_aux+0x38>
+    295d:	55                   	push   %rbp
+    295e:	48 83 3d 4a 36 00 00 	cmpq   $0x0,0x364a(%rip)        # 5fb0 <__cxa_finalize@GLIBC_2.2.5>
+    2965:	00 
+    2966:	48 89 e5             	mov    %rsp,%rbp
+    2969:	74 0c                	je     2977 <__do_global_dtors_aux+0x27>
+    296b:	48 8b 3d 3e 37 00 00 	mov    0x373e(%rip),%rdi        # 60b0 <__dso_handle>
+    2972:	e8 09 f8 ff ff       	call   2180 <__cxa_finalize@plt>
+    2977:	e8 64 ff ff ff       	call   28e0 <deregister_tm_clones>
+    297c:	c6 05 5d 37 00 00 01 	movb   $0x1,0x375d(%rip)        # 60e0 <completed.0>
+    2983:	5d                   	pop    %rbp
+    2984:	c3                   	ret
+    2985:	0f 1f 00             	nopl   (%rax)
+    2988:	c3                   	ret
+    2989:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002990 <frame_dummy>:
+    2990:	f3 0f 1e fa          	endbr64
+    2994:	e9 77 ff ff ff       	jmp    2910 <register_tm_clones>
+    2999:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000029a0 <_Z5test1i>:
+    29a0:	55                   	push   %rbp
+    29a1:	53                   	push   %rbx
+    29a2:	48 83 ec 08          	sub    $0x8,%rsp
+    29a6:	85 ff                	test   %edi,%edi
+    29a8:	78 2f                	js     29d9 <_Z5test1i+0x39>
+    29aa:	3b 3d c0 37 00 00    	cmp    0x37c0(%rip),%edi        # 6170 <_ZL5chain+0x10>
+    29b0:	7d 27                	jge    29d9 <_Z5test1i+0x39>
+    29b2:	8b 15 b0 37 00 00    	mov    0x37b0(%rip),%edx        # 6168 <_ZL5chain+0x8>
+    29b8:	b8 64 00 00 00       	mov    $0x64,%eax
+    29bd:	29 d0                	sub    %edx,%eax
+    29bf:	39 c7                	cmp    %eax,%edi
+    29c1:	7d 54                	jge    2a17 <_Z5test1i+0x77>
+    29c3:	48 8b 05 96 37 00 00 	mov    0x3796(%rip),%rax        # 6160 <_ZL5chain>
+    29ca:	01 d7                	add    %edx,%edi
+    29cc:	48 63 ff             	movslq %edi,%rdi
+    29cf:	8b 04 b8             	mov    (%rax,%rdi,4),%eax
+    29d2:	48 83 c4 08          	add    $0x8,%rsp
+    29d6:	5b                   	pop    %rbx
+    29d7:	5d                   	pop    %rbp
+    29d8:	c3                   	ret
+    29d9:	bf 18 00 00 00       	mov    $0x18,%edi
+    29de:	e8 7d f6 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    29e3:	48 8d 0d 9e 17 00 00 	lea    0x179e(%rip),%rcx        # 4188 <_IO_stdin_used+0x188>
+    29ea:	ba 63 00 00 00       	mov    $0x63,%edx
+    29ef:	48 8d 35 f2 16 00 00 	lea    0x16f2(%rip),%rsi        # 40e8 <_IO_stdin_used+0xe8>
+    29f6:	48 89 c7             	mov    %rax,%rdi
+    29f9:	48 89 c3             	mov    %rax,%rbx
+    29fc:	e8 3f 05 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2a01:	48 8d 15 18 03 00 00 	lea    0x318(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    2a08:	48 8d 35 d9 31 00 00 	lea    0x31d9(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2a0f:	48 89 df             	mov    %rbx,%rdi
+    2a12:	e8 19 f7 ff ff       	call   2130 <__cxa_throw@plt>
+    2a17:	bf 18 00 00 00       	mov    $0x18,%edi
+    2a1c:	e8 3f f6 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2a21:	48 8d 0d 60 17 00 00 	lea    0x1760(%rip),%rcx        # 4188 <_IO_stdin_used+0x188>
+    2a28:	ba 6a 00 00 00       	mov    $0x6a,%edx
+    2a2d:	48 8d 35 4c 16 00 00 	lea    0x164c(%rip),%rsi        # 4080 <_IO_stdin_used+0x80>
+    2a34:	48 89 c7             	mov    %rax,%rdi
+    2a37:	48 89 c3             	mov    %rax,%rbx
+    2a3a:	e8 01 05 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2a3f:	eb c0                	jmp    2a01 <_Z5test1i+0x61>
+    2a41:	48 89 c5             	mov    %rax,%rbp
+    2a44:	48 89 df             	mov    %rbx,%rdi
+    2a47:	e8 34 f6 ff ff       	call   2080 <__cxa_free_exception@plt>
+    2a4c:	48 89 ef             	mov    %rbp,%rdi
+    2a4f:	e8 fc f6 ff ff       	call   2150 <_Unwind_Resume@plt>
+    2a54:	eb eb                	jmp    2a41 <_Z5test1i+0xa1>
+    2a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2a5d:	00 00 00 
+
+0000000000002a60 <_Z5test2i>:
+    2a60:	55                   	push   %rbp
+    2a61:	53                   	push   %rbx
+    2a62:	48 83 ec 08          	sub    $0x8,%rsp
+    2a66:	85 ff                	test   %edi,%edi
+    2a68:	78 2f                	js     2a99 <_Z5test2i+0x39>
+    2a6a:	3b 3d e0 36 00 00    	cmp    0x36e0(%rip),%edi        # 6150 <_ZL6window+0x10>
+    2a70:	7d 27                	jge    2a99 <_Z5test2i+0x39>
+    2a72:	8b 15 d0 36 00 00    	mov    0x36d0(%rip),%edx        # 6148 <_ZL6window+0x8>
+    2a78:	b8 64 00 00 00       	mov    $0x64,%eax
+    2a7d:	29 d0                	sub    %edx,%eax
+    2a7f:	39 c7                	cmp    %eax,%edi
+    2a81:	7d 54                	jge    2ad7 <_Z5test2i+0x77>
+    2a83:	48 8b 05 b6 36 00 00 	mov    0x36b6(%rip),%rax        # 6140 <_ZL6window>
+    2a8a:	01 d7                	add    %edx,%edi
+    2a8c:	48 63 ff             	movslq %edi,%rdi
+    2a8f:	8b 04 b8             	mov    (%rax,%rdi,4),%eax
+    2a92:	48 83 c4 08          	add    $0x8,%rsp
+    2a96:	5b                   	pop    %rbx
+    2a97:	5d                   	pop    %rbp
+    2a98:	c3                   	ret
+    2a99:	bf 18 00 00 00       	mov    $0x18,%edi
+    2a9e:	e8 bd f5 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2aa3:	48 8d 0d de 16 00 00 	lea    0x16de(%rip),%rcx        # 4188 <_IO_stdin_used+0x188>
+    2aaa:	ba 63 00 00 00       	mov    $0x63,%edx
+    2aaf:	48 8d 35 32 16 00 00 	lea    0x1632(%rip),%rsi        # 40e8 <_IO_stdin_used+0xe8>
+    2ab6:	48 89 c7             	mov    %rax,%rdi
+    2ab9:	48 89 c3             	mov    %rax,%rbx
+    2abc:	e8 7f 04 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2ac1:	48 8d 15 58 02 00 00 	lea    0x258(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    2ac8:	48 8d 35 19 31 00 00 	lea    0x3119(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2acf:	48 89 df             	mov    %rbx,%rdi
+    2ad2:	e8 59 f6 ff ff       	call   2130 <__cxa_throw@plt>
+    2ad7:	bf 18 00 00 00       	mov    $0x18,%edi
+    2adc:	e8 7f f5 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2ae1:	48 8d 0d a0 16 00 00 	lea    0x16a0(%rip),%rcx        # 4188 <_IO_stdin_used+0x188>
+    2ae8:	ba 6a 00 00 00       	mov    $0x6a,%edx
+    2aed:	48 8d 35 8c 15 00 00 	lea    0x158c(%rip),%rsi        # 4080 <_IO_stdin_used+0x80>
+    2af4:	48 89 c7             	mov    %rax,%rdi
+    2af7:	48 89 c3             	mov    %rax,%rbx
+    2afa:	e8 41 04 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2aff:	eb c0                	jmp    2ac1 <_Z5test2i+0x61>
+    2b01:	48 89 c5             	mov    %rax,%rbp
+    2b04:	48 89 df             	mov    %rbx,%rdi
+    2b07:	e8 74 f5 ff ff       	call   2080 <__cxa_free_exception@plt>
+    2b0c:	48 89 ef             	mov    %rbp,%rdi
+    2b0f:	e8 3c f6 ff ff       	call   2150 <_Unwind_Resume@plt>
+    2b14:	eb eb                	jmp    2b01 <_Z5test2i+0xa1>
+    2b16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2b1d:	00 00 00 
+
+0000000000002b20 <_Z5test3i>:
+    2b20:	83 ff 63             	cmp    $0x63,%edi
+    2b23:	77 2f                	ja     2b54 <_Z5test3i+0x34>
+    2b25:	48 8b 05 0c 36 00 00 	mov    0x360c(%rip),%rax        # 6138 <_ZL6lookup+0x18>
+    2b2c:	48 63 ff             	movslq %edi,%rdi
+    2b2f:	48 63 14 b8          	movslq (%rax,%rdi,4),%rdx
+    2b33:	48 8b 05 f6 35 00 00 	mov    0x35f6(%rip),%rax        # 6130 <_ZL6lookup+0x10>
+    2b3a:	48 63 14 90          	movslq (%rax,%rdx,4),%rdx
+    2b3e:	48 8b 05 e3 35 00 00 	mov    0x35e3(%rip),%rax        # 6128 <_ZL6lookup+0x8>
+    2b45:	48 63 14 90          	movslq (%rax,%rdx,4),%rdx
+    2b49:	48 8b 05 d0 35 00 00 	mov    0x35d0(%rip),%rax        # 6120 <_ZL6lookup>
+    2b50:	8b 04 90             	mov    (%rax,%rdx,4),%eax
+    2b53:	c3                   	ret
+    2b54:	55                   	push   %rbp
+    2b55:	bf 18 00 00 00       	mov    $0x18,%edi
+    2b5a:	53                   	push   %rbx
+    2b5b:	50                   	push   %rax
+    2b5c:	e8 ff f4 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2b61:	48 8d 0d 20 16 00 00 	lea    0x1620(%rip),%rcx        # 4188 <_IO_stdin_used+0x188>
+    2b68:	ba a6 00 00 00       	mov    $0xa6,%edx
+    2b6d:	48 8d 35 44 16 00 00 	lea    0x1644(%rip),%rsi        # 41b8 <_IO_stdin_used+0x1b8>
+    2b74:	48 89 c7             	mov    %rax,%rdi
+    2b77:	48 89 c3             	mov    %rax,%rbx
+    2b7a:	e8 c1 03 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2b7f:	48 8d 15 9a 01 00 00 	lea    0x19a(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    2b86:	48 8d 35 5b 30 00 00 	lea    0x305b(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2b8d:	48 89 df             	mov    %rbx,%rdi
+    2b90:	e8 9b f5 ff ff       	call   2130 <__cxa_throw@plt>
+    2b95:	48 89 c5             	mov    %rax,%rbp
+    2b98:	48 89 df             	mov    %rbx,%rdi
+    2b9b:	e8 e0 f4 ff ff       	call   2080 <__cxa_free_exception@plt>
+    2ba0:	48 89 ef             	mov    %rbp,%rdi
+    2ba3:	e8 a8 f5 ff ff       	call   2150 <_Unwind_Resume@plt>
+    2ba8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2baf:	00 
+
+0000000000002bb0 <_Z5test4i>:
+    2bb0:	83 ff 63             	cmp    $0x63,%edi
+    2bb3:	77 2f                	ja     2be4 <_Z5test4i+0x34>
+    2bb5:	48 8b 05 5c 35 00 00 	mov    0x355c(%rip),%rax        # 6118 <_ZL13single_lookup+0x18>
+    2bbc:	48 63 ff             	movslq %edi,%rdi
+    2bbf:	48 63 14 b8          	movslq (%rax,%rdi,4),%rdx
+    2bc3:	48 8b 05 46 35 00 00 	mov    0x3546(%rip),%rax        # 6110 <_ZL13single_lookup+0x10>
+    2bca:	48 63 14 90          	movslq (%rax,%rdx,4),%rdx
+    2bce:	48 8b 05 33 35 00 00 	mov    0x3533(%rip),%rax        # 6108 <_ZL13single_lookup+0x8>
+    2bd5:	48 63 14 90          	movslq (%rax,%rdx,4),%rdx
+    2bd9:	48 8b 05 20 35 00 00 	mov    0x3520(%rip),%rax        # 6100 <_ZL13single_lookup>
+    2be0:	8b 04 90             	mov    (%rax,%rdx,4),%eax
+    2be3:	c3                   	ret
+    2be4:	55                   	push   %rbp
+    2be5:	bf 18 00 00 00       	mov    $0x18,%edi
+    2bea:	53                   	push   %rbx
+    2beb:	50                   	push   %rax
+    2bec:	e8 6f f4 ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2bf1:	48 8d 0d 90 15 00 00 	lea    0x1590(%rip),%rcx        # 4188 <_IO_stdin_used+0x188>
+    2bf8:	ba a6 00 00 00       	mov    $0xa6,%edx
+    2bfd:	48 8d 35 b4 15 00 00 	lea    0x15b4(%rip),%rsi        # 41b8 <_IO_stdin_used+0x1b8>
+    2c04:	48 89 c7             	mov    %rax,%rdi
+    2c07:	48 89 c3             	mov    %rax,%rbx
+    2c0a:	e8 31 03 00 00       	call   2f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>
+    2c0f:	48 8d 15 0a 01 00 00 	lea    0x10a(%rip),%rdx        # 2d20 <_ZN5boost12static_views17assertion_failureD1Ev>
+    2c16:	48 8d 35 cb 2f 00 00 	lea    0x2fcb(%rip),%rsi        # 5be8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2c1d:	48 89 df             	mov    %rbx,%rdi
+    2c20:	e8 0b f5 ff ff       	call   2130 <__cxa_throw@plt>
+    2c25:	48 89 c5             	mov    %rax,%rbp
+    2c28:	48 89 df             	mov    %rbx,%rdi
+    2c2b:	e8 50 f4 ff ff       	call   2080 <__cxa_free_exception@plt>
+    2c30:	48 89 ef             	mov    %rbp,%rdi
+    2c33:	e8 18 f5 ff ff       	call   2150 <_Unwind_Resume@plt>
+    2c38:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2c3f:	00 
+
+0000000000002c40 <_ZN5boost12static_views12out_of_boundD1Ev>:
+    2c40:	48 8d 05 99 30 00 00 	lea    0x3099(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    2c47:	48 83 c7 08          	add    $0x8,%rdi
+    2c4b:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2c4f:	48 83 c0 18          	add    $0x18,%rax
+    2c53:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2c58:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2c5d:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2c61:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2c65:	e9 56 f4 ff ff       	jmp    20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2c6a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002c70 <_ZTv0_n24_N5boost12static_views12out_of_boundD1Ev>:
+    2c70:	48 8b 07             	mov    (%rdi),%rax
+    2c73:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    2c77:	48 8d 05 62 30 00 00 	lea    0x3062(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    2c7e:	48 83 c7 08          	add    $0x8,%rdi
+    2c82:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2c86:	48 83 c0 18          	add    $0x18,%rax
+    2c8a:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2c8f:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2c94:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2c98:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2c9c:	e9 1f f4 ff ff       	jmp    20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2ca8:	00 00 00 
+    2cab:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002cb0 <_ZN5boost12static_views11full_bucketD1Ev>:
+    2cb0:	48 8d 05 99 30 00 00 	lea    0x3099(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2cb7:	48 83 c7 08          	add    $0x8,%rdi
+    2cbb:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2cbf:	48 83 c0 18          	add    $0x18,%rax
+    2cc3:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2cc8:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2ccd:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2cd1:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2cd5:	e9 e6 f3 ff ff       	jmp    20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2cda:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002ce0 <_ZTv0_n24_N5boost12static_views11full_bucketD1Ev>:
+    2ce0:	48 8b 07             	mov    (%rdi),%rax
+    2ce3:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    2ce7:	48 8d 05 62 30 00 00 	lea    0x3062(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2cee:	48 83 c7 08          	add    $0x8,%rdi
+    2cf2:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2cf6:	48 83 c0 18          	add    $0x18,%rax
+    2cfa:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2cff:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2d04:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2d08:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2d0c:	e9 af f3 ff ff       	jmp    20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2d18:	00 00 00 
+    2d1b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002d20 <_ZN5boost12static_views17assertion_failureD1Ev>:
+    2d20:	48 8d 05 49 2f 00 00 	lea    0x2f49(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2d27:	48 83 c7 08          	add    $0x8,%rdi
+    2d2b:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2d2f:	48 83 c0 18          	add    $0x18,%rax
+    2d33:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2d38:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2d3d:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2d41:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2d45:	e9 76 f3 ff ff       	jmp    20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2d4a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002d50 <_ZTv0_n24_N5boost12static_views17assertion_failureD1Ev>:
+    2d50:	48 8b 07             	mov    (%rdi),%rax
+    2d53:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    2d57:	48 8d 05 12 2f 00 00 	lea    0x2f12(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2d5e:	48 83 c7 08          	add    $0x8,%rdi
+    2d62:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2d66:	48 83 c0 18          	add    $0x18,%rax
+    2d6a:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2d6f:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2d74:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2d78:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2d7c:	e9 3f f3 ff ff       	jmp    20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2d81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2d88:	00 00 00 
+    2d8b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002d90 <_ZN5boost12static_views12out_of_boundD0Ev>:
+    2d90:	48 8d 05 49 2f 00 00 	lea    0x2f49(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    2d97:	53                   	push   %rbx
+    2d98:	48 89 fb             	mov    %rdi,%rbx
+    2d9b:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    2d9f:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2da3:	48 83 c0 18          	add    $0x18,%rax
+    2da7:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2dac:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2db1:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2db5:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2db9:	e8 02 f3 ff ff       	call   20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2dbe:	48 89 df             	mov    %rbx,%rdi
+    2dc1:	be 18 00 00 00       	mov    $0x18,%esi
+    2dc6:	5b                   	pop    %rbx
+    2dc7:	e9 e4 f2 ff ff       	jmp    20b0 <_ZdlPvm@plt>
+    2dcc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002dd0 <_ZTv0_n24_N5boost12static_views12out_of_boundD0Ev>:
+    2dd0:	53                   	push   %rbx
+    2dd1:	48 8b 07             	mov    (%rdi),%rax
+    2dd4:	48 89 fb             	mov    %rdi,%rbx
+    2dd7:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    2ddb:	48 8d 05 fe 2e 00 00 	lea    0x2efe(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    2de2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    2de6:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2dea:	48 83 c0 18          	add    $0x18,%rax
+    2dee:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2df3:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2df8:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2dfc:	0f 11 03             	movups %xmm0,(%rbx)
+    2dff:	e8 bc f2 ff ff       	call   20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2e04:	48 89 df             	mov    %rbx,%rdi
+    2e07:	be 18 00 00 00       	mov    $0x18,%esi
+    2e0c:	5b                   	pop    %rbx
+    2e0d:	e9 9e f2 ff ff       	jmp    20b0 <_ZdlPvm@plt>
+    2e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2e19:	00 00 00 
+    2e1c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002e20 <_ZN5boost12static_views11full_bucketD0Ev>:
+    2e20:	48 8d 05 29 2f 00 00 	lea    0x2f29(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2e27:	53                   	push   %rbx
+    2e28:	48 89 fb             	mov    %rdi,%rbx
+    2e2b:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    2e2f:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2e33:	48 83 c0 18          	add    $0x18,%rax
+    2e37:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2e3c:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2e41:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2e45:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2e49:	e8 72 f2 ff ff       	call   20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2e4e:	48 89 df             	mov    %rbx,%rdi
+    2e51:	be 18 00 00 00       	mov    $0x18,%esi
+    2e56:	5b                   	pop    %rbx
+    2e57:	e9 54 f2 ff ff       	jmp    20b0 <_ZdlPvm@plt>
+    2e5c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002e60 <_ZTv0_n24_N5boost12static_views11full_bucketD0Ev>:
+    2e60:	53                   	push   %rbx
+    2e61:	48 8b 07             	mov    (%rdi),%rax
+    2e64:	48 89 fb             	mov    %rdi,%rbx
+    2e67:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    2e6b:	48 8d 05 de 2e 00 00 	lea    0x2ede(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2e72:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    2e76:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2e7a:	48 83 c0 18          	add    $0x18,%rax
+    2e7e:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2e83:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2e88:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2e8c:	0f 11 03             	movups %xmm0,(%rbx)
+    2e8f:	e8 2c f2 ff ff       	call   20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2e94:	48 89 df             	mov    %rbx,%rdi
+    2e97:	be 18 00 00 00       	mov    $0x18,%esi
+    2e9c:	5b                   	pop    %rbx
+    2e9d:	e9 0e f2 ff ff       	jmp    20b0 <_ZdlPvm@plt>
+    2ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2ea9:	00 00 00 
+    2eac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002eb0 <_ZN5boost12static_views17assertion_failureD0Ev>:
+    2eb0:	48 8d 05 b9 2d 00 00 	lea    0x2db9(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2eb7:	53                   	push   %rbx
+    2eb8:	48 89 fb             	mov    %rdi,%rbx
+    2ebb:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    2ebf:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2ec3:	48 83 c0 18          	add    $0x18,%rax
+    2ec7:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2ecc:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2ed1:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2ed5:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2ed9:	e8 e2 f1 ff ff       	call   20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2ede:	48 89 df             	mov    %rbx,%rdi
+    2ee1:	be 18 00 00 00       	mov    $0x18,%esi
+    2ee6:	5b                   	pop    %rbx
+    2ee7:	e9 c4 f1 ff ff       	jmp    20b0 <_ZdlPvm@plt>
+    2eec:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002ef0 <_ZTv0_n24_N5boost12static_views17assertion_failureD0Ev>:
+    2ef0:	53                   	push   %rbx
+    2ef1:	48 8b 07             	mov    (%rdi),%rax
+    2ef4:	48 89 fb             	mov    %rdi,%rbx
+    2ef7:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    2efb:	48 8d 05 6e 2d 00 00 	lea    0x2d6e(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2f02:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    2f06:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2f0a:	48 83 c0 18          	add    $0x18,%rax
+    2f0e:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2f13:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2f18:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2f1c:	0f 11 03             	movups %xmm0,(%rbx)
+    2f1f:	e8 9c f1 ff ff       	call   20c0 <_ZNSt13runtime_errorD2Ev@plt>
+    2f24:	48 89 df             	mov    %rbx,%rdi
+    2f27:	be 18 00 00 00       	mov    $0x18,%esi
+    2f2c:	5b                   	pop    %rbx
+    2f2d:	e9 7e f1 ff ff       	jmp    20b0 <_ZdlPvm@plt>
+    2f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2f39:	00 00 00 
+    2f3c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002f40 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>:
+    2f40:	41 57                	push   %r15
+    2f42:	41 89 d7             	mov    %edx,%r15d
+    2f45:	48 8d 47 08          	lea    0x8(%rdi),%rax
+    2f49:	41 56                	push   %r14
+    2f4b:	41 c1 ef 1f          	shr    $0x1f,%r15d
+    2f4f:	49 89 ce             	mov    %rcx,%r14
+    2f52:	41 55                	push   %r13
+    2f54:	49 89 f5             	mov    %rsi,%r13
+    2f57:	41 54                	push   %r12
+    2f59:	41 89 d4             	mov    %edx,%r12d
+    2f5c:	55                   	push   %rbp
+    2f5d:	53                   	push   %rbx
+    2f5e:	48 81 ec 48 01 00 00 	sub    $0x148,%rsp
+    2f65:	41 f7 dc             	neg    %r12d
+    2f68:	44 0f 48 e2          	cmovs  %edx,%r12d
+    2f6c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+    2f71:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    2f76:	41 83 fc 09          	cmp    $0x9,%r12d
+    2f7a:	0f 86 3a 06 00 00    	jbe    35ba <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x67a>
+    2f80:	41 83 fc 63          	cmp    $0x63,%r12d
+    2f84:	0f 86 1e 08 00 00    	jbe    37a8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x868>
+    2f8a:	41 81 fc e7 03 00 00 	cmp    $0x3e7,%r12d
+    2f91:	0f 86 63 08 00 00    	jbe    37fa <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8ba>
+    2f97:	44 89 e3             	mov    %r12d,%ebx
+    2f9a:	41 81 fc 0f 27 00 00 	cmp    $0x270f,%r12d
+    2fa1:	0f 86 44 08 00 00    	jbe    37eb <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8ab>
+    2fa7:	be 05 00 00 00       	mov    $0x5,%esi
+    2fac:	48 81 fb 9f 86 01 00 	cmp    $0x1869f,%rbx
+    2fb3:	0f 86 54 06 00 00    	jbe    360d <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6cd>
+    2fb9:	48 81 fb 3f 42 0f 00 	cmp    $0xf423f,%rbx
+    2fc0:	0f 86 46 08 00 00    	jbe    380c <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8cc>
+    2fc6:	b9 06 00 00 00       	mov    $0x6,%ecx
+    2fcb:	be 07 00 00 00       	mov    $0x7,%esi
+    2fd0:	48 81 fb 7f 96 98 00 	cmp    $0x98967f,%rbx
+    2fd7:	0f 86 33 06 00 00    	jbe    3610 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    2fdd:	48 81 fb ff e0 f5 05 	cmp    $0x5f5e0ff,%rbx
+    2fe4:	0f 86 7e 07 00 00    	jbe    3768 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x828>
+    2fea:	48 81 fb ff c9 9a 3b 	cmp    $0x3b9ac9ff,%rbx
+    2ff1:	0f 86 11 06 00 00    	jbe    3608 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6c8>
+    2ff7:	b9 09 00 00 00       	mov    $0x9,%ecx
+    2ffc:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    3003:	00 
+    3004:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    300b:	00 
+    300c:	89 0c 24             	mov    %ecx,(%rsp)
+    300f:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    3014:	42 8d 74 39 01       	lea    0x1(%rcx,%r15,1),%esi
+    3019:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    3020:	00 
+    3021:	ba 2d 00 00 00       	mov    $0x2d,%edx
+    3026:	e8 a5 f0 ff ff       	call   20d0 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>
+    302b:	41 0f b6 d7          	movzbl %r15b,%edx
+    302f:	8b 0c 24             	mov    (%rsp),%ecx
+    3032:	48 8d 35 a7 12 00 00 	lea    0x12a7(%rip),%rsi        # 42e0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits>
+    3039:	48 03 94 24 20 01 00 	add    0x120(%rsp),%rdx
+    3040:	00 
+    3041:	eb 07                	jmp    304a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x10a>
+    3043:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    3048:	89 db                	mov    %ebx,%ebx
+    304a:	48 69 db 1f 85 eb 51 	imul   $0x51eb851f,%rbx,%rbx
+    3051:	44 89 e0             	mov    %r12d,%eax
+    3054:	41 89 c8             	mov    %ecx,%r8d
+    3057:	48 c1 eb 25          	shr    $0x25,%rbx
+    305b:	6b fb 64             	imul   $0x64,%ebx,%edi
+    305e:	29 f8                	sub    %edi,%eax
+    3060:	44 89 e7             	mov    %r12d,%edi
+    3063:	41 89 dc             	mov    %ebx,%r12d
+    3066:	01 c0                	add    %eax,%eax
+    3068:	44 8d 48 01          	lea    0x1(%rax),%r9d
+    306c:	0f b6 04 06          	movzbl (%rsi,%rax,1),%eax
+    3070:	46 0f b6 0c 0e       	movzbl (%rsi,%r9,1),%r9d
+    3075:	46 88 0c 02          	mov    %r9b,(%rdx,%r8,1)
+    3079:	44 8d 41 ff          	lea    -0x1(%rcx),%r8d
+    307d:	83 e9 02             	sub    $0x2,%ecx
+    3080:	42 88 04 02          	mov    %al,(%rdx,%r8,1)
+    3084:	81 ff 0f 27 00 00    	cmp    $0x270f,%edi
+    308a:	77 bc                	ja     3048 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x108>
+    308c:	81 ff e7 03 00 00    	cmp    $0x3e7,%edi
+    3092:	0f 86 60 05 00 00    	jbe    35f8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6b8>
+    3098:	45 01 e4             	add    %r12d,%r12d
+    309b:	41 8d 44 24 01       	lea    0x1(%r12),%eax
+    30a0:	46 0f b6 24 26       	movzbl (%rsi,%r12,1),%r12d
+    30a5:	0f b6 04 06          	movzbl (%rsi,%rax,1),%eax
+    30a9:	88 42 01             	mov    %al,0x1(%rdx)
+    30ac:	44 88 22             	mov    %r12b,(%rdx)
+    30af:	48 8d 9c 24 e0 00 00 	lea    0xe0(%rsp),%rbx
+    30b6:	00 
+    30b7:	31 d2                	xor    %edx,%edx
+    30b9:	4c 8d a4 24 00 01 00 	lea    0x100(%rsp),%r12
+    30c0:	00 
+    30c1:	48 8d 84 24 10 01 00 	lea    0x110(%rsp),%rax
+    30c8:	00 
+    30c9:	48 89 de             	mov    %rbx,%rsi
+    30cc:	4c 89 e7             	mov    %r12,%rdi
+    30cf:	48 c7 84 24 e0 00 00 	movq   $0x16,0xe0(%rsp)
+    30d6:	00 16 00 00 00 
+    30db:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    30e0:	48 89 84 24 00 01 00 	mov    %rax,0x100(%rsp)
+    30e7:	00 
+    30e8:	e8 73 f0 ff ff       	call   2160 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@plt>
+    30ed:	48 8b 94 24 e0 00 00 	mov    0xe0(%rsp),%rdx
+    30f4:	00 
+    30f5:	66 0f 6f 05 b3 12 00 	movdqa 0x12b3(%rip),%xmm0        # 43b0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits+0xd0>
+    30fc:	00 
+    30fd:	4c 89 ef             	mov    %r13,%rdi
+    3100:	48 b9 75 72 65 20 69 	movabs $0x27206e6920657275,%rcx
+    3107:	6e 20 27 
+    310a:	48 89 84 24 00 01 00 	mov    %rax,0x100(%rsp)
+    3111:	00 
+    3112:	48 89 94 24 10 01 00 	mov    %rdx,0x110(%rsp)
+    3119:	00 
+    311a:	0f 11 00             	movups %xmm0,(%rax)
+    311d:	48 89 48 0e          	mov    %rcx,0xe(%rax)
+    3121:	48 8b 84 24 00 01 00 	mov    0x100(%rsp),%rax
+    3128:	00 
+    3129:	48 89 94 24 08 01 00 	mov    %rdx,0x108(%rsp)
+    3130:	00 
+    3131:	c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+    3135:	e8 16 ef ff ff       	call   2050 <strlen@plt>
+    313a:	48 89 c2             	mov    %rax,%rdx
+    313d:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    3144:	ff ff 3f 
+    3147:	48 2b 84 24 08 01 00 	sub    0x108(%rsp),%rax
+    314e:	00 
+    314f:	48 39 d0             	cmp    %rdx,%rax
+    3152:	0f 82 fa 06 00 00    	jb     3852 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x912>
+    3158:	4c 89 ee             	mov    %r13,%rsi
+    315b:	4c 89 e7             	mov    %r12,%rdi
+    315e:	e8 dd ee ff ff       	call   2040 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    3163:	49 89 c4             	mov    %rax,%r12
+    3166:	48 8d 84 24 f0 00 00 	lea    0xf0(%rsp),%rax
+    316d:	00 
+    316e:	48 89 84 24 e0 00 00 	mov    %rax,0xe0(%rsp)
+    3175:	00 
+    3176:	49 8b 14 24          	mov    (%r12),%rdx
+    317a:	4d 8d 6c 24 10       	lea    0x10(%r12),%r13
+    317f:	48 89 04 24          	mov    %rax,(%rsp)
+    3183:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+    3188:	4c 39 ea             	cmp    %r13,%rdx
+    318b:	0f 84 c7 04 00 00    	je     3658 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x718>
+    3191:	48 89 94 24 e0 00 00 	mov    %rdx,0xe0(%rsp)
+    3198:	00 
+    3199:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+    319e:	48 89 94 24 f0 00 00 	mov    %rdx,0xf0(%rsp)
+    31a5:	00 
+    31a6:	48 89 84 24 e8 00 00 	mov    %rax,0xe8(%rsp)
+    31ad:	00 
+    31ae:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    31b5:	ff ff 3f 
+    31b8:	49 c7 44 24 08 00 00 	movq   $0x0,0x8(%r12)
+    31bf:	00 00 
+    31c1:	41 c6 44 24 10 00    	movb   $0x0,0x10(%r12)
+    31c7:	48 2b 84 24 e8 00 00 	sub    0xe8(%rsp),%rax
+    31ce:	00 
+    31cf:	4d 89 2c 24          	mov    %r13,(%r12)
+    31d3:	48 83 f8 09          	cmp    $0x9,%rax
+    31d7:	0f 86 45 06 00 00    	jbe    3822 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8e2>
+    31dd:	ba 0a 00 00 00       	mov    $0xa,%edx
+    31e2:	48 8d 35 30 0e 00 00 	lea    0xe30(%rip),%rsi        # 4019 <_IO_stdin_used+0x19>
+    31e9:	48 89 df             	mov    %rbx,%rdi
+    31ec:	e8 4f ee ff ff       	call   2040 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    31f1:	48 8d 9c 24 d0 00 00 	lea    0xd0(%rsp),%rbx
+    31f8:	00 
+    31f9:	49 89 c4             	mov    %rax,%r12
+    31fc:	48 89 9c 24 c0 00 00 	mov    %rbx,0xc0(%rsp)
+    3203:	00 
+    3204:	48 8b 00             	mov    (%rax),%rax
+    3207:	4d 8d 6c 24 10       	lea    0x10(%r12),%r13
+    320c:	4d 8b 44 24 08       	mov    0x8(%r12),%r8
+    3211:	4c 39 e8             	cmp    %r13,%rax
+    3214:	0f 84 66 04 00 00    	je     3680 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x740>
+    321a:	48 89 84 24 c0 00 00 	mov    %rax,0xc0(%rsp)
+    3221:	00 
+    3222:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+    3227:	48 89 84 24 d0 00 00 	mov    %rax,0xd0(%rsp)
+    322e:	00 
+    322f:	4d 89 2c 24          	mov    %r13,(%r12)
+    3233:	48 8b 8c 24 c0 00 00 	mov    0xc0(%rsp),%rcx
+    323a:	00 
+    323b:	4c 89 84 24 c8 00 00 	mov    %r8,0xc8(%rsp)
+    3242:	00 
+    3243:	48 8b b4 24 20 01 00 	mov    0x120(%rsp),%rsi
+    324a:	00 
+    324b:	49 c7 44 24 08 00 00 	movq   $0x0,0x8(%r12)
+    3252:	00 00 
+    3254:	48 8b 94 24 28 01 00 	mov    0x128(%rsp),%rdx
+    325b:	00 
+    325c:	41 c6 44 24 10 00    	movb   $0x0,0x10(%r12)
+    3262:	49 8d 04 10          	lea    (%r8,%rdx,1),%rax
+    3266:	48 39 d9             	cmp    %rbx,%rcx
+    3269:	0f 84 21 05 00 00    	je     3790 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x850>
+    326f:	48 39 84 24 d0 00 00 	cmp    %rax,0xd0(%rsp)
+    3276:	00 
+    3277:	73 1a                	jae    3293 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x353>
+    3279:	48 39 ee             	cmp    %rbp,%rsi
+    327c:	0f 84 fe 04 00 00    	je     3780 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x840>
+    3282:	48 8b bc 24 30 01 00 	mov    0x130(%rsp),%rdi
+    3289:	00 
+    328a:	48 39 c7             	cmp    %rax,%rdi
+    328d:	0f 83 ad 03 00 00    	jae    3640 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x700>
+    3293:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    329a:	ff ff 3f 
+    329d:	4c 29 c0             	sub    %r8,%rax
+    32a0:	48 39 d0             	cmp    %rdx,%rax
+    32a3:	0f 82 9d 05 00 00    	jb     3846 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x906>
+    32a9:	48 8d bc 24 c0 00 00 	lea    0xc0(%rsp),%rdi
+    32b0:	00 
+    32b1:	e8 8a ed ff ff       	call   2040 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    32b6:	4c 8d a4 24 b0 00 00 	lea    0xb0(%rsp),%r12
+    32bd:	00 
+    32be:	4c 8d 78 10          	lea    0x10(%rax),%r15
+    32c2:	49 89 c5             	mov    %rax,%r13
+    32c5:	4c 89 a4 24 a0 00 00 	mov    %r12,0xa0(%rsp)
+    32cc:	00 
+    32cd:	48 8b 10             	mov    (%rax),%rdx
+    32d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    32d4:	4c 39 fa             	cmp    %r15,%rdx
+    32d7:	0f 84 63 04 00 00    	je     3740 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x800>
+    32dd:	48 89 94 24 a0 00 00 	mov    %rdx,0xa0(%rsp)
+    32e4:	00 
+    32e5:	49 8b 55 10          	mov    0x10(%r13),%rdx
+    32e9:	48 89 94 24 b0 00 00 	mov    %rdx,0xb0(%rsp)
+    32f0:	00 
+    32f1:	48 89 84 24 a8 00 00 	mov    %rax,0xa8(%rsp)
+    32f8:	00 
+    32f9:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    3300:	ff ff 3f 
+    3303:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+    330a:	00 
+    330b:	41 c6 45 10 00       	movb   $0x0,0x10(%r13)
+    3310:	48 2b 84 24 a8 00 00 	sub    0xa8(%rsp),%rax
+    3317:	00 
+    3318:	4d 89 7d 00          	mov    %r15,0x0(%r13)
+    331c:	48 83 f8 0b          	cmp    $0xb,%rax
+    3320:	0f 86 f0 04 00 00    	jbe    3816 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8d6>
+    3326:	48 8d bc 24 a0 00 00 	lea    0xa0(%rsp),%rdi
+    332d:	00 
+    332e:	ba 0c 00 00 00       	mov    $0xc,%edx
+    3333:	48 8d 35 ea 0c 00 00 	lea    0xcea(%rip),%rsi        # 4024 <_IO_stdin_used+0x24>
+    333a:	e8 01 ed ff ff       	call   2040 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    333f:	4c 8d ac 24 90 00 00 	lea    0x90(%rsp),%r13
+    3346:	00 
+    3347:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    334b:	49 89 c7             	mov    %rax,%r15
+    334e:	4c 89 ac 24 80 00 00 	mov    %r13,0x80(%rsp)
+    3355:	00 
+    3356:	48 8b 10             	mov    (%rax),%rdx
+    3359:	48 8b 40 08          	mov    0x8(%rax),%rax
+    335d:	48 39 ca             	cmp    %rcx,%rdx
+    3360:	0f 84 aa 03 00 00    	je     3710 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x7d0>
+    3366:	48 89 94 24 80 00 00 	mov    %rdx,0x80(%rsp)
+    336d:	00 
+    336e:	49 8b 57 10          	mov    0x10(%r15),%rdx
+    3372:	48 89 94 24 90 00 00 	mov    %rdx,0x90(%rsp)
+    3379:	00 
+    337a:	49 89 0f             	mov    %rcx,(%r15)
+    337d:	4c 89 f7             	mov    %r14,%rdi
+    3380:	49 c7 47 08 00 00 00 	movq   $0x0,0x8(%r15)
+    3387:	00 
+    3388:	41 c6 47 10 00       	movb   $0x0,0x10(%r15)
+    338d:	48 89 84 24 88 00 00 	mov    %rax,0x88(%rsp)
+    3394:	00 
+    3395:	e8 b6 ec ff ff       	call   2050 <strlen@plt>
+    339a:	48 89 c2             	mov    %rax,%rdx
+    339d:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    33a4:	ff ff 3f 
+    33a7:	48 2b 84 24 88 00 00 	sub    0x88(%rsp),%rax
+    33ae:	00 
+    33af:	48 39 d0             	cmp    %rdx,%rax
+    33b2:	0f 82 82 04 00 00    	jb     383a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8fa>
+    33b8:	48 8d bc 24 80 00 00 	lea    0x80(%rsp),%rdi
+    33bf:	00 
+    33c0:	4c 89 f6             	mov    %r14,%rsi
+    33c3:	e8 78 ec ff ff       	call   2040 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    33c8:	4c 8d 74 24 70       	lea    0x70(%rsp),%r14
+    33cd:	49 89 c7             	mov    %rax,%r15
+    33d0:	4c 89 74 24 60       	mov    %r14,0x60(%rsp)
+    33d5:	48 8b 00             	mov    (%rax),%rax
+    33d8:	49 8d 4f 10          	lea    0x10(%r15),%rcx
+    33dc:	49 8b 57 08          	mov    0x8(%r15),%rdx
+    33e0:	48 39 c8             	cmp    %rcx,%rax
+    33e3:	0f 84 f7 02 00 00    	je     36e0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x7a0>
+    33e9:	48 89 44 24 60       	mov    %rax,0x60(%rsp)
+    33ee:	49 8b 47 10          	mov    0x10(%r15),%rax
+    33f2:	48 89 44 24 70       	mov    %rax,0x70(%rsp)
+    33f7:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    33fe:	ff ff 3f 
+    3401:	48 89 54 24 68       	mov    %rdx,0x68(%rsp)
+    3406:	48 29 d0             	sub    %rdx,%rax
+    3409:	49 89 0f             	mov    %rcx,(%r15)
+    340c:	49 c7 47 08 00 00 00 	movq   $0x0,0x8(%r15)
+    3413:	00 
+    3414:	41 c6 47 10 00       	movb   $0x0,0x10(%r15)
+    3419:	48 83 f8 0e          	cmp    $0xe,%rax
+    341d:	0f 86 0b 04 00 00    	jbe    382e <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8ee>
+    3423:	48 8d 7c 24 60       	lea    0x60(%rsp),%rdi
+    3428:	ba 0f 00 00 00       	mov    $0xf,%edx
+    342d:	48 8d 35 fd 0b 00 00 	lea    0xbfd(%rip),%rsi        # 4031 <_IO_stdin_used+0x31>
+    3434:	e8 07 ec ff ff       	call   2040 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    3439:	48 89 c1             	mov    %rax,%rcx
+    343c:	48 8d 05 2d 28 00 00 	lea    0x282d(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    3443:	4c 8d 7c 24 50       	lea    0x50(%rsp),%r15
+    3448:	4c 89 7c 24 40       	mov    %r15,0x40(%rsp)
+    344d:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+    3451:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    3455:	48 83 c0 18          	add    $0x18,%rax
+    3459:	66 48 0f 6e c8       	movq   %rax,%xmm1
+    345e:	66 48 0f 6e d2       	movq   %rdx,%xmm2
+    3463:	48 8b 11             	mov    (%rcx),%rdx
+    3466:	48 8b 41 08          	mov    0x8(%rcx),%rax
+    346a:	66 0f 6c ca          	punpcklqdq %xmm2,%xmm1
+    346e:	0f 29 4c 24 10       	movaps %xmm1,0x10(%rsp)
+    3473:	48 39 f2             	cmp    %rsi,%rdx
+    3476:	0f 84 2c 02 00 00    	je     36a8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x768>
+    347c:	48 89 54 24 40       	mov    %rdx,0x40(%rsp)
+    3481:	48 8b 51 10          	mov    0x10(%rcx),%rdx
+    3485:	48 89 54 24 50       	mov    %rdx,0x50(%rsp)
+    348a:	48 89 31             	mov    %rsi,(%rcx)
+    348d:	48 8b 7c 24 20       	mov    0x20(%rsp),%rdi
+    3492:	48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    3497:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+    349e:	00 
+    349f:	c6 41 10 00          	movb   $0x0,0x10(%rcx)
+    34a3:	48 89 44 24 48       	mov    %rax,0x48(%rsp)
+    34a8:	e8 43 ec ff ff       	call   20f0 <_ZNSt13runtime_errorC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE@plt>
+    34ad:	48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    34b2:	4c 39 ff             	cmp    %r15,%rdi
+    34b5:	74 0e                	je     34c5 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x585>
+    34b7:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+    34bc:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    34c0:	e8 eb eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    34c5:	48 8b 7c 24 60       	mov    0x60(%rsp),%rdi
+    34ca:	4c 39 f7             	cmp    %r14,%rdi
+    34cd:	74 0e                	je     34dd <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x59d>
+    34cf:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+    34d4:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    34d8:	e8 d3 eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    34dd:	48 8b bc 24 80 00 00 	mov    0x80(%rsp),%rdi
+    34e4:	00 
+    34e5:	4c 39 ef             	cmp    %r13,%rdi
+    34e8:	74 11                	je     34fb <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x5bb>
+    34ea:	48 8b 84 24 90 00 00 	mov    0x90(%rsp),%rax
+    34f1:	00 
+    34f2:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    34f6:	e8 b5 eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    34fb:	48 8b bc 24 a0 00 00 	mov    0xa0(%rsp),%rdi
+    3502:	00 
+    3503:	4c 39 e7             	cmp    %r12,%rdi
+    3506:	74 11                	je     3519 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x5d9>
+    3508:	48 8b 84 24 b0 00 00 	mov    0xb0(%rsp),%rax
+    350f:	00 
+    3510:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3514:	e8 97 eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    3519:	48 8b bc 24 c0 00 00 	mov    0xc0(%rsp),%rdi
+    3520:	00 
+    3521:	48 39 df             	cmp    %rbx,%rdi
+    3524:	74 11                	je     3537 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x5f7>
+    3526:	48 8b 84 24 d0 00 00 	mov    0xd0(%rsp),%rax
+    352d:	00 
+    352e:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3532:	e8 79 eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    3537:	48 8b bc 24 e0 00 00 	mov    0xe0(%rsp),%rdi
+    353e:	00 
+    353f:	48 8b 04 24          	mov    (%rsp),%rax
+    3543:	48 39 c7             	cmp    %rax,%rdi
+    3546:	74 11                	je     3559 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x619>
+    3548:	48 8b 84 24 f0 00 00 	mov    0xf0(%rsp),%rax
+    354f:	00 
+    3550:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3554:	e8 57 eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    3559:	48 8b bc 24 00 01 00 	mov    0x100(%rsp),%rdi
+    3560:	00 
+    3561:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    3566:	48 39 c7             	cmp    %rax,%rdi
+    3569:	74 11                	je     357c <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x63c>
+    356b:	48 8b 84 24 10 01 00 	mov    0x110(%rsp),%rax
+    3572:	00 
+    3573:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3577:	e8 34 eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    357c:	48 8b bc 24 20 01 00 	mov    0x120(%rsp),%rdi
+    3583:	00 
+    3584:	48 39 ef             	cmp    %rbp,%rdi
+    3587:	74 11                	je     359a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x65a>
+    3589:	48 8b 84 24 30 01 00 	mov    0x130(%rsp),%rax
+    3590:	00 
+    3591:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3595:	e8 16 eb ff ff       	call   20b0 <_ZdlPvm@plt>
+    359a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    359f:	66 0f 6f 5c 24 10    	movdqa 0x10(%rsp),%xmm3
+    35a5:	0f 11 18             	movups %xmm3,(%rax)
+    35a8:	48 81 c4 48 01 00 00 	add    $0x148,%rsp
+    35af:	5b                   	pop    %rbx
+    35b0:	5d                   	pop    %rbp
+    35b1:	41 5c                	pop    %r12
+    35b3:	41 5d                	pop    %r13
+    35b5:	41 5e                	pop    %r14
+    35b7:	41 5f                	pop    %r15
+    35b9:	c3                   	ret
+    35ba:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    35c1:	00 
+    35c2:	ba 2d 00 00 00       	mov    $0x2d,%edx
+    35c7:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    35ce:	00 
+    35cf:	41 8d 77 01          	lea    0x1(%r15),%esi
+    35d3:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    35d8:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    35df:	00 
+    35e0:	e8 eb ea ff ff       	call   20d0 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>
+    35e5:	41 0f b6 d7          	movzbl %r15b,%edx
+    35e9:	48 03 94 24 20 01 00 	add    0x120(%rsp),%rdx
+    35f0:	00 
+    35f1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    35f8:	41 83 c4 30          	add    $0x30,%r12d
+    35fc:	e9 ab fa ff ff       	jmp    30ac <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x16c>
+    3601:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3608:	be 09 00 00 00       	mov    $0x9,%esi
+    360d:	8d 4e ff             	lea    -0x1(%rsi),%ecx
+    3610:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    3617:	00 
+    3618:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    361f:	00 
+    3620:	89 0c 24             	mov    %ecx,(%rsp)
+    3623:	44 01 fe             	add    %r15d,%esi
+    3626:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    362b:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    3632:	00 
+    3633:	e9 e9 f9 ff ff       	jmp    3021 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xe1>
+    3638:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    363f:	00 
+    3640:	48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    3645:	31 d2                	xor    %edx,%edx
+    3647:	31 f6                	xor    %esi,%esi
+    3649:	e8 d2 ea ff ff       	call   2120 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm@plt>
+    364e:	e9 63 fc ff ff       	jmp    32b6 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x376>
+    3653:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    3658:	48 89 c2             	mov    %rax,%rdx
+    365b:	48 83 c2 01          	add    $0x1,%rdx
+    365f:	0f 84 41 fb ff ff    	je     31a6 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x266>
+    3665:	48 8b 3c 24          	mov    (%rsp),%rdi
+    3669:	4c 89 ee             	mov    %r13,%rsi
+    366c:	e8 1f ea ff ff       	call   2090 <memcpy@plt>
+    3671:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+    3676:	e9 2b fb ff ff       	jmp    31a6 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x266>
+    367b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    3680:	4c 89 c2             	mov    %r8,%rdx
+    3683:	48 83 c2 01          	add    $0x1,%rdx
+    3687:	0f 84 a2 fb ff ff    	je     322f <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x2ef>
+    368d:	4c 89 ee             	mov    %r13,%rsi
+    3690:	48 89 df             	mov    %rbx,%rdi
+    3693:	e8 f8 e9 ff ff       	call   2090 <memcpy@plt>
+    3698:	4d 8b 44 24 08       	mov    0x8(%r12),%r8
+    369d:	e9 8d fb ff ff       	jmp    322f <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x2ef>
+    36a2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    36a8:	48 89 c2             	mov    %rax,%rdx
+    36ab:	48 83 c2 01          	add    $0x1,%rdx
+    36af:	0f 84 d5 fd ff ff    	je     348a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x54a>
+    36b5:	4c 89 ff             	mov    %r15,%rdi
+    36b8:	48 89 4c 24 38       	mov    %rcx,0x38(%rsp)
+    36bd:	48 89 74 24 30       	mov    %rsi,0x30(%rsp)
+    36c2:	e8 c9 e9 ff ff       	call   2090 <memcpy@plt>
+    36c7:	48 8b 4c 24 38       	mov    0x38(%rsp),%rcx
+    36cc:	48 8b 74 24 30       	mov    0x30(%rsp),%rsi
+    36d1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+    36d5:	e9 b0 fd ff ff       	jmp    348a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x54a>
+    36da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    36e0:	48 89 d0             	mov    %rdx,%rax
+    36e3:	48 83 c0 01          	add    $0x1,%rax
+    36e7:	0f 84 0a fd ff ff    	je     33f7 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x4b7>
+    36ed:	48 89 c2             	mov    %rax,%rdx
+    36f0:	48 89 ce             	mov    %rcx,%rsi
+    36f3:	4c 89 f7             	mov    %r14,%rdi
+    36f6:	48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    36fb:	e8 90 e9 ff ff       	call   2090 <memcpy@plt>
+    3700:	49 8b 57 08          	mov    0x8(%r15),%rdx
+    3704:	48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    3709:	e9 e9 fc ff ff       	jmp    33f7 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x4b7>
+    370e:	66 90                	xchg   %ax,%ax
+    3710:	48 89 c2             	mov    %rax,%rdx
+    3713:	48 83 c2 01          	add    $0x1,%rdx
+    3717:	0f 84 5d fc ff ff    	je     337a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x43a>
+    371d:	48 89 ce             	mov    %rcx,%rsi
+    3720:	4c 89 ef             	mov    %r13,%rdi
+    3723:	48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    3728:	e8 63 e9 ff ff       	call   2090 <memcpy@plt>
+    372d:	49 8b 47 08          	mov    0x8(%r15),%rax
+    3731:	48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    3736:	e9 3f fc ff ff       	jmp    337a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x43a>
+    373b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    3740:	48 89 c2             	mov    %rax,%rdx
+    3743:	48 83 c2 01          	add    $0x1,%rdx
+    3747:	0f 84 a4 fb ff ff    	je     32f1 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x3b1>
+    374d:	4c 89 fe             	mov    %r15,%rsi
+    3750:	4c 89 e7             	mov    %r12,%rdi
+    3753:	e8 38 e9 ff ff       	call   2090 <memcpy@plt>
+    3758:	49 8b 45 08          	mov    0x8(%r13),%rax
+    375c:	e9 90 fb ff ff       	jmp    32f1 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x3b1>
+    3761:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3768:	b9 07 00 00 00       	mov    $0x7,%ecx
+    376d:	be 08 00 00 00       	mov    $0x8,%esi
+    3772:	e9 99 fe ff ff       	jmp    3610 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    3777:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    377e:	00 00 
+    3780:	bf 0f 00 00 00       	mov    $0xf,%edi
+    3785:	e9 00 fb ff ff       	jmp    328a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x34a>
+    378a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    3790:	48 83 f8 0f          	cmp    $0xf,%rax
+    3794:	0f 86 f9 fa ff ff    	jbe    3293 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x353>
+    379a:	48 39 ee             	cmp    %rbp,%rsi
+    379d:	0f 85 df fa ff ff    	jne    3282 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x342>
+    37a3:	e9 eb fa ff ff       	jmp    3293 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x353>
+    37a8:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    37af:	00 
+    37b0:	41 8d 77 02          	lea    0x2(%r15),%esi
+    37b4:	ba 2d 00 00 00       	mov    $0x2d,%edx
+    37b9:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    37c0:	00 
+    37c1:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    37c6:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    37cd:	00 
+    37ce:	e8 fd e8 ff ff       	call   20d0 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>
+    37d3:	41 0f b6 d7          	movzbl %r15b,%edx
+    37d7:	48 8d 35 02 0b 00 00 	lea    0xb02(%rip),%rsi        # 42e0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits>
+    37de:	48 03 94 24 20 01 00 	add    0x120(%rsp),%rdx
+    37e5:	00 
+    37e6:	e9 ad f8 ff ff       	jmp    3098 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x158>
+    37eb:	b9 03 00 00 00       	mov    $0x3,%ecx
+    37f0:	be 04 00 00 00       	mov    $0x4,%esi
+    37f5:	e9 16 fe ff ff       	jmp    3610 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    37fa:	b9 02 00 00 00       	mov    $0x2,%ecx
+    37ff:	be 03 00 00 00       	mov    $0x3,%esi
+    3804:	44 89 e3             	mov    %r12d,%ebx
+    3807:	e9 04 fe ff ff       	jmp    3610 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    380c:	b9 05 00 00 00       	mov    $0x5,%ecx
+    3811:	e9 e6 f7 ff ff       	jmp    2ffc <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xbc>
+    3816:	48 8d 3d e7 07 00 00 	lea    0x7e7(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    381d:	e8 4e e8 ff ff       	call   2070 <_ZSt20__throw_length_errorPKc@plt>
+    3822:	48 8d 3d db 07 00 00 	lea    0x7db(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    3829:	e8 42 e8 ff ff       	call   2070 <_ZSt20__throw_length_errorPKc@plt>
+    382e:	48 8d 3d cf 07 00 00 	lea    0x7cf(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    3835:	e8 36 e8 ff ff       	call   2070 <_ZSt20__throw_length_errorPKc@plt>
+    383a:	48 8d 3d c3 07 00 00 	lea    0x7c3(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    3841:	e8 2a e8 ff ff       	call   2070 <_ZSt20__throw_length_errorPKc@plt>
+    3846:	48 8d 3d b7 07 00 00 	lea    0x7b7(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    384d:	e8 1e e8 ff ff       	call   2070 <_ZSt20__throw_length_errorPKc@plt>
+    3852:	48 8d 3d ab 07 00 00 	lea    0x7ab(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    3859:	e8 12 e8 ff ff       	call   2070 <_ZSt20__throw_length_errorPKc@plt>
+    385e:	49 89 c5             	mov    %rax,%r13
+    3861:	48 8b bc 24 a0 00 00 	mov    0xa0(%rsp),%rdi
+    3868:	00 
+    3869:	4c 39 e7             	cmp    %r12,%rdi
+    386c:	74 11                	je     387f <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x93f>
+    386e:	48 8b 84 24 b0 00 00 	mov    0xb0(%rsp),%rax
+    3875:	00 
+    3876:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    387a:	e8 31 e8 ff ff       	call   20b0 <_ZdlPvm@plt>
+    387f:	48 8b bc 24 c0 00 00 	mov    0xc0(%rsp),%rdi
+    3886:	00 
+    3887:	48 39 df             	cmp    %rbx,%rdi
+    388a:	74 11                	je     389d <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x95d>
+    388c:	48 8b 84 24 d0 00 00 	mov    0xd0(%rsp),%rax
+    3893:	00 
+    3894:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3898:	e8 13 e8 ff ff       	call   20b0 <_ZdlPvm@plt>
+    389d:	4c 89 eb             	mov    %r13,%rbx
+    38a0:	48 8b bc 24 e0 00 00 	mov    0xe0(%rsp),%rdi
+    38a7:	00 
+    38a8:	48 8b 04 24          	mov    (%rsp),%rax
+    38ac:	48 39 c7             	cmp    %rax,%rdi
+    38af:	74 11                	je     38c2 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x982>
+    38b1:	48 8b 84 24 f0 00 00 	mov    0xf0(%rsp),%rax
+    38b8:	00 
+    38b9:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    38bd:	e8 ee e7 ff ff       	call   20b0 <_ZdlPvm@plt>
+    38c2:	48 8b bc 24 00 01 00 	mov    0x100(%rsp),%rdi
+    38c9:	00 
+    38ca:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    38cf:	48 39 c7             	cmp    %rax,%rdi
+    38d2:	74 11                	je     38e5 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9a5>
+    38d4:	48 8b 84 24 10 01 00 	mov    0x110(%rsp),%rax
+    38db:	00 
+    38dc:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    38e0:	e8 cb e7 ff ff       	call   20b0 <_ZdlPvm@plt>
+    38e5:	48 8b bc 24 20 01 00 	mov    0x120(%rsp),%rdi
+    38ec:	00 
+    38ed:	48 39 ef             	cmp    %rbp,%rdi
+    38f0:	74 11                	je     3903 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9c3>
+    38f2:	48 8b 84 24 30 01 00 	mov    0x130(%rsp),%rax
+    38f9:	00 
+    38fa:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    38fe:	e8 ad e7 ff ff       	call   20b0 <_ZdlPvm@plt>
+    3903:	48 89 df             	mov    %rbx,%rdi
+    3906:	e8 45 e8 ff ff       	call   2150 <_Unwind_Resume@plt>
+    390b:	49 89 c7             	mov    %rax,%r15
+    390e:	48 8b 7c 24 60       	mov    0x60(%rsp),%rdi
+    3913:	4c 39 f7             	cmp    %r14,%rdi
+    3916:	74 0e                	je     3926 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9e6>
+    3918:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+    391d:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3921:	e8 8a e7 ff ff       	call   20b0 <_ZdlPvm@plt>
+    3926:	48 8b bc 24 80 00 00 	mov    0x80(%rsp),%rdi
+    392d:	00 
+    392e:	4c 39 ef             	cmp    %r13,%rdi
+    3931:	74 11                	je     3944 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xa04>
+    3933:	48 8b 84 24 90 00 00 	mov    0x90(%rsp),%rax
+    393a:	00 
+    393b:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    393f:	e8 6c e7 ff ff       	call   20b0 <_ZdlPvm@plt>
+    3944:	4d 89 fd             	mov    %r15,%r13
+    3947:	e9 15 ff ff ff       	jmp    3861 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x921>
+    394c:	49 89 c7             	mov    %rax,%r15
+    394f:	eb d5                	jmp    3926 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9e6>
+    3951:	49 89 c5             	mov    %rax,%r13
+    3954:	e9 26 ff ff ff       	jmp    387f <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x93f>
+    3959:	48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    395e:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    3963:	4c 39 ff             	cmp    %r15,%rdi
+    3966:	74 0e                	je     3976 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xa36>
+    3968:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+    396d:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3971:	e8 3a e7 ff ff       	call   20b0 <_ZdlPvm@plt>
+    3976:	4c 8b 7c 24 20       	mov    0x20(%rsp),%r15
+    397b:	eb 91                	jmp    390e <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9ce>
+    397d:	48 89 c3             	mov    %rax,%rbx
+    3980:	e9 1b ff ff ff       	jmp    38a0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x960>
+    3985:	48 89 c3             	mov    %rax,%rbx
+    3988:	e9 58 ff ff ff       	jmp    38e5 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9a5>
+    398d:	48 89 c3             	mov    %rax,%rbx
+    3990:	e9 2d ff ff ff       	jmp    38c2 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x982>
+
+Disassembly of section .fini:
+
+0000000000003998 <_fini>:
+    3998:	48 83 ec 08          	sub    $0x8,%rsp
+    399c:	48 83 c4 08          	add    $0x8,%rsp
+    39a0:	c3                   	ret
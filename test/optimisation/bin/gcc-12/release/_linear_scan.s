@@ -0,0 +1,642 @@
+
+bin/gcc-12/release/_linear_scan:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000002000 <_init>:
+    2000:	48 83 ec 08          	sub    $0x8,%rsp
+    2004:	48 8b 05 ad 2f 00 00 	mov    0x2fad(%rip),%rax        # 4fb8 <__gmon_start__@Base>
+    200b:	48 85 c0             	test   %rax,%rax
+    200e:	74 02                	je     2012 <_init+0x12>
+    2010:	ff d0                	call   *%rax
+    2012:	48 83 c4 08          	add    $0x8,%rsp
+    2016:	c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000002020 <_ZNSo3putEc@plt-0x10>:
+    2020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    2026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    202c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002030 <_ZNSo3putEc@plt>:
+    2030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 5000 <_ZNSo3putEc@GLIBCXX_3.4>
+    2036:	68 00 00 00 00       	push   $0x0
+    203b:	e9 e0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002040 <__errno_location@plt>:
+    2040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 5008 <__errno_location@GLIBC_2.2.5>
+    2046:	68 01 00 00 00       	push   $0x1
+    204b:	e9 d0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002050 <strlen@plt>:
+    2050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 5010 <strlen@GLIBC_2.2.5>
+    2056:	68 02 00 00 00       	push   $0x2
+    205b:	e9 c0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002060 <__cxa_allocate_exception@plt>:
+    2060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 5018 <__cxa_allocate_exception@CXXABI_1.3>
+    2066:	68 03 00 00 00       	push   $0x3
+    206b:	e9 b0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002070 <_ZSt24__throw_invalid_argumentPKc@plt>:
+    2070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 5020 <_ZSt24__throw_invalid_argumentPKc@GLIBCXX_3.4>
+    2076:	68 04 00 00 00       	push   $0x4
+    207b:	e9 a0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002080 <_ZSt19__throw_logic_errorPKc@plt>:
+    2080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 5028 <_ZSt19__throw_logic_errorPKc@GLIBCXX_3.4>
+    2086:	68 05 00 00 00       	push   $0x5
+    208b:	e9 90 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002090 <__cxa_free_exception@plt>:
+    2090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 5030 <__cxa_free_exception@CXXABI_1.3>
+    2096:	68 06 00 00 00       	push   $0x6
+    209b:	e9 80 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020a0 <memcpy@plt>:
+    20a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    20a6:	68 07 00 00 00       	push   $0x7
+    20ab:	e9 70 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020b0 <__cxa_atexit@plt>:
+    20b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 5040 <__cxa_atexit@GLIBC_2.2.5>
+    20b6:	68 08 00 00 00       	push   $0x8
+    20bb:	e9 60 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020c0 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_PKc@plt>:
+    20c0:	ff 25 82 2f 00 00    	jmp    *0x2f82(%rip)        # 5048 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_PKc@GLIBCXX_3.4>
+    20c6:	68 09 00 00 00       	push   $0x9
+    20cb:	e9 50 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020d0 <_ZdlPvm@plt>:
+    20d0:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 5050 <_ZdlPvm@CXXABI_1.3.9>
+    20d6:	68 0a 00 00 00       	push   $0xa
+    20db:	e9 40 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020e0 <_ZNSt13runtime_errorD2Ev@plt>:
+    20e0:	ff 25 72 2f 00 00    	jmp    *0x2f72(%rip)        # 5058 <_ZNSt13runtime_errorD2Ev@GLIBCXX_3.4>
+    20e6:	68 0b 00 00 00       	push   $0xb
+    20eb:	e9 30 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020f0 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@plt>:
+    20f0:	ff 25 6a 2f 00 00    	jmp    *0x2f6a(%rip)        # 5060 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@GLIBCXX_3.4.9>
+    20f6:	68 0c 00 00 00       	push   $0xc
+    20fb:	e9 20 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002100 <strtol@plt>:
+    2100:	ff 25 62 2f 00 00    	jmp    *0x2f62(%rip)        # 5068 <strtol@GLIBC_2.2.5>
+    2106:	68 0d 00 00 00       	push   $0xd
+    210b:	e9 10 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002110 <_ZSt20__throw_out_of_rangePKc@plt>:
+    2110:	ff 25 5a 2f 00 00    	jmp    *0x2f5a(%rip)        # 5070 <_ZSt20__throw_out_of_rangePKc@GLIBCXX_3.4>
+    2116:	68 0e 00 00 00       	push   $0xe
+    211b:	e9 00 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002120 <_ZNSt8ios_base4InitC1Ev@plt>:
+    2120:	ff 25 52 2f 00 00    	jmp    *0x2f52(%rip)        # 5078 <_ZNSt8ios_base4InitC1Ev@GLIBCXX_3.4>
+    2126:	68 0f 00 00 00       	push   $0xf
+    212b:	e9 f0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002130 <__cxa_throw@plt>:
+    2130:	ff 25 4a 2f 00 00    	jmp    *0x2f4a(%rip)        # 5080 <__cxa_throw@CXXABI_1.3>
+    2136:	68 10 00 00 00       	push   $0x10
+    213b:	e9 e0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002140 <_Unwind_Resume@plt>:
+    2140:	ff 25 42 2f 00 00    	jmp    *0x2f42(%rip)        # 5088 <_Unwind_Resume@GCC_3.0>
+    2146:	68 11 00 00 00       	push   $0x11
+    214b:	e9 d0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002150 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@plt>:
+    2150:	ff 25 3a 2f 00 00    	jmp    *0x2f3a(%rip)        # 5090 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@GLIBCXX_3.4.21>
+    2156:	68 12 00 00 00       	push   $0x12
+    215b:	e9 c0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002160 <_ZNSt13runtime_errorC2EPKc@plt>:
+    2160:	ff 25 32 2f 00 00    	jmp    *0x2f32(%rip)        # 5098 <_ZNSt13runtime_errorC2EPKc@GLIBCXX_3.4.21>
+    2166:	68 13 00 00 00       	push   $0x13
+    216b:	e9 b0 fe ff ff       	jmp    2020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000002170 <__cxa_finalize@plt>:
+    2170:	ff 25 22 2e 00 00    	jmp    *0x2e22(%rip)        # 4f98 <__cxa_finalize@GLIBC_2.2.5>
+    2176:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000002180 <_ZN5boost12static_views6detail17make_out_of_boundEPKc>:
+    2180:	55                   	push   %rbp
+    2181:	48 89 fd             	mov    %rdi,%rbp
+    2184:	bf 18 00 00 00       	mov    $0x18,%edi
+    2189:	53                   	push   %rbx
+    218a:	48 83 ec 18          	sub    $0x18,%rsp
+    218e:	48 8d 05 33 2b 00 00 	lea    0x2b33(%rip),%rax        # 4cc8 <_ZTVN5boost12static_views12out_of_boundE>
+    2195:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2199:	48 83 c0 18          	add    $0x18,%rax
+    219d:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    21a2:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    21a7:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    21ab:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    21af:	e8 ac fe ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    21b4:	48 89 ee             	mov    %rbp,%rsi
+    21b7:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    21bb:	48 89 c3             	mov    %rax,%rbx
+    21be:	e8 9d ff ff ff       	call   2160 <_ZNSt13runtime_errorC2EPKc@plt>
+    21c3:	0f 28 14 24          	movaps (%rsp),%xmm2
+    21c7:	48 8d 15 12 05 00 00 	lea    0x512(%rip),%rdx        # 26e0 <_ZN5boost12static_views12out_of_boundD1Ev>
+    21ce:	48 89 df             	mov    %rbx,%rdi
+    21d1:	48 8d 35 90 2a 00 00 	lea    0x2a90(%rip),%rsi        # 4c68 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    21d8:	0f 11 13             	movups %xmm2,(%rbx)
+    21db:	e8 50 ff ff ff       	call   2130 <__cxa_throw@plt>
+    21e0:	48 89 c5             	mov    %rax,%rbp
+    21e3:	48 89 df             	mov    %rbx,%rdi
+    21e6:	e8 a5 fe ff ff       	call   2090 <__cxa_free_exception@plt>
+    21eb:	48 89 ef             	mov    %rbp,%rdi
+    21ee:	e8 4d ff ff ff       	call   2140 <_Unwind_Resume@plt>
+
+00000000000021f3 <_ZN5boost12static_views6detail16make_full_bucketEPKc>:
+    21f3:	55                   	push   %rbp
+    21f4:	48 89 fd             	mov    %rdi,%rbp
+    21f7:	bf 18 00 00 00       	mov    $0x18,%edi
+    21fc:	53                   	push   %rbx
+    21fd:	48 83 ec 18          	sub    $0x18,%rsp
+    2201:	48 8d 05 30 2b 00 00 	lea    0x2b30(%rip),%rax        # 4d38 <_ZTVN5boost12static_views11full_bucketE>
+    2208:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    220c:	48 83 c0 18          	add    $0x18,%rax
+    2210:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2215:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    221a:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    221e:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2222:	e8 39 fe ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2227:	48 89 ee             	mov    %rbp,%rsi
+    222a:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    222e:	48 89 c3             	mov    %rax,%rbx
+    2231:	e8 2a ff ff ff       	call   2160 <_ZNSt13runtime_errorC2EPKc@plt>
+    2236:	0f 28 14 24          	movaps (%rsp),%xmm2
+    223a:	48 8d 15 0f 05 00 00 	lea    0x50f(%rip),%rdx        # 2750 <_ZN5boost12static_views11full_bucketD1Ev>
+    2241:	48 89 df             	mov    %rbx,%rdi
+    2244:	48 8d 35 45 2a 00 00 	lea    0x2a45(%rip),%rsi        # 4c90 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    224b:	0f 11 13             	movups %xmm2,(%rbx)
+    224e:	e8 dd fe ff ff       	call   2130 <__cxa_throw@plt>
+    2253:	48 89 c5             	mov    %rax,%rbp
+    2256:	48 89 df             	mov    %rbx,%rdi
+    2259:	e8 32 fe ff ff       	call   2090 <__cxa_free_exception@plt>
+    225e:	48 89 ef             	mov    %rbp,%rdi
+    2261:	e8 da fe ff ff       	call   2140 <_Unwind_Resume@plt>
+
+0000000000002266 <_ZN5boost12static_views6detail17make_out_of_boundEv>:
+    2266:	55                   	push   %rbp
+    2267:	bf 18 00 00 00       	mov    $0x18,%edi
+    226c:	53                   	push   %rbx
+    226d:	48 83 ec 18          	sub    $0x18,%rsp
+    2271:	48 8d 05 50 2a 00 00 	lea    0x2a50(%rip),%rax        # 4cc8 <_ZTVN5boost12static_views12out_of_boundE>
+    2278:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    227c:	48 83 c0 18          	add    $0x18,%rax
+    2280:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2285:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    228a:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    228e:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2292:	e8 c9 fd ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    2297:	48 8d 35 66 0d 00 00 	lea    0xd66(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    229e:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    22a2:	48 89 c3             	mov    %rax,%rbx
+    22a5:	e8 b6 fe ff ff       	call   2160 <_ZNSt13runtime_errorC2EPKc@plt>
+    22aa:	0f 28 14 24          	movaps (%rsp),%xmm2
+    22ae:	48 8d 15 2b 04 00 00 	lea    0x42b(%rip),%rdx        # 26e0 <_ZN5boost12static_views12out_of_boundD1Ev>
+    22b5:	48 89 df             	mov    %rbx,%rdi
+    22b8:	48 8d 35 a9 29 00 00 	lea    0x29a9(%rip),%rsi        # 4c68 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    22bf:	0f 11 13             	movups %xmm2,(%rbx)
+    22c2:	e8 69 fe ff ff       	call   2130 <__cxa_throw@plt>
+    22c7:	48 89 c5             	mov    %rax,%rbp
+    22ca:	48 89 df             	mov    %rbx,%rdi
+    22cd:	e8 be fd ff ff       	call   2090 <__cxa_free_exception@plt>
+    22d2:	48 89 ef             	mov    %rbp,%rdi
+    22d5:	e8 66 fe ff ff       	call   2140 <_Unwind_Resume@plt>
+
+00000000000022da <_ZN5boost12static_views6detail16make_full_bucketEv>:
+    22da:	55                   	push   %rbp
+    22db:	bf 18 00 00 00       	mov    $0x18,%edi
+    22e0:	53                   	push   %rbx
+    22e1:	48 83 ec 18          	sub    $0x18,%rsp
+    22e5:	48 8d 05 4c 2a 00 00 	lea    0x2a4c(%rip),%rax        # 4d38 <_ZTVN5boost12static_views11full_bucketE>
+    22ec:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    22f0:	48 83 c0 18          	add    $0x18,%rax
+    22f4:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    22f9:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    22fe:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2302:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2306:	e8 55 fd ff ff       	call   2060 <__cxa_allocate_exception@plt>
+    230b:	48 8d 35 07 0d 00 00 	lea    0xd07(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    2312:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    2316:	48 89 c3             	mov    %rax,%rbx
+    2319:	e8 42 fe ff ff       	call   2160 <_ZNSt13runtime_errorC2EPKc@plt>
+    231e:	0f 28 14 24          	movaps (%rsp),%xmm2
+    2322:	48 8d 15 27 04 00 00 	lea    0x427(%rip),%rdx        # 2750 <_ZN5boost12static_views11full_bucketD1Ev>
+    2329:	48 89 df             	mov    %rbx,%rdi
+    232c:	48 8d 35 5d 29 00 00 	lea    0x295d(%rip),%rsi        # 4c90 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2333:	0f 11 13             	movups %xmm2,(%rbx)
+    2336:	e8 f5 fd ff ff       	call   2130 <__cxa_throw@plt>
+    233b:	48 89 c5             	mov    %rax,%rbp
+    233e:	48 89 df             	mov    %rbx,%rdi
+    2341:	e8 4a fd ff ff       	call   2090 <__cxa_free_exception@plt>
+    2346:	48 89 ef             	mov    %rbp,%rdi
+    2349:	e8 f2 fd ff ff       	call   2140 <_Unwind_Resume@plt>
+
+000000000000234e <main.cold>:
+    234e:	83 3b 00             	cmpl   $0x0,(%rbx)
+    2351:	75 03                	jne    2356 <main.cold+0x8>
+    2353:	44 89 3b             	mov    %r15d,(%rbx)
+    2356:	48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    235b:	48 39 ef             	cmp    %rbp,%rdi
+    235e:	74 0e                	je     236e <main.cold+0x20>
+    2360:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    2365:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2369:	e8 62 fd ff ff       	call   20d0 <_ZdlPvm@plt>
+    236e:	4c 89 e7             	mov    %r12,%rdi
+    2371:	e8 ca fd ff ff       	call   2140 <_Unwind_Resume@plt>
+    2376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    237d:	00 00 00 
+
+0000000000002380 <main>:
+    2380:	41 57                	push   %r15
+    2382:	41 56                	push   %r14
+    2384:	41 55                	push   %r13
+    2386:	41 54                	push   %r12
+    2388:	55                   	push   %rbp
+    2389:	53                   	push   %rbx
+    238a:	48 83 ec 38          	sub    $0x38,%rsp
+    238e:	83 ff 02             	cmp    $0x2,%edi
+    2391:	74 24                	je     23b7 <main+0x37>
+    2393:	48 8b 3d 0e 2c 00 00 	mov    0x2c0e(%rip),%rdi        # 4fa8 <_ZSt4cout@GLIBCXX_3.4>
+    239a:	48 8d 35 88 0c 00 00 	lea    0xc88(%rip),%rsi        # 3029 <_IO_stdin_used+0x29>
+    23a1:	e8 1a fd ff ff       	call   20c0 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_PKc@plt>
+    23a6:	48 83 c4 38          	add    $0x38,%rsp
+    23aa:	31 c0                	xor    %eax,%eax
+    23ac:	5b                   	pop    %rbx
+    23ad:	5d                   	pop    %rbp
+    23ae:	41 5c                	pop    %r12
+    23b0:	41 5d                	pop    %r13
+    23b2:	41 5e                	pop    %r14
+    23b4:	41 5f                	pop    %r15
+    23b6:	c3                   	ret
+    23b7:	4c 8b 6e 08          	mov    0x8(%rsi),%r13
+    23bb:	48 8d 6c 24 20       	lea    0x20(%rsp),%rbp
+    23c0:	4c 8d 64 24 10       	lea    0x10(%rsp),%r12
+    23c5:	48 89 6c 24 10       	mov    %rbp,0x10(%rsp)
+    23ca:	4d 85 ed             	test   %r13,%r13
+    23cd:	0f 84 3e 01 00 00    	je     2511 <main+0x191>
+    23d3:	4c 89 ef             	mov    %r13,%rdi
+    23d6:	e8 75 fc ff ff       	call   2050 <strlen@plt>
+    23db:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    23e0:	48 89 c3             	mov    %rax,%rbx
+    23e3:	48 83 f8 0f          	cmp    $0xf,%rax
+    23e7:	0f 87 f0 00 00 00    	ja     24dd <main+0x15d>
+    23ed:	48 83 f8 01          	cmp    $0x1,%rax
+    23f1:	0f 85 d3 00 00 00    	jne    24ca <main+0x14a>
+    23f7:	41 0f b6 45 00       	movzbl 0x0(%r13),%eax
+    23fc:	4c 8d 74 24 08       	lea    0x8(%rsp),%r14
+    2401:	88 44 24 20          	mov    %al,0x20(%rsp)
+    2405:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    240a:	48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    240f:	48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    2414:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+    2418:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+    241d:	e8 1e fc ff ff       	call   2040 <__errno_location@plt>
+    2422:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2427:	4c 89 f6             	mov    %r14,%rsi
+    242a:	4c 89 ef             	mov    %r13,%rdi
+    242d:	44 8b 38             	mov    (%rax),%r15d
+    2430:	48 89 c3             	mov    %rax,%rbx
+    2433:	31 c0                	xor    %eax,%eax
+    2435:	89 03                	mov    %eax,(%rbx)
+    2437:	e8 c4 fc ff ff       	call   2100 <strtol@plt>
+    243c:	4c 3b 6c 24 08       	cmp    0x8(%rsp),%r13
+    2441:	0f 84 e2 00 00 00    	je     2529 <main+0x1a9>
+    2447:	8b 13                	mov    (%rbx),%edx
+    2449:	83 fa 22             	cmp    $0x22,%edx
+    244c:	0f 84 cb 00 00 00    	je     251d <main+0x19d>
+    2452:	85 d2                	test   %edx,%edx
+    2454:	75 03                	jne    2459 <main+0xd9>
+    2456:	44 89 3b             	mov    %r15d,(%rbx)
+    2459:	48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    245e:	89 c3                	mov    %eax,%ebx
+    2460:	48 39 ef             	cmp    %rbp,%rdi
+    2463:	74 0e                	je     2473 <main+0xf3>
+    2465:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    246a:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    246e:	e8 5d fc ff ff       	call   20d0 <_ZdlPvm@plt>
+    2473:	89 df                	mov    %ebx,%edi
+    2475:	e8 e6 01 00 00       	call   2660 <_Z5test1i>
+    247a:	48 85 c0             	test   %rax,%rax
+    247d:	0f 84 23 ff ff ff    	je     23a6 <main+0x26>
+    2483:	48 8b 3d 1e 2b 00 00 	mov    0x2b1e(%rip),%rdi        # 4fa8 <_ZSt4cout@GLIBCXX_3.4>
+    248a:	48 89 c6             	mov    %rax,%rsi
+    248d:	e8 2e fc ff ff       	call   20c0 <_ZStlsISt11char_traitsIcEERSt13basic_ostreamIcT_ES5_PKc@plt>
+    2492:	c6 44 24 10 0a       	movb   $0xa,0x10(%rsp)
+    2497:	48 89 c7             	mov    %rax,%rdi
+    249a:	48 8b 00             	mov    (%rax),%rax
+    249d:	48 8b 40 e8          	mov    -0x18(%rax),%rax
+    24a1:	48 83 7c 07 10 00    	cmpq   $0x0,0x10(%rdi,%rax,1)
+    24a7:	74 12                	je     24bb <main+0x13b>
+    24a9:	ba 01 00 00 00       	mov    $0x1,%edx
+    24ae:	4c 89 e6             	mov    %r12,%rsi
+    24b1:	e8 3a fc ff ff       	call   20f0 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@plt>
+    24b6:	e9 eb fe ff ff       	jmp    23a6 <main+0x26>
+    24bb:	be 0a 00 00 00       	mov    $0xa,%esi
+    24c0:	e8 6b fb ff ff       	call   2030 <_ZNSo3putEc@plt>
+    24c5:	e9 dc fe ff ff       	jmp    23a6 <main+0x26>
+    24ca:	4c 8d 74 24 08       	lea    0x8(%rsp),%r14
+    24cf:	48 85 c0             	test   %rax,%rax
+    24d2:	0f 84 2d ff ff ff    	je     2405 <main+0x85>
+    24d8:	48 89 ef             	mov    %rbp,%rdi
+    24db:	eb 24                	jmp    2501 <main+0x181>
+    24dd:	4c 8d 74 24 08       	lea    0x8(%rsp),%r14
+    24e2:	4c 89 e7             	mov    %r12,%rdi
+    24e5:	31 d2                	xor    %edx,%edx
+    24e7:	4c 89 f6             	mov    %r14,%rsi
+    24ea:	e8 61 fc ff ff       	call   2150 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@plt>
+    24ef:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    24f4:	48 89 c7             	mov    %rax,%rdi
+    24f7:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    24fc:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    2501:	48 89 da             	mov    %rbx,%rdx
+    2504:	4c 89 ee             	mov    %r13,%rsi
+    2507:	e8 94 fb ff ff       	call   20a0 <memcpy@plt>
+    250c:	e9 f4 fe ff ff       	jmp    2405 <main+0x85>
+    2511:	48 8d 3d 70 0b 00 00 	lea    0xb70(%rip),%rdi        # 3088 <_IO_stdin_used+0x88>
+    2518:	e8 63 fb ff ff       	call   2080 <_ZSt19__throw_logic_errorPKc@plt>
+    251d:	48 8d 3d 1b 0b 00 00 	lea    0xb1b(%rip),%rdi        # 303f <_IO_stdin_used+0x3f>
+    2524:	e8 e7 fb ff ff       	call   2110 <_ZSt20__throw_out_of_rangePKc@plt>
+    2529:	48 8d 3d 0f 0b 00 00 	lea    0xb0f(%rip),%rdi        # 303f <_IO_stdin_used+0x3f>
+    2530:	e8 3b fb ff ff       	call   2070 <_ZSt24__throw_invalid_argumentPKc@plt>
+    2535:	49 89 c4             	mov    %rax,%r12
+    2538:	e9 11 fe ff ff       	jmp    234e <main.cold>
+    253d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002540 <_GLOBAL__sub_I_linear_scan.cpp>:
+    2540:	53                   	push   %rbx
+    2541:	48 8d 1d 81 2b 00 00 	lea    0x2b81(%rip),%rbx        # 50c9 <_ZStL8__ioinit>
+    2548:	48 89 df             	mov    %rbx,%rdi
+    254b:	e8 d0 fb ff ff       	call   2120 <_ZNSt8ios_base4InitC1Ev@plt>
+    2550:	48 8b 3d 71 2a 00 00 	mov    0x2a71(%rip),%rdi        # 4fc8 <_ZNSt8ios_base4InitD1Ev@GLIBCXX_3.4>
+    2557:	48 89 de             	mov    %rbx,%rsi
+    255a:	5b                   	pop    %rbx
+    255b:	48 8d 15 46 2b 00 00 	lea    0x2b46(%rip),%rdx        # 50a8 <__dso_handle>
+    2562:	e9 49 fb ff ff       	jmp    20b0 <__cxa_atexit@plt>
+    2567:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    256e:	00 00 
+
+0000000000002570 <_start>:
+    2570:	31 ed                	xor    %ebp,%ebp
+    2572:	49 89 d1             	mov    %rdx,%r9
+    2575:	5e                   	pop    %rsi
+    2576:	48 89 e2             	mov    %rsp,%rdx
+    2579:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    257d:	50                   	push   %rax
+    257e:	54                   	push   %rsp
+    257f:	45 31 c0             	xor    %r8d,%r8d
+    2582:	31 c9                	xor    %ecx,%ecx
+    2584:	48 8d 3d f5 fd ff ff 	lea    -0x20b(%rip),%rdi        # 2380 <main>
+    258b:	ff 15 0f 2a 00 00    	call   *0x2a0f(%rip)        # 4fa0 <__libc_start_main@GLIBC_2.34>
+    2591:	f4                   	hlt
+    2592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2599:	00 00 00 
+    259c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000025a0 <deregister_tm_clones>:
+    25a0:	48 8d 3d 21 2b 00 00 	lea    0x2b21(%rip),%rdi        # 50c8 <__TMC_END__>
+    25a7:	48 8d 05 1a 2b 00 00 	lea    0x2b1a(%rip),%rax        # 50c8 <__TMC_END__>
+    25ae:	48 39 f8             	cmp    %rdi,%rax
+    25b1:	74 15                	je     25c8 <deregister_tm_clones+0x28>
+    25b3:	48 8b 05 f6 29 00 00 	mov    0x29f6(%rip),%rax        # 4fb0 <_ITM_deregisterTMCloneTable@Base>
+    25ba:	48 85 c0             	test   %rax,%rax
+    25bd:	74 09                	je     25c8 <deregister_tm_clones+0x28>
+    25bf:	ff e0                	jmp    *%rax
+    25c1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    25c8:	c3                   	ret
+    25c9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000025d0 <register_tm_clones>:
+    25d0:	48 8d 3d f1 2a 00 00 	lea    0x2af1(%rip),%rdi        # 50c8 <__TMC_END__>
+    25d7:	48 8d 35 ea 2a 00 00 	lea    0x2aea(%rip),%rsi        # 50c8 <__TMC_END__>
+    25de:	48 29 fe             	sub    %rdi,%rsi
+    25e1:	48 89 f0             	mov    %rsi,%rax
+    25e4:	48 c1 ee 3f          	shr    $0x3f,%rsi
+    25e8:	48 c1 f8 03          	sar    $0x3,%rax
+    25ec:	48 01 c6             	add    %rax,%rsi
+    25ef:	48 d1 fe             	sar    %rsi
+    25f2:	74 14                	je     2608 <register_tm_clones+0x38>
+    25f4:	48 8b 05 c5 29 00 00 	mov    0x29c5(%rip),%rax        # 4fc0 <_ITM_registerTMCloneTable@Base>
+    25fb:	48 85 c0             	test   %rax,%rax
+    25fe:	74 08                	je     2608 <register_tm_clones+0x38>
+    2600:	ff e0                	jmp    *%rax
+    2602:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2608:	c3                   	ret
+    2609:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002610 <__do_global_dtors_aux>:
+    2610:	f3 0f 1e fa          	endbr64
+    2614:	80 3d ad 2a 00 00 00 	cmpb   $0x0,0x2aad(%rip)        # 50c8 <__TMC_END__>
+    261b:	75 2b                	jne    2648 <__do_global_dtors_aux+0x38>
+    261d:	55                   	push   %rbp
+    261e:	48 83 3d 72 29 00 00 	cmpq   $0x0,0x2972(%rip)        # 4f98 <__cxa_finalize@GLIBC_2.2.5>
+    2625:	00 
+    2626:	48 89 e5             	mov    %rsp,%rbp
+    2629:	74 0c                	je     2637 <__do_global_dtors_aux+0x27>
+    262b:	48 8b 3d 76 2a 00 00 	mov    0x2a76(%rip),%rdi        # 50a8 <__dso_handle>
+    2632:	e8 39 fb ff ff       	call   2170 <__cxa_finalize@plt>
+    2637:	e8 64 ff ff ff       	call   25a0 <deregister_tm_clones>
+    263c:	c6 05 85 2a 00 00 01 	movb   $0x1,0x2a85(%rip)        # 50c8 <__TMC_END__>
+    2643:	5d                   	pop    %rbp
+    2644:	c3                   	ret
+    2645:	0f 1f 00             	nopl   (%rax)
+    2648:	c3                   	ret
+    2649:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002650 <frame_dummy>:
+    2650:	f3 0f 1e fa          	endbr64
+    2654:	e9 77 ff ff ff       	jmp    25d0 <register_tm_clones>
+    2659:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002660 <_Z5test1i>:
+    2660:	83 ff 01             	cmp    $0x1,%edi
+    2663:	74 26                	je     268b <_Z5test1i+0x2b>
+    2665:	83 ff 02             	cmp    $0x2,%edi
+    2668:	74 2d                	je     2697 <_Z5test1i+0x37>
+    266a:	83 ff 03             	cmp    $0x3,%edi
+    266d:	74 3a                	je     26a9 <_Z5test1i+0x49>
+    266f:	83 ff 05             	cmp    $0x5,%edi
+    2672:	74 3e                	je     26b2 <_Z5test1i+0x52>
+    2674:	83 ff 08             	cmp    $0x8,%edi
+    2677:	74 42                	je     26bb <_Z5test1i+0x5b>
+    2679:	83 ff 0d             	cmp    $0xd,%edi
+    267c:	74 46                	je     26c4 <_Z5test1i+0x64>
+    267e:	83 ff 15             	cmp    $0x15,%edi
+    2681:	74 4a                	je     26cd <_Z5test1i+0x6d>
+    2683:	31 c0                	xor    %eax,%eax
+    2685:	83 ff 22             	cmp    $0x22,%edi
+    2688:	74 16                	je     26a0 <_Z5test1i+0x40>
+    268a:	c3                   	ret
+    268b:	48 8d 05 4e 25 00 00 	lea    0x254e(%rip),%rax        # 4be0 <_ZL4data>
+    2692:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2696:	c3                   	ret
+    2697:	48 8d 05 52 25 00 00 	lea    0x2552(%rip),%rax        # 4bf0 <_ZL4data+0x10>
+    269e:	eb f2                	jmp    2692 <_Z5test1i+0x32>
+    26a0:	48 8d 05 a9 25 00 00 	lea    0x25a9(%rip),%rax        # 4c50 <_ZL4data+0x70>
+    26a7:	eb e9                	jmp    2692 <_Z5test1i+0x32>
+    26a9:	48 8d 05 50 25 00 00 	lea    0x2550(%rip),%rax        # 4c00 <_ZL4data+0x20>
+    26b0:	eb e0                	jmp    2692 <_Z5test1i+0x32>
+    26b2:	48 8d 05 57 25 00 00 	lea    0x2557(%rip),%rax        # 4c10 <_ZL4data+0x30>
+    26b9:	eb d7                	jmp    2692 <_Z5test1i+0x32>
+    26bb:	48 8d 05 5e 25 00 00 	lea    0x255e(%rip),%rax        # 4c20 <_ZL4data+0x40>
+    26c2:	eb ce                	jmp    2692 <_Z5test1i+0x32>
+    26c4:	48 8d 05 65 25 00 00 	lea    0x2565(%rip),%rax        # 4c30 <_ZL4data+0x50>
+    26cb:	eb c5                	jmp    2692 <_Z5test1i+0x32>
+    26cd:	48 8d 05 6c 25 00 00 	lea    0x256c(%rip),%rax        # 4c40 <_ZL4data+0x60>
+    26d4:	eb bc                	jmp    2692 <_Z5test1i+0x32>
+    26d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    26dd:	00 00 00 
+
+00000000000026e0 <_ZN5boost12static_views12out_of_boundD1Ev>:
+    26e0:	48 8d 05 e1 25 00 00 	lea    0x25e1(%rip),%rax        # 4cc8 <_ZTVN5boost12static_views12out_of_boundE>
+    26e7:	48 83 c7 08          	add    $0x8,%rdi
+    26eb:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    26ef:	48 83 c0 18          	add    $0x18,%rax
+    26f3:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    26f8:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    26fd:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2701:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2705:	e9 d6 f9 ff ff       	jmp    20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    270a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002710 <_ZTv0_n24_N5boost12static_views12out_of_boundD1Ev>:
+    2710:	48 8b 07             	mov    (%rdi),%rax
+    2713:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    2717:	48 8d 05 aa 25 00 00 	lea    0x25aa(%rip),%rax        # 4cc8 <_ZTVN5boost12static_views12out_of_boundE>
+    271e:	48 83 c7 08          	add    $0x8,%rdi
+    2722:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2726:	48 83 c0 18          	add    $0x18,%rax
+    272a:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    272f:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2734:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2738:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    273c:	e9 9f f9 ff ff       	jmp    20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    2741:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2748:	00 00 00 
+    274b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002750 <_ZN5boost12static_views11full_bucketD1Ev>:
+    2750:	48 8d 05 e1 25 00 00 	lea    0x25e1(%rip),%rax        # 4d38 <_ZTVN5boost12static_views11full_bucketE>
+    2757:	48 83 c7 08          	add    $0x8,%rdi
+    275b:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    275f:	48 83 c0 18          	add    $0x18,%rax
+    2763:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2768:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    276d:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2771:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2775:	e9 66 f9 ff ff       	jmp    20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    277a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002780 <_ZTv0_n24_N5boost12static_views11full_bucketD1Ev>:
+    2780:	48 8b 07             	mov    (%rdi),%rax
+    2783:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    2787:	48 8d 05 aa 25 00 00 	lea    0x25aa(%rip),%rax        # 4d38 <_ZTVN5boost12static_views11full_bucketE>
+    278e:	48 83 c7 08          	add    $0x8,%rdi
+    2792:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2796:	48 83 c0 18          	add    $0x18,%rax
+    279a:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    279f:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    27a4:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    27a8:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    27ac:	e9 2f f9 ff ff       	jmp    20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    27b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    27b8:	00 00 00 
+    27bb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000027c0 <_ZN5boost12static_views12out_of_boundD0Ev>:
+    27c0:	48 8d 05 01 25 00 00 	lea    0x2501(%rip),%rax        # 4cc8 <_ZTVN5boost12static_views12out_of_boundE>
+    27c7:	53                   	push   %rbx
+    27c8:	48 89 fb             	mov    %rdi,%rbx
+    27cb:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    27cf:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    27d3:	48 83 c0 18          	add    $0x18,%rax
+    27d7:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    27dc:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    27e1:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    27e5:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    27e9:	e8 f2 f8 ff ff       	call   20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    27ee:	48 89 df             	mov    %rbx,%rdi
+    27f1:	be 18 00 00 00       	mov    $0x18,%esi
+    27f6:	5b                   	pop    %rbx
+    27f7:	e9 d4 f8 ff ff       	jmp    20d0 <_ZdlPvm@plt>
+    27fc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002800 <_ZTv0_n24_N5boost12static_views12out_of_boundD0Ev>:
+    2800:	53                   	push   %rbx
+    2801:	48 8b 07             	mov    (%rdi),%rax
+    2804:	48 89 fb             	mov    %rdi,%rbx
+    2807:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    280b:	48 8d 05 b6 24 00 00 	lea    0x24b6(%rip),%rax        # 4cc8 <_ZTVN5boost12static_views12out_of_boundE>
+    2812:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    2816:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    281a:	48 83 c0 18          	add    $0x18,%rax
+    281e:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2823:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2828:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    282c:	0f 11 03             	movups %xmm0,(%rbx)
+    282f:	e8 ac f8 ff ff       	call   20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    2834:	48 89 df             	mov    %rbx,%rdi
+    2837:	be 18 00 00 00       	mov    $0x18,%esi
+    283c:	5b                   	pop    %rbx
+    283d:	e9 8e f8 ff ff       	jmp    20d0 <_ZdlPvm@plt>
+    2842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2849:	00 00 00 
+    284c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002850 <_ZN5boost12static_views11full_bucketD0Ev>:
+    2850:	48 8d 05 e1 24 00 00 	lea    0x24e1(%rip),%rax        # 4d38 <_ZTVN5boost12static_views11full_bucketE>
+    2857:	53                   	push   %rbx
+    2858:	48 89 fb             	mov    %rdi,%rbx
+    285b:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    285f:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2863:	48 83 c0 18          	add    $0x18,%rax
+    2867:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    286c:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2871:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2875:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2879:	e8 62 f8 ff ff       	call   20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    287e:	48 89 df             	mov    %rbx,%rdi
+    2881:	be 18 00 00 00       	mov    $0x18,%esi
+    2886:	5b                   	pop    %rbx
+    2887:	e9 44 f8 ff ff       	jmp    20d0 <_ZdlPvm@plt>
+    288c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002890 <_ZTv0_n24_N5boost12static_views11full_bucketD0Ev>:
+    2890:	53                   	push   %rbx
+    2891:	48 8b 07             	mov    (%rdi),%rax
+    2894:	48 89 fb             	mov    %rdi,%rbx
+    2897:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    289b:	48 8d 05 96 24 00 00 	lea    0x2496(%rip),%rax        # 4d38 <_ZTVN5boost12static_views11full_bucketE>
+    28a2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    28a6:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    28aa:	48 83 c0 18          	add    $0x18,%rax
+    28ae:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    28b3:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    28b8:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    28bc:	0f 11 03             	movups %xmm0,(%rbx)
+    28bf:	e8 1c f8 ff ff       	call   20e0 <_ZNSt13runtime_errorD2Ev@plt>
+    28c4:	48 89 df             	mov    %rbx,%rdi
+    28c7:	be 18 00 00 00       	mov    $0x18,%esi
+    28cc:	5b                   	pop    %rbx
+    28cd:	e9 fe f7 ff ff       	jmp    20d0 <_ZdlPvm@plt>
+
+Disassembly of section .fini:
+
+00000000000028d4 <_fini>:
+    28d4:	48 83 ec 08          	sub    $0x8,%rsp
+    28d8:	48 83 c4 08          	add    $0x8,%rsp
+    28dc:	c3                   	ret
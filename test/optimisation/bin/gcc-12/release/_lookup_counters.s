@@ -0,0 +1,1399 @@
+
+bin/gcc-12/release/_lookup_counters:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000002000 <_init>:
+    2000:	48 83 ec 08          	sub    $0x8,%rsp
+    2004:	48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 5fd0 <__gmon_start__@Base>
+    200b:	48 85 c0             	test   %rax,%rax
+    200e:	74 02                	je     2012 <_init+0x12>
+    2010:	ff d0                	call   *%rax
+    2012:	48 83 c4 08          	add    $0x8,%rsp
+    2016:	c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000002020 <__errno_location@plt-0x10>:
+    2020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    2026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    202c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002030 <__errno_location@plt>:
+    2030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 6000 <__errno_location@GLIBC_2.2.5>
+    2036:	68 00 00 00 00       	push   $0x0
+    203b:	e9 e0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002040 <_ZSt9terminatev@plt>:
+    2040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 6008 <_ZSt9terminatev@GLIBCXX_3.4>
+    2046:	68 01 00 00 00       	push   $0x1
+    204b:	e9 d0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>:
+    2050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 6010 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@GLIBCXX_3.4.21>
+    2056:	68 02 00 00 00       	push   $0x2
+    205b:	e9 c0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002060 <strlen@plt>:
+    2060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 6018 <strlen@GLIBC_2.2.5>
+    2066:	68 03 00 00 00       	push   $0x3
+    206b:	e9 b0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002070 <__cxa_allocate_exception@plt>:
+    2070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 6020 <__cxa_allocate_exception@CXXABI_1.3>
+    2076:	68 04 00 00 00       	push   $0x4
+    207b:	e9 a0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002080 <_ZSt20__throw_length_errorPKc@plt>:
+    2080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 6028 <_ZSt20__throw_length_errorPKc@GLIBCXX_3.4>
+    2086:	68 05 00 00 00       	push   $0x5
+    208b:	e9 90 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002090 <_ZSt24__throw_invalid_argumentPKc@plt>:
+    2090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 6030 <_ZSt24__throw_invalid_argumentPKc@GLIBCXX_3.4>
+    2096:	68 06 00 00 00       	push   $0x6
+    209b:	e9 80 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020a0 <_ZSt19__throw_logic_errorPKc@plt>:
+    20a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 6038 <_ZSt19__throw_logic_errorPKc@GLIBCXX_3.4>
+    20a6:	68 07 00 00 00       	push   $0x7
+    20ab:	e9 70 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020b0 <__cxa_free_exception@plt>:
+    20b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 6040 <__cxa_free_exception@CXXABI_1.3>
+    20b6:	68 08 00 00 00       	push   $0x8
+    20bb:	e9 60 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020c0 <memcpy@plt>:
+    20c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 6048 <memcpy@GLIBC_2.14>
+    20c6:	68 09 00 00 00       	push   $0x9
+    20cb:	e9 50 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020d0 <__cxa_atexit@plt>:
+    20d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 6050 <__cxa_atexit@GLIBC_2.2.5>
+    20d6:	68 0a 00 00 00       	push   $0xa
+    20db:	e9 40 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020e0 <_ZdlPvm@plt>:
+    20e0:	ff 25 72 3f 00 00    	jmp    *0x3f72(%rip)        # 6058 <_ZdlPvm@CXXABI_1.3.9>
+    20e6:	68 0b 00 00 00       	push   $0xb
+    20eb:	e9 30 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020f0 <_ZNSt13runtime_errorD2Ev@plt>:
+    20f0:	ff 25 6a 3f 00 00    	jmp    *0x3f6a(%rip)        # 6060 <_ZNSt13runtime_errorD2Ev@GLIBCXX_3.4>
+    20f6:	68 0c 00 00 00       	push   $0xc
+    20fb:	e9 20 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002100 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@plt>:
+    2100:	ff 25 62 3f 00 00    	jmp    *0x3f62(%rip)        # 6068 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@GLIBCXX_3.4.9>
+    2106:	68 0d 00 00 00       	push   $0xd
+    210b:	e9 10 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002110 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>:
+    2110:	ff 25 5a 3f 00 00    	jmp    *0x3f5a(%rip)        # 6070 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@GLIBCXX_3.4.21>
+    2116:	68 0e 00 00 00       	push   $0xe
+    211b:	e9 00 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002120 <_ZNSt13runtime_errorC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE@plt>:
+    2120:	ff 25 52 3f 00 00    	jmp    *0x3f52(%rip)        # 6078 <_ZNSt13runtime_errorC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE@GLIBCXX_3.4.21>
+    2126:	68 0f 00 00 00       	push   $0xf
+    212b:	e9 f0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002130 <strtol@plt>:
+    2130:	ff 25 4a 3f 00 00    	jmp    *0x3f4a(%rip)        # 6080 <strtol@GLIBC_2.2.5>
+    2136:	68 10 00 00 00       	push   $0x10
+    213b:	e9 e0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002140 <_ZSt20__throw_out_of_rangePKc@plt>:
+    2140:	ff 25 42 3f 00 00    	jmp    *0x3f42(%rip)        # 6088 <_ZSt20__throw_out_of_rangePKc@GLIBCXX_3.4>
+    2146:	68 11 00 00 00       	push   $0x11
+    214b:	e9 d0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002150 <_ZNSt8ios_base4InitC1Ev@plt>:
+    2150:	ff 25 3a 3f 00 00    	jmp    *0x3f3a(%rip)        # 6090 <_ZNSt8ios_base4InitC1Ev@GLIBCXX_3.4>
+    2156:	68 12 00 00 00       	push   $0x12
+    215b:	e9 c0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002160 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm@plt>:
+    2160:	ff 25 32 3f 00 00    	jmp    *0x3f32(%rip)        # 6098 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm@GLIBCXX_3.4.21>
+    2166:	68 13 00 00 00       	push   $0x13
+    216b:	e9 b0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002170 <__cxa_throw@plt>:
+    2170:	ff 25 2a 3f 00 00    	jmp    *0x3f2a(%rip)        # 60a0 <__cxa_throw@CXXABI_1.3>
+    2176:	68 14 00 00 00       	push   $0x14
+    217b:	e9 a0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002180 <_Unwind_Resume@plt>:
+    2180:	ff 25 22 3f 00 00    	jmp    *0x3f22(%rip)        # 60a8 <_Unwind_Resume@GCC_3.0>
+    2186:	68 15 00 00 00       	push   $0x15
+    218b:	e9 90 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002190 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@plt>:
+    2190:	ff 25 1a 3f 00 00    	jmp    *0x3f1a(%rip)        # 60b0 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@GLIBCXX_3.4.21>
+    2196:	68 16 00 00 00       	push   $0x16
+    219b:	e9 80 fe ff ff       	jmp    2020 <_init+0x20>
+
+00000000000021a0 <_ZNSt13runtime_errorC2EPKc@plt>:
+    21a0:	ff 25 12 3f 00 00    	jmp    *0x3f12(%rip)        # 60b8 <_ZNSt13runtime_errorC2EPKc@GLIBCXX_3.4.21>
+    21a6:	68 17 00 00 00       	push   $0x17
+    21ab:	e9 70 fe ff ff       	jmp    2020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000021b0 <__cxa_finalize@plt>:
+    21b0:	ff 25 fa 3d 00 00    	jmp    *0x3dfa(%rip)        # 5fb0 <__cxa_finalize@GLIBC_2.2.5>
+    21b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000021c0 <_ZN5boost12static_views6detail17make_out_of_boundEPKc>:
+    21c0:	55                   	push   %rbp
+    21c1:	48 89 fd             	mov    %rdi,%rbp
+    21c4:	bf 18 00 00 00       	mov    $0x18,%edi
+    21c9:	53                   	push   %rbx
+    21ca:	48 83 ec 18          	sub    $0x18,%rsp
+    21ce:	48 8d 05 0b 3b 00 00 	lea    0x3b0b(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    21d5:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    21d9:	48 83 c0 18          	add    $0x18,%rax
+    21dd:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    21e2:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    21e7:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    21eb:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    21ef:	e8 7c fe ff ff       	call   2070 <__cxa_allocate_exception@plt>
+    21f4:	48 89 ee             	mov    %rbp,%rsi
+    21f7:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    21fb:	48 89 c3             	mov    %rax,%rbx
+    21fe:	e8 9d ff ff ff       	call   21a0 <_ZNSt13runtime_errorC2EPKc@plt>
+    2203:	0f 28 14 24          	movaps (%rsp),%xmm2
+    2207:	48 8d 15 92 04 00 00 	lea    0x492(%rip),%rdx        # 26a0 <_ZN5boost12static_views12out_of_boundD1Ev>
+    220e:	48 89 df             	mov    %rbx,%rdi
+    2211:	48 8d 35 f8 39 00 00 	lea    0x39f8(%rip),%rsi        # 5c10 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2218:	0f 11 13             	movups %xmm2,(%rbx)
+    221b:	e8 50 ff ff ff       	call   2170 <__cxa_throw@plt>
+    2220:	48 89 c5             	mov    %rax,%rbp
+    2223:	48 89 df             	mov    %rbx,%rdi
+    2226:	e8 85 fe ff ff       	call   20b0 <__cxa_free_exception@plt>
+    222b:	48 89 ef             	mov    %rbp,%rdi
+    222e:	e8 4d ff ff ff       	call   2180 <_Unwind_Resume@plt>
+
+0000000000002233 <_ZN5boost12static_views6detail16make_full_bucketEPKc>:
+    2233:	55                   	push   %rbp
+    2234:	48 89 fd             	mov    %rdi,%rbp
+    2237:	bf 18 00 00 00       	mov    $0x18,%edi
+    223c:	53                   	push   %rbx
+    223d:	48 83 ec 18          	sub    $0x18,%rsp
+    2241:	48 8d 05 08 3b 00 00 	lea    0x3b08(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2248:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    224c:	48 83 c0 18          	add    $0x18,%rax
+    2250:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2255:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    225a:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    225e:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2262:	e8 09 fe ff ff       	call   2070 <__cxa_allocate_exception@plt>
+    2267:	48 89 ee             	mov    %rbp,%rsi
+    226a:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    226e:	48 89 c3             	mov    %rax,%rbx
+    2271:	e8 2a ff ff ff       	call   21a0 <_ZNSt13runtime_errorC2EPKc@plt>
+    2276:	0f 28 14 24          	movaps (%rsp),%xmm2
+    227a:	48 8d 15 8f 04 00 00 	lea    0x48f(%rip),%rdx        # 2710 <_ZN5boost12static_views11full_bucketD1Ev>
+    2281:	48 89 df             	mov    %rbx,%rdi
+    2284:	48 8d 35 ad 39 00 00 	lea    0x39ad(%rip),%rsi        # 5c38 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    228b:	0f 11 13             	movups %xmm2,(%rbx)
+    228e:	e8 dd fe ff ff       	call   2170 <__cxa_throw@plt>
+    2293:	48 89 c5             	mov    %rax,%rbp
+    2296:	48 89 df             	mov    %rbx,%rdi
+    2299:	e8 12 fe ff ff       	call   20b0 <__cxa_free_exception@plt>
+    229e:	48 89 ef             	mov    %rbp,%rdi
+    22a1:	e8 da fe ff ff       	call   2180 <_Unwind_Resume@plt>
+
+00000000000022a6 <_ZN5boost12static_views6detail17make_out_of_boundEv>:
+    22a6:	55                   	push   %rbp
+    22a7:	bf 18 00 00 00       	mov    $0x18,%edi
+    22ac:	53                   	push   %rbx
+    22ad:	48 83 ec 18          	sub    $0x18,%rsp
+    22b1:	48 8d 05 28 3a 00 00 	lea    0x3a28(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    22b8:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    22bc:	48 83 c0 18          	add    $0x18,%rax
+    22c0:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    22c5:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    22ca:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    22ce:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    22d2:	e8 99 fd ff ff       	call   2070 <__cxa_allocate_exception@plt>
+    22d7:	48 8d 35 63 1d 00 00 	lea    0x1d63(%rip),%rsi        # 4041 <_IO_stdin_used+0x41>
+    22de:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    22e2:	48 89 c3             	mov    %rax,%rbx
+    22e5:	e8 b6 fe ff ff       	call   21a0 <_ZNSt13runtime_errorC2EPKc@plt>
+    22ea:	0f 28 14 24          	movaps (%rsp),%xmm2
+    22ee:	48 8d 15 ab 03 00 00 	lea    0x3ab(%rip),%rdx        # 26a0 <_ZN5boost12static_views12out_of_boundD1Ev>
+    22f5:	48 89 df             	mov    %rbx,%rdi
+    22f8:	48 8d 35 11 39 00 00 	lea    0x3911(%rip),%rsi        # 5c10 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    22ff:	0f 11 13             	movups %xmm2,(%rbx)
+    2302:	e8 69 fe ff ff       	call   2170 <__cxa_throw@plt>
+    2307:	48 89 c5             	mov    %rax,%rbp
+    230a:	48 89 df             	mov    %rbx,%rdi
+    230d:	e8 9e fd ff ff       	call   20b0 <__cxa_free_exception@plt>
+    2312:	48 89 ef             	mov    %rbp,%rdi
+    2315:	e8 66 fe ff ff       	call   2180 <_Unwind_Resume@plt>
+
+000000000000231a <_ZN5boost12static_views6detail16make_full_bucketEv>:
+    231a:	55                   	push   %rbp
+    231b:	bf 18 00 00 00       	mov    $0x18,%edi
+    2320:	53                   	push   %rbx
+    2321:	48 83 ec 18          	sub    $0x18,%rsp
+    2325:	48 8d 05 24 3a 00 00 	lea    0x3a24(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    232c:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2330:	48 83 c0 18          	add    $0x18,%rax
+    2334:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2339:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    233e:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2342:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2346:	e8 25 fd ff ff       	call   2070 <__cxa_allocate_exception@plt>
+    234b:	48 8d 35 04 1d 00 00 	lea    0x1d04(%rip),%rsi        # 4056 <_IO_stdin_used+0x56>
+    2352:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    2356:	48 89 c3             	mov    %rax,%rbx
+    2359:	e8 42 fe ff ff       	call   21a0 <_ZNSt13runtime_errorC2EPKc@plt>
+    235e:	0f 28 14 24          	movaps (%rsp),%xmm2
+    2362:	48 8d 15 a7 03 00 00 	lea    0x3a7(%rip),%rdx        # 2710 <_ZN5boost12static_views11full_bucketD1Ev>
+    2369:	48 89 df             	mov    %rbx,%rdi
+    236c:	48 8d 35 c5 38 00 00 	lea    0x38c5(%rip),%rsi        # 5c38 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    2373:	0f 11 13             	movups %xmm2,(%rbx)
+    2376:	e8 f5 fd ff ff       	call   2170 <__cxa_throw@plt>
+    237b:	48 89 c5             	mov    %rax,%rbp
+    237e:	48 89 df             	mov    %rbx,%rdi
+    2381:	e8 2a fd ff ff       	call   20b0 <__cxa_free_exception@plt>
+    2386:	48 89 ef             	mov    %rbp,%rdi
+    2389:	e8 f2 fd ff ff       	call   2180 <_Unwind_Resume@plt>
+
+000000000000238e <main.cold>:
+    238e:	83 3b 00             	cmpl   $0x0,(%rbx)
+    2391:	75 03                	jne    2396 <main.cold+0x8>
+    2393:	44 89 23             	mov    %r12d,(%rbx)
+    2396:	48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    239b:	48 8d 44 24 20       	lea    0x20(%rsp),%rax
+    23a0:	48 39 c7             	cmp    %rax,%rdi
+    23a3:	74 0e                	je     23b3 <main.cold+0x25>
+    23a5:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    23aa:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    23ae:	e8 2d fd ff ff       	call   20e0 <_ZdlPvm@plt>
+    23b3:	48 89 ef             	mov    %rbp,%rdi
+    23b6:	e8 c5 fd ff ff       	call   2180 <_Unwind_Resume@plt>
+    23bb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000023c0 <main>:
+    23c0:	41 54                	push   %r12
+    23c2:	55                   	push   %rbp
+    23c3:	53                   	push   %rbx
+    23c4:	48 83 ec 30          	sub    $0x30,%rsp
+    23c8:	83 ff 02             	cmp    $0x2,%edi
+    23cb:	74 23                	je     23f0 <main+0x30>
+    23cd:	48 8b 3d ec 3b 00 00 	mov    0x3bec(%rip),%rdi        # 5fc0 <_ZSt4cout@GLIBCXX_3.4>
+    23d4:	ba 15 00 00 00       	mov    $0x15,%edx
+    23d9:	48 8d 35 86 1c 00 00 	lea    0x1c86(%rip),%rsi        # 4066 <_IO_stdin_used+0x66>
+    23e0:	e8 1b fd ff ff       	call   2100 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@plt>
+    23e5:	48 83 c4 30          	add    $0x30,%rsp
+    23e9:	31 c0                	xor    %eax,%eax
+    23eb:	5b                   	pop    %rbx
+    23ec:	5d                   	pop    %rbp
+    23ed:	41 5c                	pop    %r12
+    23ef:	c3                   	ret
+    23f0:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    23f4:	48 8d 54 24 07       	lea    0x7(%rsp),%rdx
+    23f9:	48 8d 7c 24 10       	lea    0x10(%rsp),%rdi
+    23fe:	e8 0d 10 00 00       	call   3410 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_>
+    2403:	48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+    2408:	e8 23 fc ff ff       	call   2030 <__errno_location@plt>
+    240d:	48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    2412:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2417:	44 8b 20             	mov    (%rax),%r12d
+    241a:	48 89 c3             	mov    %rax,%rbx
+    241d:	31 c0                	xor    %eax,%eax
+    241f:	48 89 ef             	mov    %rbp,%rdi
+    2422:	89 03                	mov    %eax,(%rbx)
+    2424:	e8 07 fd ff ff       	call   2130 <strtol@plt>
+    2429:	48 3b 6c 24 08       	cmp    0x8(%rsp),%rbp
+    242e:	74 4c                	je     247c <main+0xbc>
+    2430:	8b 13                	mov    (%rbx),%edx
+    2432:	83 fa 22             	cmp    $0x22,%edx
+    2435:	74 51                	je     2488 <main+0xc8>
+    2437:	85 d2                	test   %edx,%edx
+    2439:	75 03                	jne    243e <main+0x7e>
+    243b:	44 89 23             	mov    %r12d,(%rbx)
+    243e:	48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    2443:	89 c3                	mov    %eax,%ebx
+    2445:	48 8d 44 24 20       	lea    0x20(%rsp),%rax
+    244a:	48 39 c7             	cmp    %rax,%rdi
+    244d:	74 0e                	je     245d <main+0x9d>
+    244f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    2454:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2458:	e8 83 fc ff ff       	call   20e0 <_ZdlPvm@plt>
+    245d:	89 df                	mov    %ebx,%edi
+    245f:	e8 5c 01 00 00       	call   25c0 <_Z5test1i>
+    2464:	89 df                	mov    %ebx,%edi
+    2466:	48 89 c5             	mov    %rax,%rbp
+    2469:	e8 c2 01 00 00       	call   2630 <_Z5test2i>
+    246e:	48 39 c5             	cmp    %rax,%rbp
+    2471:	0f 84 6e ff ff ff    	je     23e5 <main+0x25>
+    2477:	e8 c4 fb ff ff       	call   2040 <_ZSt9terminatev@plt>
+    247c:	48 8d 3d f9 1b 00 00 	lea    0x1bf9(%rip),%rdi        # 407c <_IO_stdin_used+0x7c>
+    2483:	e8 08 fc ff ff       	call   2090 <_ZSt24__throw_invalid_argumentPKc@plt>
+    2488:	48 8d 3d ed 1b 00 00 	lea    0x1bed(%rip),%rdi        # 407c <_IO_stdin_used+0x7c>
+    248f:	e8 ac fc ff ff       	call   2140 <_ZSt20__throw_out_of_rangePKc@plt>
+    2494:	48 89 c5             	mov    %rax,%rbp
+    2497:	e9 f2 fe ff ff       	jmp    238e <main.cold>
+    249c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000024a0 <_GLOBAL__sub_I_lookup_counters.cpp>:
+    24a0:	53                   	push   %rbx
+    24a1:	48 8d 1d 41 3c 00 00 	lea    0x3c41(%rip),%rbx        # 60e9 <_ZStL8__ioinit>
+    24a8:	48 89 df             	mov    %rbx,%rdi
+    24ab:	e8 a0 fc ff ff       	call   2150 <_ZNSt8ios_base4InitC1Ev@plt>
+    24b0:	48 8b 3d 29 3b 00 00 	mov    0x3b29(%rip),%rdi        # 5fe0 <_ZNSt8ios_base4InitD1Ev@GLIBCXX_3.4>
+    24b7:	48 89 de             	mov    %rbx,%rsi
+    24ba:	5b                   	pop    %rbx
+    24bb:	48 8d 15 06 3c 00 00 	lea    0x3c06(%rip),%rdx        # 60c8 <__dso_handle>
+    24c2:	e9 09 fc ff ff       	jmp    20d0 <__cxa_atexit@plt>
+    24c7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    24ce:	00 00 
+
+00000000000024d0 <_start>:
+    24d0:	31 ed                	xor    %ebp,%ebp
+    24d2:	49 89 d1             	mov    %rdx,%r9
+    24d5:	5e                   	pop    %rsi
+    24d6:	48 89 e2             	mov    %rsp,%rdx
+    24d9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    24dd:	50                   	push   %rax
+    24de:	54                   	push   %rsp
+    24df:	45 31 c0             	xor    %r8d,%r8d
+    24e2:	31 c9                	xor    %ecx,%ecx
+    24e4:	48 8d 3d d5 fe ff ff 	lea    -0x12b(%rip),%rdi        # 23c0 <main>
+    24eb:	ff 15 c7 3a 00 00    	call   *0x3ac7(%rip)        # 5fb8 <__libc_start_main@GLIBC_2.34>
+    24f1:	f4                   	hlt
+    24f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    24f9:	00 00 00 
+    24fc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002500 <deregister_tm_clones>:
+    2500:	48 8d 3d e1 3b 00 00 	lea    0x3be1(%rip),%rdi        # 60e8 <__TMC_END__>
+    2507:	48 8d 05 da 3b 00 00 	lea    0x3bda(%rip),%rax        # 60e8 <__TMC_END__>
+    250e:	48 39 f8             	cmp    %rdi,%rax
+    2511:	74 15                	je     2528 <deregister_tm_clones+0x28>
+    2513:	48 8b 05 ae 3a 00 00 	mov    0x3aae(%rip),%rax        # 5fc8 <_ITM_deregisterTMCloneTable@Base>
+    251a:	48 85 c0             	test   %rax,%rax
+    251d:	74 09                	je     2528 <deregister_tm_clones+0x28>
+    251f:	ff e0                	jmp    *%rax
+    2521:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2528:	c3                   	ret
+    2529:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002530 <register_tm_clones>:
+    2530:	48 8d 3d b1 3b 00 00 	lea    0x3bb1(%rip),%rdi        # 60e8 <__TMC_END__>
+    2537:	48 8d 35 aa 3b 00 00 	lea    0x3baa(%rip),%rsi        # 60e8 <__TMC_END__>
+    253e:	48 29 fe             	sub    %rdi,%rsi
+    2541:	48 89 f0             	mov    %rsi,%rax
+    2544:	48 c1 ee 3f          	shr    $0x3f,%rsi
+    2548:	48 c1 f8 03          	sar    $0x3,%rax
+    254c:	48 01 c6             	add    %rax,%rsi
+    254f:	48 d1 fe             	sar    %rsi
+    2552:	74 14                	je     2568 <register_tm_clones+0x38>
+    2554:	48 8b 05 7d 3a 00 00 	mov    0x3a7d(%rip),%rax        # 5fd8 <_ITM_registerTMCloneTable@Base>
+    255b:	48 85 c0             	test   %rax,%rax
+    255e:	74 08                	je     2568 <register_tm_clones+0x38>
+    2560:	ff e0                	jmp    *%rax
+    2562:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2568:	c3                   	ret
+    2569:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002570 <__do_global_dtors_aux>:
+    2570:	f3 0f 1e fa          	endbr64
+    2574:	80 3d 6d 3b 00 00 00 	cmpb   $0x0,0x3b6d(%rip)        # 60e8 <__TMC_END__>
+    257b:	75 2b                	jne    25a8 <__do_global_dtors_aux+0x38>
+    257d:	55                   	push   %rbp
+    257e:	48 83 3d 2a 3a 00 00 	cmpq   $0x0,0x3a2a(%rip)        # 5fb0 <__cxa_finalize@GLIBC_2.2.5>
+    2585:	00 
+    2586:	48 89 e5             	mov    %rsp,%rbp
+    2589:	74 0c                	je     2597 <__do_global_dtors_aux+0x27>
+    258b:	48 8b 3d 36 3b 00 00 	mov    0x3b36(%rip),%rdi        # 60c8 <__dso_handle>
+    2592:	e8 19 fc ff ff       	call   21b0 <__cxa_finalize@plt>
+    2597:	e8 64 ff ff ff       	call   2500 <deregister_tm_clones>
+    259c:	c6 05 45 3b 00 00 01 	movb   $0x1,0x3b45(%rip)        # 60e8 <__TMC_END__>
+    25a3:	5d                   	pop    %rbp
+    25a4:	c3                   	ret
+    25a5:	0f 1f 00             	nopl   (%rax)
+    25a8:	c3                   	ret
+    25a9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000025b0 <frame_dummy>:
+    25b0:	f3 0f 1e fa          	endbr64
+    25b4:	e9 77 ff ff ff       	jmp    2530 <register_tm_clones>
+    25b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000025c0 <_Z5test1i>:
+    25c0:	89 fa                	mov    %edi,%edx
+    25c2:	48 8d 0d f7 34 00 00 	lea    0x34f7(%rip),%rcx        # 5ac0 <_ZL10plain_view>
+    25c9:	83 e2 0f             	and    $0xf,%edx
+    25cc:	01 d2                	add    %edx,%edx
+    25ce:	48 63 c2             	movslq %edx,%rax
+    25d1:	48 63 44 81 10       	movslq 0x10(%rcx,%rax,4),%rax
+    25d6:	83 f8 20             	cmp    $0x20,%eax
+    25d9:	74 3d                	je     2618 <_Z5test1i+0x58>
+    25db:	49 89 c0             	mov    %rax,%r8
+    25de:	48 8d 35 7b 35 00 00 	lea    0x357b(%rip),%rsi        # 5b60 <_ZL4data>
+    25e5:	49 c1 e0 04          	shl    $0x4,%r8
+    25e9:	42 3b 3c 06          	cmp    (%rsi,%r8,1),%edi
+    25ed:	74 31                	je     2620 <_Z5test1i+0x60>
+    25ef:	83 c2 01             	add    $0x1,%edx
+    25f2:	48 63 d2             	movslq %edx,%rdx
+    25f5:	48 63 44 91 10       	movslq 0x10(%rcx,%rdx,4),%rax
+    25fa:	83 f8 20             	cmp    $0x20,%eax
+    25fd:	74 19                	je     2618 <_Z5test1i+0x58>
+    25ff:	48 89 c1             	mov    %rax,%rcx
+    2602:	31 d2                	xor    %edx,%edx
+    2604:	48 c1 e1 04          	shl    $0x4,%rcx
+    2608:	39 3c 0e             	cmp    %edi,(%rsi,%rcx,1)
+    260b:	74 13                	je     2620 <_Z5test1i+0x60>
+    260d:	48 89 d0             	mov    %rdx,%rax
+    2610:	c3                   	ret
+    2611:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2618:	31 d2                	xor    %edx,%edx
+    261a:	eb f1                	jmp    260d <_Z5test1i+0x4d>
+    261c:	0f 1f 40 00          	nopl   0x0(%rax)
+    2620:	48 c1 e0 04          	shl    $0x4,%rax
+    2624:	48 8b 54 06 08       	mov    0x8(%rsi,%rax,1),%rdx
+    2629:	eb e2                	jmp    260d <_Z5test1i+0x4d>
+    262b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002630 <_Z5test2i>:
+    2630:	89 fa                	mov    %edi,%edx
+    2632:	48 8d 0d e7 33 00 00 	lea    0x33e7(%rip),%rcx        # 5a20 <_ZL16instrumented_map>
+    2639:	83 e2 0f             	and    $0xf,%edx
+    263c:	01 d2                	add    %edx,%edx
+    263e:	48 63 c2             	movslq %edx,%rax
+    2641:	48 63 44 81 10       	movslq 0x10(%rcx,%rax,4),%rax
+    2646:	83 f8 20             	cmp    $0x20,%eax
+    2649:	74 3d                	je     2688 <_Z5test2i+0x58>
+    264b:	49 89 c0             	mov    %rax,%r8
+    264e:	48 8d 35 0b 35 00 00 	lea    0x350b(%rip),%rsi        # 5b60 <_ZL4data>
+    2655:	49 c1 e0 04          	shl    $0x4,%r8
+    2659:	42 3b 3c 06          	cmp    (%rsi,%r8,1),%edi
+    265d:	74 31                	je     2690 <_Z5test2i+0x60>
+    265f:	83 c2 01             	add    $0x1,%edx
+    2662:	48 63 d2             	movslq %edx,%rdx
+    2665:	48 63 44 91 10       	movslq 0x10(%rcx,%rdx,4),%rax
+    266a:	83 f8 20             	cmp    $0x20,%eax
+    266d:	74 19                	je     2688 <_Z5test2i+0x58>
+    266f:	48 89 c1             	mov    %rax,%rcx
+    2672:	31 d2                	xor    %edx,%edx
+    2674:	48 c1 e1 04          	shl    $0x4,%rcx
+    2678:	39 3c 0e             	cmp    %edi,(%rsi,%rcx,1)
+    267b:	74 13                	je     2690 <_Z5test2i+0x60>
+    267d:	48 89 d0             	mov    %rdx,%rax
+    2680:	c3                   	ret
+    2681:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2688:	31 d2                	xor    %edx,%edx
+    268a:	eb f1                	jmp    267d <_Z5test2i+0x4d>
+    268c:	0f 1f 40 00          	nopl   0x0(%rax)
+    2690:	48 c1 e0 04          	shl    $0x4,%rax
+    2694:	48 8b 54 06 08       	mov    0x8(%rsi,%rax,1),%rdx
+    2699:	eb e2                	jmp    267d <_Z5test2i+0x4d>
+    269b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000026a0 <_ZN5boost12static_views12out_of_boundD1Ev>:
+    26a0:	48 8d 05 39 36 00 00 	lea    0x3639(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    26a7:	48 83 c7 08          	add    $0x8,%rdi
+    26ab:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    26af:	48 83 c0 18          	add    $0x18,%rax
+    26b3:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    26b8:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    26bd:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    26c1:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    26c5:	e9 26 fa ff ff       	jmp    20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    26ca:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000026d0 <_ZTv0_n24_N5boost12static_views12out_of_boundD1Ev>:
+    26d0:	48 8b 07             	mov    (%rdi),%rax
+    26d3:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    26d7:	48 8d 05 02 36 00 00 	lea    0x3602(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    26de:	48 83 c7 08          	add    $0x8,%rdi
+    26e2:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    26e6:	48 83 c0 18          	add    $0x18,%rax
+    26ea:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    26ef:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    26f4:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    26f8:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    26fc:	e9 ef f9 ff ff       	jmp    20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    2701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2708:	00 00 00 
+    270b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002710 <_ZN5boost12static_views11full_bucketD1Ev>:
+    2710:	48 8d 05 39 36 00 00 	lea    0x3639(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2717:	48 83 c7 08          	add    $0x8,%rdi
+    271b:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    271f:	48 83 c0 18          	add    $0x18,%rax
+    2723:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2728:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    272d:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2731:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2735:	e9 b6 f9 ff ff       	jmp    20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    273a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002740 <_ZTv0_n24_N5boost12static_views11full_bucketD1Ev>:
+    2740:	48 8b 07             	mov    (%rdi),%rax
+    2743:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    2747:	48 8d 05 02 36 00 00 	lea    0x3602(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    274e:	48 83 c7 08          	add    $0x8,%rdi
+    2752:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2756:	48 83 c0 18          	add    $0x18,%rax
+    275a:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    275f:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2764:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2768:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    276c:	e9 7f f9 ff ff       	jmp    20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    2771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2778:	00 00 00 
+    277b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002780 <_ZN5boost12static_views17assertion_failureD1Ev>:
+    2780:	48 8d 05 e9 34 00 00 	lea    0x34e9(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2787:	48 83 c7 08          	add    $0x8,%rdi
+    278b:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    278f:	48 83 c0 18          	add    $0x18,%rax
+    2793:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2798:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    279d:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    27a1:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    27a5:	e9 46 f9 ff ff       	jmp    20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    27aa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000027b0 <_ZTv0_n24_N5boost12static_views17assertion_failureD1Ev>:
+    27b0:	48 8b 07             	mov    (%rdi),%rax
+    27b3:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    27b7:	48 8d 05 b2 34 00 00 	lea    0x34b2(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    27be:	48 83 c7 08          	add    $0x8,%rdi
+    27c2:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    27c6:	48 83 c0 18          	add    $0x18,%rax
+    27ca:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    27cf:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    27d4:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    27d8:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    27dc:	e9 0f f9 ff ff       	jmp    20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    27e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    27e8:	00 00 00 
+    27eb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000027f0 <_ZN5boost12static_views12out_of_boundD0Ev>:
+    27f0:	48 8d 05 e9 34 00 00 	lea    0x34e9(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    27f7:	53                   	push   %rbx
+    27f8:	48 89 fb             	mov    %rdi,%rbx
+    27fb:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    27ff:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2803:	48 83 c0 18          	add    $0x18,%rax
+    2807:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    280c:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2811:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2815:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2819:	e8 d2 f8 ff ff       	call   20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    281e:	48 89 df             	mov    %rbx,%rdi
+    2821:	be 18 00 00 00       	mov    $0x18,%esi
+    2826:	5b                   	pop    %rbx
+    2827:	e9 b4 f8 ff ff       	jmp    20e0 <_ZdlPvm@plt>
+    282c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002830 <_ZTv0_n24_N5boost12static_views12out_of_boundD0Ev>:
+    2830:	53                   	push   %rbx
+    2831:	48 8b 07             	mov    (%rdi),%rax
+    2834:	48 89 fb             	mov    %rdi,%rbx
+    2837:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    283b:	48 8d 05 9e 34 00 00 	lea    0x349e(%rip),%rax        # 5ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    2842:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    2846:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    284a:	48 83 c0 18          	add    $0x18,%rax
+    284e:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2853:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2858:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    285c:	0f 11 03             	movups %xmm0,(%rbx)
+    285f:	e8 8c f8 ff ff       	call   20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    2864:	48 89 df             	mov    %rbx,%rdi
+    2867:	be 18 00 00 00       	mov    $0x18,%esi
+    286c:	5b                   	pop    %rbx
+    286d:	e9 6e f8 ff ff       	jmp    20e0 <_ZdlPvm@plt>
+    2872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2879:	00 00 00 
+    287c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002880 <_ZN5boost12static_views11full_bucketD0Ev>:
+    2880:	48 8d 05 c9 34 00 00 	lea    0x34c9(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    2887:	53                   	push   %rbx
+    2888:	48 89 fb             	mov    %rdi,%rbx
+    288b:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    288f:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2893:	48 83 c0 18          	add    $0x18,%rax
+    2897:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    289c:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    28a1:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    28a5:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    28a9:	e8 42 f8 ff ff       	call   20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    28ae:	48 89 df             	mov    %rbx,%rdi
+    28b1:	be 18 00 00 00       	mov    $0x18,%esi
+    28b6:	5b                   	pop    %rbx
+    28b7:	e9 24 f8 ff ff       	jmp    20e0 <_ZdlPvm@plt>
+    28bc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000028c0 <_ZTv0_n24_N5boost12static_views11full_bucketD0Ev>:
+    28c0:	53                   	push   %rbx
+    28c1:	48 8b 07             	mov    (%rdi),%rax
+    28c4:	48 89 fb             	mov    %rdi,%rbx
+    28c7:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    28cb:	48 8d 05 7e 34 00 00 	lea    0x347e(%rip),%rax        # 5d50 <_ZTVN5boost12static_views11full_bucketE>
+    28d2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    28d6:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    28da:	48 83 c0 18          	add    $0x18,%rax
+    28de:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    28e3:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    28e8:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    28ec:	0f 11 03             	movups %xmm0,(%rbx)
+    28ef:	e8 fc f7 ff ff       	call   20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    28f4:	48 89 df             	mov    %rbx,%rdi
+    28f7:	be 18 00 00 00       	mov    $0x18,%esi
+    28fc:	5b                   	pop    %rbx
+    28fd:	e9 de f7 ff ff       	jmp    20e0 <_ZdlPvm@plt>
+    2902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2909:	00 00 00 
+    290c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002910 <_ZN5boost12static_views17assertion_failureD0Ev>:
+    2910:	48 8d 05 59 33 00 00 	lea    0x3359(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2917:	53                   	push   %rbx
+    2918:	48 89 fb             	mov    %rdi,%rbx
+    291b:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    291f:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2923:	48 83 c0 18          	add    $0x18,%rax
+    2927:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    292c:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2931:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2935:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    2939:	e8 b2 f7 ff ff       	call   20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    293e:	48 89 df             	mov    %rbx,%rdi
+    2941:	be 18 00 00 00       	mov    $0x18,%esi
+    2946:	5b                   	pop    %rbx
+    2947:	e9 94 f7 ff ff       	jmp    20e0 <_ZdlPvm@plt>
+    294c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002950 <_ZTv0_n24_N5boost12static_views17assertion_failureD0Ev>:
+    2950:	53                   	push   %rbx
+    2951:	48 8b 07             	mov    (%rdi),%rax
+    2954:	48 89 fb             	mov    %rdi,%rbx
+    2957:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    295b:	48 8d 05 0e 33 00 00 	lea    0x330e(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2962:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    2966:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    296a:	48 83 c0 18          	add    $0x18,%rax
+    296e:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    2973:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2978:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    297c:	0f 11 03             	movups %xmm0,(%rbx)
+    297f:	e8 6c f7 ff ff       	call   20f0 <_ZNSt13runtime_errorD2Ev@plt>
+    2984:	48 89 df             	mov    %rbx,%rdi
+    2987:	be 18 00 00 00       	mov    $0x18,%esi
+    298c:	5b                   	pop    %rbx
+    298d:	e9 4e f7 ff ff       	jmp    20e0 <_ZdlPvm@plt>
+    2992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2999:	00 00 00 
+    299c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000029a0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_>:
+    29a0:	41 57                	push   %r15
+    29a2:	41 89 d7             	mov    %edx,%r15d
+    29a5:	48 8d 47 08          	lea    0x8(%rdi),%rax
+    29a9:	41 56                	push   %r14
+    29ab:	41 c1 ef 1f          	shr    $0x1f,%r15d
+    29af:	49 89 ce             	mov    %rcx,%r14
+    29b2:	41 55                	push   %r13
+    29b4:	49 89 f5             	mov    %rsi,%r13
+    29b7:	41 54                	push   %r12
+    29b9:	41 89 d4             	mov    %edx,%r12d
+    29bc:	55                   	push   %rbp
+    29bd:	53                   	push   %rbx
+    29be:	48 81 ec 48 01 00 00 	sub    $0x148,%rsp
+    29c5:	41 f7 dc             	neg    %r12d
+    29c8:	44 0f 48 e2          	cmovs  %edx,%r12d
+    29cc:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+    29d1:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    29d6:	41 83 fc 09          	cmp    $0x9,%r12d
+    29da:	0f 86 3a 06 00 00    	jbe    301a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x67a>
+    29e0:	41 83 fc 63          	cmp    $0x63,%r12d
+    29e4:	0f 86 1e 08 00 00    	jbe    3208 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x868>
+    29ea:	41 81 fc e7 03 00 00 	cmp    $0x3e7,%r12d
+    29f1:	0f 86 63 08 00 00    	jbe    325a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8ba>
+    29f7:	44 89 e3             	mov    %r12d,%ebx
+    29fa:	41 81 fc 0f 27 00 00 	cmp    $0x270f,%r12d
+    2a01:	0f 86 44 08 00 00    	jbe    324b <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8ab>
+    2a07:	be 05 00 00 00       	mov    $0x5,%esi
+    2a0c:	48 81 fb 9f 86 01 00 	cmp    $0x1869f,%rbx
+    2a13:	0f 86 54 06 00 00    	jbe    306d <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6cd>
+    2a19:	48 81 fb 3f 42 0f 00 	cmp    $0xf423f,%rbx
+    2a20:	0f 86 46 08 00 00    	jbe    326c <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8cc>
+    2a26:	b9 06 00 00 00       	mov    $0x6,%ecx
+    2a2b:	be 07 00 00 00       	mov    $0x7,%esi
+    2a30:	48 81 fb 7f 96 98 00 	cmp    $0x98967f,%rbx
+    2a37:	0f 86 33 06 00 00    	jbe    3070 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    2a3d:	48 81 fb ff e0 f5 05 	cmp    $0x5f5e0ff,%rbx
+    2a44:	0f 86 7e 07 00 00    	jbe    31c8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x828>
+    2a4a:	48 81 fb ff c9 9a 3b 	cmp    $0x3b9ac9ff,%rbx
+    2a51:	0f 86 11 06 00 00    	jbe    3068 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6c8>
+    2a57:	b9 09 00 00 00       	mov    $0x9,%ecx
+    2a5c:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    2a63:	00 
+    2a64:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    2a6b:	00 
+    2a6c:	89 0c 24             	mov    %ecx,(%rsp)
+    2a6f:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    2a74:	42 8d 74 39 01       	lea    0x1(%rcx,%r15,1),%esi
+    2a79:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    2a80:	00 
+    2a81:	ba 2d 00 00 00       	mov    $0x2d,%edx
+    2a86:	e8 85 f6 ff ff       	call   2110 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>
+    2a8b:	41 0f b6 d7          	movzbl %r15b,%edx
+    2a8f:	8b 0c 24             	mov    (%rsp),%ecx
+    2a92:	48 8d 35 27 17 00 00 	lea    0x1727(%rip),%rsi        # 41c0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits>
+    2a99:	48 03 94 24 20 01 00 	add    0x120(%rsp),%rdx
+    2aa0:	00 
+    2aa1:	eb 07                	jmp    2aaa <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x10a>
+    2aa3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    2aa8:	89 db                	mov    %ebx,%ebx
+    2aaa:	48 69 db 1f 85 eb 51 	imul   $0x51eb851f,%rbx,%rbx
+    2ab1:	44 89 e0             	mov    %r12d,%eax
+    2ab4:	41 89 c8             	mov    %ecx,%r8d
+    2ab7:	48 c1 eb 25          	shr    $0x25,%rbx
+    2abb:	6b fb 64             	imul   $0x64,%ebx,%edi
+    2abe:	29 f8                	sub    %edi,%eax
+    2ac0:	44 89 e7             	mov    %r12d,%edi
+    2ac3:	41 89 dc             	mov    %ebx,%r12d
+    2ac6:	01 c0                	add    %eax,%eax
+    2ac8:	44 8d 48 01          	lea    0x1(%rax),%r9d
+    2acc:	0f b6 04 06          	movzbl (%rsi,%rax,1),%eax
+    2ad0:	46 0f b6 0c 0e       	movzbl (%rsi,%r9,1),%r9d
+    2ad5:	46 88 0c 02          	mov    %r9b,(%rdx,%r8,1)
+    2ad9:	44 8d 41 ff          	lea    -0x1(%rcx),%r8d
+    2add:	83 e9 02             	sub    $0x2,%ecx
+    2ae0:	42 88 04 02          	mov    %al,(%rdx,%r8,1)
+    2ae4:	81 ff 0f 27 00 00    	cmp    $0x270f,%edi
+    2aea:	77 bc                	ja     2aa8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x108>
+    2aec:	81 ff e7 03 00 00    	cmp    $0x3e7,%edi
+    2af2:	0f 86 60 05 00 00    	jbe    3058 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6b8>
+    2af8:	45 01 e4             	add    %r12d,%r12d
+    2afb:	41 8d 44 24 01       	lea    0x1(%r12),%eax
+    2b00:	46 0f b6 24 26       	movzbl (%rsi,%r12,1),%r12d
+    2b05:	0f b6 04 06          	movzbl (%rsi,%rax,1),%eax
+    2b09:	88 42 01             	mov    %al,0x1(%rdx)
+    2b0c:	44 88 22             	mov    %r12b,(%rdx)
+    2b0f:	48 8d 9c 24 e0 00 00 	lea    0xe0(%rsp),%rbx
+    2b16:	00 
+    2b17:	31 d2                	xor    %edx,%edx
+    2b19:	4c 8d a4 24 00 01 00 	lea    0x100(%rsp),%r12
+    2b20:	00 
+    2b21:	48 8d 84 24 10 01 00 	lea    0x110(%rsp),%rax
+    2b28:	00 
+    2b29:	48 89 de             	mov    %rbx,%rsi
+    2b2c:	4c 89 e7             	mov    %r12,%rdi
+    2b2f:	48 c7 84 24 e0 00 00 	movq   $0x16,0xe0(%rsp)
+    2b36:	00 16 00 00 00 
+    2b3b:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2b40:	48 89 84 24 00 01 00 	mov    %rax,0x100(%rsp)
+    2b47:	00 
+    2b48:	e8 43 f6 ff ff       	call   2190 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@plt>
+    2b4d:	48 8b 94 24 e0 00 00 	mov    0xe0(%rsp),%rdx
+    2b54:	00 
+    2b55:	66 0f 6f 05 33 17 00 	movdqa 0x1733(%rip),%xmm0        # 4290 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits+0xd0>
+    2b5c:	00 
+    2b5d:	4c 89 ef             	mov    %r13,%rdi
+    2b60:	48 b9 75 72 65 20 69 	movabs $0x27206e6920657275,%rcx
+    2b67:	6e 20 27 
+    2b6a:	48 89 84 24 00 01 00 	mov    %rax,0x100(%rsp)
+    2b71:	00 
+    2b72:	48 89 94 24 10 01 00 	mov    %rdx,0x110(%rsp)
+    2b79:	00 
+    2b7a:	0f 11 00             	movups %xmm0,(%rax)
+    2b7d:	48 89 48 0e          	mov    %rcx,0xe(%rax)
+    2b81:	48 8b 84 24 00 01 00 	mov    0x100(%rsp),%rax
+    2b88:	00 
+    2b89:	48 89 94 24 08 01 00 	mov    %rdx,0x108(%rsp)
+    2b90:	00 
+    2b91:	c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+    2b95:	e8 c6 f4 ff ff       	call   2060 <strlen@plt>
+    2b9a:	48 89 c2             	mov    %rax,%rdx
+    2b9d:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    2ba4:	ff ff 3f 
+    2ba7:	48 2b 84 24 08 01 00 	sub    0x108(%rsp),%rax
+    2bae:	00 
+    2baf:	48 39 d0             	cmp    %rdx,%rax
+    2bb2:	0f 82 fa 06 00 00    	jb     32b2 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x912>
+    2bb8:	4c 89 ee             	mov    %r13,%rsi
+    2bbb:	4c 89 e7             	mov    %r12,%rdi
+    2bbe:	e8 8d f4 ff ff       	call   2050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    2bc3:	49 89 c4             	mov    %rax,%r12
+    2bc6:	48 8d 84 24 f0 00 00 	lea    0xf0(%rsp),%rax
+    2bcd:	00 
+    2bce:	48 89 84 24 e0 00 00 	mov    %rax,0xe0(%rsp)
+    2bd5:	00 
+    2bd6:	49 8b 14 24          	mov    (%r12),%rdx
+    2bda:	4d 8d 6c 24 10       	lea    0x10(%r12),%r13
+    2bdf:	48 89 04 24          	mov    %rax,(%rsp)
+    2be3:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+    2be8:	4c 39 ea             	cmp    %r13,%rdx
+    2beb:	0f 84 c7 04 00 00    	je     30b8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x718>
+    2bf1:	48 89 94 24 e0 00 00 	mov    %rdx,0xe0(%rsp)
+    2bf8:	00 
+    2bf9:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+    2bfe:	48 89 94 24 f0 00 00 	mov    %rdx,0xf0(%rsp)
+    2c05:	00 
+    2c06:	48 89 84 24 e8 00 00 	mov    %rax,0xe8(%rsp)
+    2c0d:	00 
+    2c0e:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    2c15:	ff ff 3f 
+    2c18:	49 c7 44 24 08 00 00 	movq   $0x0,0x8(%r12)
+    2c1f:	00 00 
+    2c21:	41 c6 44 24 10 00    	movb   $0x0,0x10(%r12)
+    2c27:	48 2b 84 24 e8 00 00 	sub    0xe8(%rsp),%rax
+    2c2e:	00 
+    2c2f:	4d 89 2c 24          	mov    %r13,(%r12)
+    2c33:	48 83 f8 09          	cmp    $0x9,%rax
+    2c37:	0f 86 45 06 00 00    	jbe    3282 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8e2>
+    2c3d:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2c42:	48 8d 35 d0 13 00 00 	lea    0x13d0(%rip),%rsi        # 4019 <_IO_stdin_used+0x19>
+    2c49:	48 89 df             	mov    %rbx,%rdi
+    2c4c:	e8 ff f3 ff ff       	call   2050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    2c51:	48 8d 9c 24 d0 00 00 	lea    0xd0(%rsp),%rbx
+    2c58:	00 
+    2c59:	49 89 c4             	mov    %rax,%r12
+    2c5c:	48 89 9c 24 c0 00 00 	mov    %rbx,0xc0(%rsp)
+    2c63:	00 
+    2c64:	48 8b 00             	mov    (%rax),%rax
+    2c67:	4d 8d 6c 24 10       	lea    0x10(%r12),%r13
+    2c6c:	4d 8b 44 24 08       	mov    0x8(%r12),%r8
+    2c71:	4c 39 e8             	cmp    %r13,%rax
+    2c74:	0f 84 66 04 00 00    	je     30e0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x740>
+    2c7a:	48 89 84 24 c0 00 00 	mov    %rax,0xc0(%rsp)
+    2c81:	00 
+    2c82:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+    2c87:	48 89 84 24 d0 00 00 	mov    %rax,0xd0(%rsp)
+    2c8e:	00 
+    2c8f:	4d 89 2c 24          	mov    %r13,(%r12)
+    2c93:	48 8b 8c 24 c0 00 00 	mov    0xc0(%rsp),%rcx
+    2c9a:	00 
+    2c9b:	4c 89 84 24 c8 00 00 	mov    %r8,0xc8(%rsp)
+    2ca2:	00 
+    2ca3:	48 8b b4 24 20 01 00 	mov    0x120(%rsp),%rsi
+    2caa:	00 
+    2cab:	49 c7 44 24 08 00 00 	movq   $0x0,0x8(%r12)
+    2cb2:	00 00 
+    2cb4:	48 8b 94 24 28 01 00 	mov    0x128(%rsp),%rdx
+    2cbb:	00 
+    2cbc:	41 c6 44 24 10 00    	movb   $0x0,0x10(%r12)
+    2cc2:	49 8d 04 10          	lea    (%r8,%rdx,1),%rax
+    2cc6:	48 39 d9             	cmp    %rbx,%rcx
+    2cc9:	0f 84 21 05 00 00    	je     31f0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x850>
+    2ccf:	48 39 84 24 d0 00 00 	cmp    %rax,0xd0(%rsp)
+    2cd6:	00 
+    2cd7:	73 1a                	jae    2cf3 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x353>
+    2cd9:	48 39 ee             	cmp    %rbp,%rsi
+    2cdc:	0f 84 fe 04 00 00    	je     31e0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x840>
+    2ce2:	48 8b bc 24 30 01 00 	mov    0x130(%rsp),%rdi
+    2ce9:	00 
+    2cea:	48 39 c7             	cmp    %rax,%rdi
+    2ced:	0f 83 ad 03 00 00    	jae    30a0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x700>
+    2cf3:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    2cfa:	ff ff 3f 
+    2cfd:	4c 29 c0             	sub    %r8,%rax
+    2d00:	48 39 d0             	cmp    %rdx,%rax
+    2d03:	0f 82 9d 05 00 00    	jb     32a6 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x906>
+    2d09:	48 8d bc 24 c0 00 00 	lea    0xc0(%rsp),%rdi
+    2d10:	00 
+    2d11:	e8 3a f3 ff ff       	call   2050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    2d16:	4c 8d a4 24 b0 00 00 	lea    0xb0(%rsp),%r12
+    2d1d:	00 
+    2d1e:	4c 8d 78 10          	lea    0x10(%rax),%r15
+    2d22:	49 89 c5             	mov    %rax,%r13
+    2d25:	4c 89 a4 24 a0 00 00 	mov    %r12,0xa0(%rsp)
+    2d2c:	00 
+    2d2d:	48 8b 10             	mov    (%rax),%rdx
+    2d30:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2d34:	4c 39 fa             	cmp    %r15,%rdx
+    2d37:	0f 84 63 04 00 00    	je     31a0 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x800>
+    2d3d:	48 89 94 24 a0 00 00 	mov    %rdx,0xa0(%rsp)
+    2d44:	00 
+    2d45:	49 8b 55 10          	mov    0x10(%r13),%rdx
+    2d49:	48 89 94 24 b0 00 00 	mov    %rdx,0xb0(%rsp)
+    2d50:	00 
+    2d51:	48 89 84 24 a8 00 00 	mov    %rax,0xa8(%rsp)
+    2d58:	00 
+    2d59:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    2d60:	ff ff 3f 
+    2d63:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+    2d6a:	00 
+    2d6b:	41 c6 45 10 00       	movb   $0x0,0x10(%r13)
+    2d70:	48 2b 84 24 a8 00 00 	sub    0xa8(%rsp),%rax
+    2d77:	00 
+    2d78:	4d 89 7d 00          	mov    %r15,0x0(%r13)
+    2d7c:	48 83 f8 0b          	cmp    $0xb,%rax
+    2d80:	0f 86 f0 04 00 00    	jbe    3276 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8d6>
+    2d86:	48 8d bc 24 a0 00 00 	lea    0xa0(%rsp),%rdi
+    2d8d:	00 
+    2d8e:	ba 0c 00 00 00       	mov    $0xc,%edx
+    2d93:	48 8d 35 8a 12 00 00 	lea    0x128a(%rip),%rsi        # 4024 <_IO_stdin_used+0x24>
+    2d9a:	e8 b1 f2 ff ff       	call   2050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    2d9f:	4c 8d ac 24 90 00 00 	lea    0x90(%rsp),%r13
+    2da6:	00 
+    2da7:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    2dab:	49 89 c7             	mov    %rax,%r15
+    2dae:	4c 89 ac 24 80 00 00 	mov    %r13,0x80(%rsp)
+    2db5:	00 
+    2db6:	48 8b 10             	mov    (%rax),%rdx
+    2db9:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2dbd:	48 39 ca             	cmp    %rcx,%rdx
+    2dc0:	0f 84 aa 03 00 00    	je     3170 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x7d0>
+    2dc6:	48 89 94 24 80 00 00 	mov    %rdx,0x80(%rsp)
+    2dcd:	00 
+    2dce:	49 8b 57 10          	mov    0x10(%r15),%rdx
+    2dd2:	48 89 94 24 90 00 00 	mov    %rdx,0x90(%rsp)
+    2dd9:	00 
+    2dda:	49 89 0f             	mov    %rcx,(%r15)
+    2ddd:	4c 89 f7             	mov    %r14,%rdi
+    2de0:	49 c7 47 08 00 00 00 	movq   $0x0,0x8(%r15)
+    2de7:	00 
+    2de8:	41 c6 47 10 00       	movb   $0x0,0x10(%r15)
+    2ded:	48 89 84 24 88 00 00 	mov    %rax,0x88(%rsp)
+    2df4:	00 
+    2df5:	e8 66 f2 ff ff       	call   2060 <strlen@plt>
+    2dfa:	48 89 c2             	mov    %rax,%rdx
+    2dfd:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    2e04:	ff ff 3f 
+    2e07:	48 2b 84 24 88 00 00 	sub    0x88(%rsp),%rax
+    2e0e:	00 
+    2e0f:	48 39 d0             	cmp    %rdx,%rax
+    2e12:	0f 82 82 04 00 00    	jb     329a <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8fa>
+    2e18:	48 8d bc 24 80 00 00 	lea    0x80(%rsp),%rdi
+    2e1f:	00 
+    2e20:	4c 89 f6             	mov    %r14,%rsi
+    2e23:	e8 28 f2 ff ff       	call   2050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    2e28:	4c 8d 74 24 70       	lea    0x70(%rsp),%r14
+    2e2d:	49 89 c7             	mov    %rax,%r15
+    2e30:	4c 89 74 24 60       	mov    %r14,0x60(%rsp)
+    2e35:	48 8b 00             	mov    (%rax),%rax
+    2e38:	49 8d 4f 10          	lea    0x10(%r15),%rcx
+    2e3c:	49 8b 57 08          	mov    0x8(%r15),%rdx
+    2e40:	48 39 c8             	cmp    %rcx,%rax
+    2e43:	0f 84 f7 02 00 00    	je     3140 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x7a0>
+    2e49:	48 89 44 24 60       	mov    %rax,0x60(%rsp)
+    2e4e:	49 8b 47 10          	mov    0x10(%r15),%rax
+    2e52:	48 89 44 24 70       	mov    %rax,0x70(%rsp)
+    2e57:	48 b8 ff ff ff ff ff 	movabs $0x3fffffffffffffff,%rax
+    2e5e:	ff ff 3f 
+    2e61:	48 89 54 24 68       	mov    %rdx,0x68(%rsp)
+    2e66:	48 29 d0             	sub    %rdx,%rax
+    2e69:	49 89 0f             	mov    %rcx,(%r15)
+    2e6c:	49 c7 47 08 00 00 00 	movq   $0x0,0x8(%r15)
+    2e73:	00 
+    2e74:	41 c6 47 10 00       	movb   $0x0,0x10(%r15)
+    2e79:	48 83 f8 0e          	cmp    $0xe,%rax
+    2e7d:	0f 86 0b 04 00 00    	jbe    328e <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x8ee>
+    2e83:	48 8d 7c 24 60       	lea    0x60(%rsp),%rdi
+    2e88:	ba 0f 00 00 00       	mov    $0xf,%edx
+    2e8d:	48 8d 35 9d 11 00 00 	lea    0x119d(%rip),%rsi        # 4031 <_IO_stdin_used+0x31>
+    2e94:	e8 b7 f1 ff ff       	call   2050 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm@plt>
+    2e99:	48 89 c1             	mov    %rax,%rcx
+    2e9c:	48 8d 05 cd 2d 00 00 	lea    0x2dcd(%rip),%rax        # 5c70 <_ZTVN5boost12static_views17assertion_failureE>
+    2ea3:	4c 8d 7c 24 50       	lea    0x50(%rsp),%r15
+    2ea8:	4c 89 7c 24 40       	mov    %r15,0x40(%rsp)
+    2ead:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+    2eb1:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    2eb5:	48 83 c0 18          	add    $0x18,%rax
+    2eb9:	66 48 0f 6e c8       	movq   %rax,%xmm1
+    2ebe:	66 48 0f 6e d2       	movq   %rdx,%xmm2
+    2ec3:	48 8b 11             	mov    (%rcx),%rdx
+    2ec6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+    2eca:	66 0f 6c ca          	punpcklqdq %xmm2,%xmm1
+    2ece:	0f 29 4c 24 10       	movaps %xmm1,0x10(%rsp)
+    2ed3:	48 39 f2             	cmp    %rsi,%rdx
+    2ed6:	0f 84 2c 02 00 00    	je     3108 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x768>
+    2edc:	48 89 54 24 40       	mov    %rdx,0x40(%rsp)
+    2ee1:	48 8b 51 10          	mov    0x10(%rcx),%rdx
+    2ee5:	48 89 54 24 50       	mov    %rdx,0x50(%rsp)
+    2eea:	48 89 31             	mov    %rsi,(%rcx)
+    2eed:	48 8b 7c 24 20       	mov    0x20(%rsp),%rdi
+    2ef2:	48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    2ef7:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+    2efe:	00 
+    2eff:	c6 41 10 00          	movb   $0x0,0x10(%rcx)
+    2f03:	48 89 44 24 48       	mov    %rax,0x48(%rsp)
+    2f08:	e8 13 f2 ff ff       	call   2120 <_ZNSt13runtime_errorC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE@plt>
+    2f0d:	48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    2f12:	4c 39 ff             	cmp    %r15,%rdi
+    2f15:	74 0e                	je     2f25 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x585>
+    2f17:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+    2f1c:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2f20:	e8 bb f1 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2f25:	48 8b 7c 24 60       	mov    0x60(%rsp),%rdi
+    2f2a:	4c 39 f7             	cmp    %r14,%rdi
+    2f2d:	74 0e                	je     2f3d <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x59d>
+    2f2f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+    2f34:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2f38:	e8 a3 f1 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2f3d:	48 8b bc 24 80 00 00 	mov    0x80(%rsp),%rdi
+    2f44:	00 
+    2f45:	4c 39 ef             	cmp    %r13,%rdi
+    2f48:	74 11                	je     2f5b <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x5bb>
+    2f4a:	48 8b 84 24 90 00 00 	mov    0x90(%rsp),%rax
+    2f51:	00 
+    2f52:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2f56:	e8 85 f1 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2f5b:	48 8b bc 24 a0 00 00 	mov    0xa0(%rsp),%rdi
+    2f62:	00 
+    2f63:	4c 39 e7             	cmp    %r12,%rdi
+    2f66:	74 11                	je     2f79 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x5d9>
+    2f68:	48 8b 84 24 b0 00 00 	mov    0xb0(%rsp),%rax
+    2f6f:	00 
+    2f70:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2f74:	e8 67 f1 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2f79:	48 8b bc 24 c0 00 00 	mov    0xc0(%rsp),%rdi
+    2f80:	00 
+    2f81:	48 39 df             	cmp    %rbx,%rdi
+    2f84:	74 11                	je     2f97 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x5f7>
+    2f86:	48 8b 84 24 d0 00 00 	mov    0xd0(%rsp),%rax
+    2f8d:	00 
+    2f8e:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2f92:	e8 49 f1 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2f97:	48 8b bc 24 e0 00 00 	mov    0xe0(%rsp),%rdi
+    2f9e:	00 
+    2f9f:	48 8b 04 24          	mov    (%rsp),%rax
+    2fa3:	48 39 c7             	cmp    %rax,%rdi
+    2fa6:	74 11                	je     2fb9 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x619>
+    2fa8:	48 8b 84 24 f0 00 00 	mov    0xf0(%rsp),%rax
+    2faf:	00 
+    2fb0:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2fb4:	e8 27 f1 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2fb9:	48 8b bc 24 00 01 00 	mov    0x100(%rsp),%rdi
+    2fc0:	00 
+    2fc1:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    2fc6:	48 39 c7             	cmp    %rax,%rdi
+    2fc9:	74 11                	je     2fdc <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x63c>
+    2fcb:	48 8b 84 24 10 01 00 	mov    0x110(%rsp),%rax
+    2fd2:	00 
+    2fd3:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2fd7:	e8 04 f1 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2fdc:	48 8b bc 24 20 01 00 	mov    0x120(%rsp),%rdi
+    2fe3:	00 
+    2fe4:	48 39 ef             	cmp    %rbp,%rdi
+    2fe7:	74 11                	je     2ffa <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x65a>
+    2fe9:	48 8b 84 24 30 01 00 	mov    0x130(%rsp),%rax
+    2ff0:	00 
+    2ff1:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    2ff5:	e8 e6 f0 ff ff       	call   20e0 <_ZdlPvm@plt>
+    2ffa:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    2fff:	66 0f 6f 5c 24 10    	movdqa 0x10(%rsp),%xmm3
+    3005:	0f 11 18             	movups %xmm3,(%rax)
+    3008:	48 81 c4 48 01 00 00 	add    $0x148,%rsp
+    300f:	5b                   	pop    %rbx
+    3010:	5d                   	pop    %rbp
+    3011:	41 5c                	pop    %r12
+    3013:	41 5d                	pop    %r13
+    3015:	41 5e                	pop    %r14
+    3017:	41 5f                	pop    %r15
+    3019:	c3                   	ret
+    301a:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    3021:	00 
+    3022:	ba 2d 00 00 00       	mov    $0x2d,%edx
+    3027:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    302e:	00 
+    302f:	41 8d 77 01          	lea    0x1(%r15),%esi
+    3033:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    3038:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    303f:	00 
+    3040:	e8 cb f0 ff ff       	call   2110 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>
+    3045:	41 0f b6 d7          	movzbl %r15b,%edx
+    3049:	48 03 94 24 20 01 00 	add    0x120(%rsp),%rdx
+    3050:	00 
+    3051:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3058:	41 83 c4 30          	add    $0x30,%r12d
+    305c:	e9 ab fa ff ff       	jmp    2b0c <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x16c>
+    3061:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3068:	be 09 00 00 00       	mov    $0x9,%esi
+    306d:	8d 4e ff             	lea    -0x1(%rsi),%ecx
+    3070:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    3077:	00 
+    3078:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    307f:	00 
+    3080:	89 0c 24             	mov    %ecx,(%rsp)
+    3083:	44 01 fe             	add    %r15d,%esi
+    3086:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    308b:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    3092:	00 
+    3093:	e9 e9 f9 ff ff       	jmp    2a81 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xe1>
+    3098:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    309f:	00 
+    30a0:	48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    30a5:	31 d2                	xor    %edx,%edx
+    30a7:	31 f6                	xor    %esi,%esi
+    30a9:	e8 b2 f0 ff ff       	call   2160 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm@plt>
+    30ae:	e9 63 fc ff ff       	jmp    2d16 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x376>
+    30b3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    30b8:	48 89 c2             	mov    %rax,%rdx
+    30bb:	48 83 c2 01          	add    $0x1,%rdx
+    30bf:	0f 84 41 fb ff ff    	je     2c06 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x266>
+    30c5:	48 8b 3c 24          	mov    (%rsp),%rdi
+    30c9:	4c 89 ee             	mov    %r13,%rsi
+    30cc:	e8 ef ef ff ff       	call   20c0 <memcpy@plt>
+    30d1:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+    30d6:	e9 2b fb ff ff       	jmp    2c06 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x266>
+    30db:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    30e0:	4c 89 c2             	mov    %r8,%rdx
+    30e3:	48 83 c2 01          	add    $0x1,%rdx
+    30e7:	0f 84 a2 fb ff ff    	je     2c8f <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x2ef>
+    30ed:	4c 89 ee             	mov    %r13,%rsi
+    30f0:	48 89 df             	mov    %rbx,%rdi
+    30f3:	e8 c8 ef ff ff       	call   20c0 <memcpy@plt>
+    30f8:	4d 8b 44 24 08       	mov    0x8(%r12),%r8
+    30fd:	e9 8d fb ff ff       	jmp    2c8f <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x2ef>
+    3102:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    3108:	48 89 c2             	mov    %rax,%rdx
+    310b:	48 83 c2 01          	add    $0x1,%rdx
+    310f:	0f 84 d5 fd ff ff    	je     2eea <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x54a>
+    3115:	4c 89 ff             	mov    %r15,%rdi
+    3118:	48 89 4c 24 38       	mov    %rcx,0x38(%rsp)
+    311d:	48 89 74 24 30       	mov    %rsi,0x30(%rsp)
+    3122:	e8 99 ef ff ff       	call   20c0 <memcpy@plt>
+    3127:	48 8b 4c 24 38       	mov    0x38(%rsp),%rcx
+    312c:	48 8b 74 24 30       	mov    0x30(%rsp),%rsi
+    3131:	48 8b 41 08          	mov    0x8(%rcx),%rax
+    3135:	e9 b0 fd ff ff       	jmp    2eea <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x54a>
+    313a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    3140:	48 89 d0             	mov    %rdx,%rax
+    3143:	48 83 c0 01          	add    $0x1,%rax
+    3147:	0f 84 0a fd ff ff    	je     2e57 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x4b7>
+    314d:	48 89 c2             	mov    %rax,%rdx
+    3150:	48 89 ce             	mov    %rcx,%rsi
+    3153:	4c 89 f7             	mov    %r14,%rdi
+    3156:	48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    315b:	e8 60 ef ff ff       	call   20c0 <memcpy@plt>
+    3160:	49 8b 57 08          	mov    0x8(%r15),%rdx
+    3164:	48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    3169:	e9 e9 fc ff ff       	jmp    2e57 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x4b7>
+    316e:	66 90                	xchg   %ax,%ax
+    3170:	48 89 c2             	mov    %rax,%rdx
+    3173:	48 83 c2 01          	add    $0x1,%rdx
+    3177:	0f 84 5d fc ff ff    	je     2dda <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x43a>
+    317d:	48 89 ce             	mov    %rcx,%rsi
+    3180:	4c 89 ef             	mov    %r13,%rdi
+    3183:	48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    3188:	e8 33 ef ff ff       	call   20c0 <memcpy@plt>
+    318d:	49 8b 47 08          	mov    0x8(%r15),%rax
+    3191:	48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    3196:	e9 3f fc ff ff       	jmp    2dda <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x43a>
+    319b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    31a0:	48 89 c2             	mov    %rax,%rdx
+    31a3:	48 83 c2 01          	add    $0x1,%rdx
+    31a7:	0f 84 a4 fb ff ff    	je     2d51 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x3b1>
+    31ad:	4c 89 fe             	mov    %r15,%rsi
+    31b0:	4c 89 e7             	mov    %r12,%rdi
+    31b3:	e8 08 ef ff ff       	call   20c0 <memcpy@plt>
+    31b8:	49 8b 45 08          	mov    0x8(%r13),%rax
+    31bc:	e9 90 fb ff ff       	jmp    2d51 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x3b1>
+    31c1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    31c8:	b9 07 00 00 00       	mov    $0x7,%ecx
+    31cd:	be 08 00 00 00       	mov    $0x8,%esi
+    31d2:	e9 99 fe ff ff       	jmp    3070 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    31d7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    31de:	00 00 
+    31e0:	bf 0f 00 00 00       	mov    $0xf,%edi
+    31e5:	e9 00 fb ff ff       	jmp    2cea <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x34a>
+    31ea:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    31f0:	48 83 f8 0f          	cmp    $0xf,%rax
+    31f4:	0f 86 f9 fa ff ff    	jbe    2cf3 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x353>
+    31fa:	48 39 ee             	cmp    %rbp,%rsi
+    31fd:	0f 85 df fa ff ff    	jne    2ce2 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x342>
+    3203:	e9 eb fa ff ff       	jmp    2cf3 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x353>
+    3208:	48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    320f:	00 
+    3210:	41 8d 77 02          	lea    0x2(%r15),%esi
+    3214:	ba 2d 00 00 00       	mov    $0x2d,%edx
+    3219:	48 8d ac 24 30 01 00 	lea    0x130(%rsp),%rbp
+    3220:	00 
+    3221:	48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    3226:	48 89 ac 24 20 01 00 	mov    %rbp,0x120(%rsp)
+    322d:	00 
+    322e:	e8 dd ee ff ff       	call   2110 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc@plt>
+    3233:	41 0f b6 d7          	movzbl %r15b,%edx
+    3237:	48 8d 35 82 0f 00 00 	lea    0xf82(%rip),%rsi        # 41c0 <_ZZNSt8__detail18__to_chars_10_implIjEEvPcjT_E8__digits>
+    323e:	48 03 94 24 20 01 00 	add    0x120(%rsp),%rdx
+    3245:	00 
+    3246:	e9 ad f8 ff ff       	jmp    2af8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x158>
+    324b:	b9 03 00 00 00       	mov    $0x3,%ecx
+    3250:	be 04 00 00 00       	mov    $0x4,%esi
+    3255:	e9 16 fe ff ff       	jmp    3070 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    325a:	b9 02 00 00 00       	mov    $0x2,%ecx
+    325f:	be 03 00 00 00       	mov    $0x3,%esi
+    3264:	44 89 e3             	mov    %r12d,%ebx
+    3267:	e9 04 fe ff ff       	jmp    3070 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x6d0>
+    326c:	b9 05 00 00 00       	mov    $0x5,%ecx
+    3271:	e9 e6 f7 ff ff       	jmp    2a5c <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xbc>
+    3276:	48 8d 3d 87 0d 00 00 	lea    0xd87(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    327d:	e8 fe ed ff ff       	call   2080 <_ZSt20__throw_length_errorPKc@plt>
+    3282:	48 8d 3d 7b 0d 00 00 	lea    0xd7b(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    3289:	e8 f2 ed ff ff       	call   2080 <_ZSt20__throw_length_errorPKc@plt>
+    328e:	48 8d 3d 6f 0d 00 00 	lea    0xd6f(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    3295:	e8 e6 ed ff ff       	call   2080 <_ZSt20__throw_length_errorPKc@plt>
+    329a:	48 8d 3d 63 0d 00 00 	lea    0xd63(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    32a1:	e8 da ed ff ff       	call   2080 <_ZSt20__throw_length_errorPKc@plt>
+    32a6:	48 8d 3d 57 0d 00 00 	lea    0xd57(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    32ad:	e8 ce ed ff ff       	call   2080 <_ZSt20__throw_length_errorPKc@plt>
+    32b2:	48 8d 3d 4b 0d 00 00 	lea    0xd4b(%rip),%rdi        # 4004 <_IO_stdin_used+0x4>
+    32b9:	e8 c2 ed ff ff       	call   2080 <_ZSt20__throw_length_errorPKc@plt>
+    32be:	49 89 c5             	mov    %rax,%r13
+    32c1:	eb 44                	jmp    3307 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x967>
+    32c3:	49 89 c7             	mov    %rax,%r15
+    32c6:	eb 13                	jmp    32db <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x93b>
+    32c8:	48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    32cd:	4c 39 ff             	cmp    %r15,%rdi
+    32d0:	0f 85 13 01 00 00    	jne    33e9 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xa49>
+    32d6:	4c 8b 7c 24 20       	mov    0x20(%rsp),%r15
+    32db:	48 8b 7c 24 60       	mov    0x60(%rsp),%rdi
+    32e0:	4c 39 f7             	cmp    %r14,%rdi
+    32e3:	74 0e                	je     32f3 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x953>
+    32e5:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+    32ea:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    32ee:	e8 ed ed ff ff       	call   20e0 <_ZdlPvm@plt>
+    32f3:	48 8b bc 24 80 00 00 	mov    0x80(%rsp),%rdi
+    32fa:	00 
+    32fb:	4c 39 ef             	cmp    %r13,%rdi
+    32fe:	0f 85 cf 00 00 00    	jne    33d3 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xa33>
+    3304:	4d 89 fd             	mov    %r15,%r13
+    3307:	48 8b bc 24 a0 00 00 	mov    0xa0(%rsp),%rdi
+    330e:	00 
+    330f:	4c 39 e7             	cmp    %r12,%rdi
+    3312:	74 11                	je     3325 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x985>
+    3314:	48 8b 84 24 b0 00 00 	mov    0xb0(%rsp),%rax
+    331b:	00 
+    331c:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3320:	e8 bb ed ff ff       	call   20e0 <_ZdlPvm@plt>
+    3325:	48 8b bc 24 c0 00 00 	mov    0xc0(%rsp),%rdi
+    332c:	00 
+    332d:	48 39 df             	cmp    %rbx,%rdi
+    3330:	74 11                	je     3343 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9a3>
+    3332:	48 8b 84 24 d0 00 00 	mov    0xd0(%rsp),%rax
+    3339:	00 
+    333a:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    333e:	e8 9d ed ff ff       	call   20e0 <_ZdlPvm@plt>
+    3343:	4c 89 eb             	mov    %r13,%rbx
+    3346:	48 8b bc 24 e0 00 00 	mov    0xe0(%rsp),%rdi
+    334d:	00 
+    334e:	48 8b 04 24          	mov    (%rsp),%rax
+    3352:	48 39 c7             	cmp    %rax,%rdi
+    3355:	74 11                	je     3368 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9c8>
+    3357:	48 8b 84 24 f0 00 00 	mov    0xf0(%rsp),%rax
+    335e:	00 
+    335f:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3363:	e8 78 ed ff ff       	call   20e0 <_ZdlPvm@plt>
+    3368:	48 8b bc 24 00 01 00 	mov    0x100(%rsp),%rdi
+    336f:	00 
+    3370:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    3375:	48 39 c7             	cmp    %rax,%rdi
+    3378:	74 11                	je     338b <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9eb>
+    337a:	48 8b 84 24 10 01 00 	mov    0x110(%rsp),%rax
+    3381:	00 
+    3382:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    3386:	e8 55 ed ff ff       	call   20e0 <_ZdlPvm@plt>
+    338b:	48 8b bc 24 20 01 00 	mov    0x120(%rsp),%rdi
+    3392:	00 
+    3393:	48 39 ef             	cmp    %rbp,%rdi
+    3396:	74 11                	je     33a9 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0xa09>
+    3398:	48 8b 84 24 30 01 00 	mov    0x130(%rsp),%rax
+    339f:	00 
+    33a0:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    33a4:	e8 37 ed ff ff       	call   20e0 <_ZdlPvm@plt>
+    33a9:	48 89 df             	mov    %rbx,%rdi
+    33ac:	e8 cf ed ff ff       	call   2180 <_Unwind_Resume@plt>
+    33b1:	49 89 c7             	mov    %rax,%r15
+    33b4:	e9 3a ff ff ff       	jmp    32f3 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x953>
+    33b9:	49 89 c5             	mov    %rax,%r13
+    33bc:	e9 64 ff ff ff       	jmp    3325 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x985>
+    33c1:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    33c6:	e9 fd fe ff ff       	jmp    32c8 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x928>
+    33cb:	48 89 c3             	mov    %rax,%rbx
+    33ce:	e9 73 ff ff ff       	jmp    3346 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9a6>
+    33d3:	48 8b 84 24 90 00 00 	mov    0x90(%rsp),%rax
+    33da:	00 
+    33db:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    33df:	e8 fc ec ff ff       	call   20e0 <_ZdlPvm@plt>
+    33e4:	e9 1b ff ff ff       	jmp    3304 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x964>
+    33e9:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+    33ee:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    33f2:	e8 e9 ec ff ff       	call   20e0 <_ZdlPvm@plt>
+    33f7:	e9 da fe ff ff       	jmp    32d6 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x936>
+    33fc:	48 89 c3             	mov    %rax,%rbx
+    33ff:	eb 8a                	jmp    338b <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9eb>
+    3401:	48 89 c3             	mov    %rax,%rbx
+    3404:	e9 5f ff ff ff       	jmp    3368 <_ZN5boost12static_views17assertion_failureC1EPKciS3_+0x9c8>
+    3409:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000003410 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_>:
+    3410:	41 55                	push   %r13
+    3412:	4c 8d 6f 10          	lea    0x10(%rdi),%r13
+    3416:	41 54                	push   %r12
+    3418:	55                   	push   %rbp
+    3419:	53                   	push   %rbx
+    341a:	48 83 ec 18          	sub    $0x18,%rsp
+    341e:	4c 89 2f             	mov    %r13,(%rdi)
+    3421:	48 85 f6             	test   %rsi,%rsi
+    3424:	0f 84 8c 00 00 00    	je     34b6 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_+0xa6>
+    342a:	48 89 fb             	mov    %rdi,%rbx
+    342d:	48 89 f7             	mov    %rsi,%rdi
+    3430:	49 89 f4             	mov    %rsi,%r12
+    3433:	e8 28 ec ff ff       	call   2060 <strlen@plt>
+    3438:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    343d:	48 89 c5             	mov    %rax,%rbp
+    3440:	48 83 f8 0f          	cmp    $0xf,%rax
+    3444:	77 3a                	ja     3480 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_+0x70>
+    3446:	48 83 f8 01          	cmp    $0x1,%rax
+    344a:	75 24                	jne    3470 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_+0x60>
+    344c:	41 0f b6 14 24       	movzbl (%r12),%edx
+    3451:	88 53 10             	mov    %dl,0x10(%rbx)
+    3454:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    3458:	41 c6 44 05 00 00    	movb   $0x0,0x0(%r13,%rax,1)
+    345e:	48 83 c4 18          	add    $0x18,%rsp
+    3462:	5b                   	pop    %rbx
+    3463:	5d                   	pop    %rbp
+    3464:	41 5c                	pop    %r12
+    3466:	41 5d                	pop    %r13
+    3468:	c3                   	ret
+    3469:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3470:	48 85 c0             	test   %rax,%rax
+    3473:	74 df                	je     3454 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_+0x44>
+    3475:	eb 27                	jmp    349e <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_+0x8e>
+    3477:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    347e:	00 00 
+    3480:	48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    3485:	31 d2                	xor    %edx,%edx
+    3487:	48 89 df             	mov    %rbx,%rdi
+    348a:	e8 01 ed ff ff       	call   2190 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm@plt>
+    348f:	48 89 03             	mov    %rax,(%rbx)
+    3492:	49 89 c5             	mov    %rax,%r13
+    3495:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    349a:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    349e:	4c 89 ef             	mov    %r13,%rdi
+    34a1:	48 89 ea             	mov    %rbp,%rdx
+    34a4:	4c 89 e6             	mov    %r12,%rsi
+    34a7:	e8 14 ec ff ff       	call   20c0 <memcpy@plt>
+    34ac:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    34b1:	4c 8b 2b             	mov    (%rbx),%r13
+    34b4:	eb 9e                	jmp    3454 <_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_+0x44>
+    34b6:	48 8d 3d 0b 0c 00 00 	lea    0xc0b(%rip),%rdi        # 40c8 <_IO_stdin_used+0xc8>
+    34bd:	e8 de eb ff ff       	call   20a0 <_ZSt19__throw_logic_errorPKc@plt>
+
+Disassembly of section .fini:
+
+00000000000034c4 <_fini>:
+    34c4:	48 83 ec 08          	sub    $0x8,%rsp
+    34c8:	48 83 c4 08          	add    $0x8,%rsp
+    34cc:	c3                   	ret
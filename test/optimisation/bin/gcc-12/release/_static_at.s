@@ -0,0 +1,473 @@
+
+bin/gcc-12/release/_static_at:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	48 83 ec 08          	sub    $0x8,%rsp
+    1004:	48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	48 85 c0             	test   %rax,%rax
+    100e:	74 02                	je     1012 <_init+0x12>
+    1010:	ff d0                	call   *%rax
+    1012:	48 83 c4 08          	add    $0x8,%rsp
+    1016:	c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <_ZNSo3putEc@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <_ZNSo3putEc@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <_ZNSo3putEc@GLIBCXX_3.4>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <_ZSt9terminatev@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <_ZSt9terminatev@GLIBCXX_3.4>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <__cxa_allocate_exception@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <__cxa_allocate_exception@CXXABI_1.3>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <_ZNSo9_M_insertImEERSoT_@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <_ZNSo9_M_insertImEERSoT_@GLIBCXX_3.4.9>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <__cxa_free_exception@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <__cxa_free_exception@CXXABI_1.3>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <__cxa_atexit@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <__cxa_atexit@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <_ZdlPvm@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <_ZdlPvm@CXXABI_1.3.9>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <_ZNSt13runtime_errorD2Ev@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <_ZNSt13runtime_errorD2Ev@GLIBCXX_3.4>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@GLIBCXX_3.4.9>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <_ZNSt8ios_base4InitC1Ev@plt>:
+    10c0:	ff 25 82 2f 00 00    	jmp    *0x2f82(%rip)        # 4048 <_ZNSt8ios_base4InitC1Ev@GLIBCXX_3.4>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <__cxa_throw@plt>:
+    10d0:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 4050 <__cxa_throw@CXXABI_1.3>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <_Unwind_Resume@plt>:
+    10e0:	ff 25 72 2f 00 00    	jmp    *0x2f72(%rip)        # 4058 <_Unwind_Resume@GCC_3.0>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010f0 <_ZNSt13runtime_errorC2EPKc@plt>:
+    10f0:	ff 25 6a 2f 00 00    	jmp    *0x2f6a(%rip)        # 4060 <_ZNSt13runtime_errorC2EPKc@GLIBCXX_3.4.21>
+    10f6:	68 0c 00 00 00       	push   $0xc
+    10fb:	e9 20 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001100 <__cxa_finalize@plt>:
+    1100:	ff 25 aa 2e 00 00    	jmp    *0x2eaa(%rip)        # 3fb0 <__cxa_finalize@GLIBC_2.2.5>
+    1106:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001110 <_ZN5boost12static_views6detail17make_out_of_boundEPKc>:
+    1110:	55                   	push   %rbp
+    1111:	48 89 fd             	mov    %rdi,%rbp
+    1114:	bf 18 00 00 00       	mov    $0x18,%edi
+    1119:	53                   	push   %rbx
+    111a:	48 83 ec 18          	sub    $0x18,%rsp
+    111e:	48 8d 05 bb 2b 00 00 	lea    0x2bbb(%rip),%rax        # 3ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    1125:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    1129:	48 83 c0 18          	add    $0x18,%rax
+    112d:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    1132:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1137:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    113b:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    113f:	e8 0c ff ff ff       	call   1050 <__cxa_allocate_exception@plt>
+    1144:	48 89 ee             	mov    %rbp,%rsi
+    1147:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    114b:	48 89 c3             	mov    %rax,%rbx
+    114e:	e8 9d ff ff ff       	call   10f0 <_ZNSt13runtime_errorC2EPKc@plt>
+    1153:	0f 28 14 24          	movaps (%rsp),%xmm2
+    1157:	48 8d 15 22 03 00 00 	lea    0x322(%rip),%rdx        # 1480 <_ZN5boost12static_views12out_of_boundD1Ev>
+    115e:	48 89 df             	mov    %rbx,%rdi
+    1161:	48 8d 35 18 2b 00 00 	lea    0x2b18(%rip),%rsi        # 3c80 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    1168:	0f 11 13             	movups %xmm2,(%rbx)
+    116b:	e8 60 ff ff ff       	call   10d0 <__cxa_throw@plt>
+    1170:	48 89 c5             	mov    %rax,%rbp
+    1173:	48 89 df             	mov    %rbx,%rdi
+    1176:	e8 f5 fe ff ff       	call   1070 <__cxa_free_exception@plt>
+    117b:	48 89 ef             	mov    %rbp,%rdi
+    117e:	e8 5d ff ff ff       	call   10e0 <_Unwind_Resume@plt>
+
+0000000000001183 <_ZN5boost12static_views6detail16make_full_bucketEPKc>:
+    1183:	55                   	push   %rbp
+    1184:	48 89 fd             	mov    %rdi,%rbp
+    1187:	bf 18 00 00 00       	mov    $0x18,%edi
+    118c:	53                   	push   %rbx
+    118d:	48 83 ec 18          	sub    $0x18,%rsp
+    1191:	48 8d 05 b8 2b 00 00 	lea    0x2bb8(%rip),%rax        # 3d50 <_ZTVN5boost12static_views11full_bucketE>
+    1198:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    119c:	48 83 c0 18          	add    $0x18,%rax
+    11a0:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    11a5:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    11aa:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    11ae:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    11b2:	e8 99 fe ff ff       	call   1050 <__cxa_allocate_exception@plt>
+    11b7:	48 89 ee             	mov    %rbp,%rsi
+    11ba:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    11be:	48 89 c3             	mov    %rax,%rbx
+    11c1:	e8 2a ff ff ff       	call   10f0 <_ZNSt13runtime_errorC2EPKc@plt>
+    11c6:	0f 28 14 24          	movaps (%rsp),%xmm2
+    11ca:	48 8d 15 1f 03 00 00 	lea    0x31f(%rip),%rdx        # 14f0 <_ZN5boost12static_views11full_bucketD1Ev>
+    11d1:	48 89 df             	mov    %rbx,%rdi
+    11d4:	48 8d 35 cd 2a 00 00 	lea    0x2acd(%rip),%rsi        # 3ca8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    11db:	0f 11 13             	movups %xmm2,(%rbx)
+    11de:	e8 ed fe ff ff       	call   10d0 <__cxa_throw@plt>
+    11e3:	48 89 c5             	mov    %rax,%rbp
+    11e6:	48 89 df             	mov    %rbx,%rdi
+    11e9:	e8 82 fe ff ff       	call   1070 <__cxa_free_exception@plt>
+    11ee:	48 89 ef             	mov    %rbp,%rdi
+    11f1:	e8 ea fe ff ff       	call   10e0 <_Unwind_Resume@plt>
+
+00000000000011f6 <_ZN5boost12static_views6detail17make_out_of_boundEv>:
+    11f6:	55                   	push   %rbp
+    11f7:	bf 18 00 00 00       	mov    $0x18,%edi
+    11fc:	53                   	push   %rbx
+    11fd:	48 83 ec 18          	sub    $0x18,%rsp
+    1201:	48 8d 05 d8 2a 00 00 	lea    0x2ad8(%rip),%rax        # 3ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    1208:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    120c:	48 83 c0 18          	add    $0x18,%rax
+    1210:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    1215:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    121a:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    121e:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    1222:	e8 29 fe ff ff       	call   1050 <__cxa_allocate_exception@plt>
+    1227:	48 8d 35 d6 0d 00 00 	lea    0xdd6(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    122e:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    1232:	48 89 c3             	mov    %rax,%rbx
+    1235:	e8 b6 fe ff ff       	call   10f0 <_ZNSt13runtime_errorC2EPKc@plt>
+    123a:	0f 28 14 24          	movaps (%rsp),%xmm2
+    123e:	48 8d 15 3b 02 00 00 	lea    0x23b(%rip),%rdx        # 1480 <_ZN5boost12static_views12out_of_boundD1Ev>
+    1245:	48 89 df             	mov    %rbx,%rdi
+    1248:	48 8d 35 31 2a 00 00 	lea    0x2a31(%rip),%rsi        # 3c80 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    124f:	0f 11 13             	movups %xmm2,(%rbx)
+    1252:	e8 79 fe ff ff       	call   10d0 <__cxa_throw@plt>
+    1257:	48 89 c5             	mov    %rax,%rbp
+    125a:	48 89 df             	mov    %rbx,%rdi
+    125d:	e8 0e fe ff ff       	call   1070 <__cxa_free_exception@plt>
+    1262:	48 89 ef             	mov    %rbp,%rdi
+    1265:	e8 76 fe ff ff       	call   10e0 <_Unwind_Resume@plt>
+
+000000000000126a <_ZN5boost12static_views6detail16make_full_bucketEv>:
+    126a:	55                   	push   %rbp
+    126b:	bf 18 00 00 00       	mov    $0x18,%edi
+    1270:	53                   	push   %rbx
+    1271:	48 83 ec 18          	sub    $0x18,%rsp
+    1275:	48 8d 05 d4 2a 00 00 	lea    0x2ad4(%rip),%rax        # 3d50 <_ZTVN5boost12static_views11full_bucketE>
+    127c:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    1280:	48 83 c0 18          	add    $0x18,%rax
+    1284:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    1289:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    128e:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1292:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    1296:	e8 b5 fd ff ff       	call   1050 <__cxa_allocate_exception@plt>
+    129b:	48 8d 35 77 0d 00 00 	lea    0xd77(%rip),%rsi        # 2019 <_IO_stdin_used+0x19>
+    12a2:	48 8d 78 08          	lea    0x8(%rax),%rdi
+    12a6:	48 89 c3             	mov    %rax,%rbx
+    12a9:	e8 42 fe ff ff       	call   10f0 <_ZNSt13runtime_errorC2EPKc@plt>
+    12ae:	0f 28 14 24          	movaps (%rsp),%xmm2
+    12b2:	48 8d 15 37 02 00 00 	lea    0x237(%rip),%rdx        # 14f0 <_ZN5boost12static_views11full_bucketD1Ev>
+    12b9:	48 89 df             	mov    %rbx,%rdi
+    12bc:	48 8d 35 e5 29 00 00 	lea    0x29e5(%rip),%rsi        # 3ca8 <_ZTVN10__cxxabiv121__vmi_class_type_infoE@CXXABI_1.3>
+    12c3:	0f 11 13             	movups %xmm2,(%rbx)
+    12c6:	e8 05 fe ff ff       	call   10d0 <__cxa_throw@plt>
+    12cb:	48 89 c5             	mov    %rax,%rbp
+    12ce:	48 89 df             	mov    %rbx,%rdi
+    12d1:	e8 9a fd ff ff       	call   1070 <__cxa_free_exception@plt>
+    12d6:	48 89 ef             	mov    %rbp,%rdi
+    12d9:	e8 02 fe ff ff       	call   10e0 <_Unwind_Resume@plt>
+    12de:	66 90                	xchg   %ax,%ax
+
+00000000000012e0 <main>:
+    12e0:	48 83 ec 18          	sub    $0x18,%rsp
+    12e4:	e8 87 01 00 00       	call   1470 <_Z5test1v>
+    12e9:	66 83 f8 07          	cmp    $0x7,%ax
+    12ed:	75 4d                	jne    133c <main+0x5c>
+    12ef:	e8 7c 01 00 00       	call   1470 <_Z5test1v>
+    12f4:	48 8b 3d c5 2c 00 00 	mov    0x2cc5(%rip),%rdi        # 3fc0 <_ZSt4cout@GLIBCXX_3.4>
+    12fb:	0f b7 f0             	movzwl %ax,%esi
+    12fe:	e8 5d fd ff ff       	call   1060 <_ZNSo9_M_insertImEERSoT_@plt>
+    1303:	c6 44 24 0f 0a       	movb   $0xa,0xf(%rsp)
+    1308:	48 89 c7             	mov    %rax,%rdi
+    130b:	48 8b 00             	mov    (%rax),%rax
+    130e:	48 8b 40 e8          	mov    -0x18(%rax),%rax
+    1312:	48 83 7c 07 10 00    	cmpq   $0x0,0x10(%rdi,%rax,1)
+    1318:	75 11                	jne    132b <main+0x4b>
+    131a:	be 0a 00 00 00       	mov    $0xa,%esi
+    131f:	e8 0c fd ff ff       	call   1030 <_ZNSo3putEc@plt>
+    1324:	31 c0                	xor    %eax,%eax
+    1326:	48 83 c4 18          	add    $0x18,%rsp
+    132a:	c3                   	ret
+    132b:	48 8d 74 24 0f       	lea    0xf(%rsp),%rsi
+    1330:	ba 01 00 00 00       	mov    $0x1,%edx
+    1335:	e8 76 fd ff ff       	call   10b0 <_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@plt>
+    133a:	eb e8                	jmp    1324 <main+0x44>
+    133c:	e8 ff fc ff ff       	call   1040 <_ZSt9terminatev@plt>
+    1341:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1348:	00 00 00 00 
+    134c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001350 <_GLOBAL__sub_I_static_at.cpp>:
+    1350:	53                   	push   %rbx
+    1351:	48 8d 1d 39 2d 00 00 	lea    0x2d39(%rip),%rbx        # 4091 <_ZStL8__ioinit>
+    1358:	48 89 df             	mov    %rbx,%rdi
+    135b:	e8 60 fd ff ff       	call   10c0 <_ZNSt8ios_base4InitC1Ev@plt>
+    1360:	48 8b 3d 79 2c 00 00 	mov    0x2c79(%rip),%rdi        # 3fe0 <_ZNSt8ios_base4InitD1Ev@GLIBCXX_3.4>
+    1367:	48 89 de             	mov    %rbx,%rsi
+    136a:	5b                   	pop    %rbx
+    136b:	48 8d 15 fe 2c 00 00 	lea    0x2cfe(%rip),%rdx        # 4070 <__dso_handle>
+    1372:	e9 09 fd ff ff       	jmp    1080 <__cxa_atexit@plt>
+    1377:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    137e:	00 00 
+
+0000000000001380 <_start>:
+    1380:	31 ed                	xor    %ebp,%ebp
+    1382:	49 89 d1             	mov    %rdx,%r9
+    1385:	5e                   	pop    %rsi
+    1386:	48 89 e2             	mov    %rsp,%rdx
+    1389:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    138d:	50                   	push   %rax
+    138e:	54                   	push   %rsp
+    138f:	45 31 c0             	xor    %r8d,%r8d
+    1392:	31 c9                	xor    %ecx,%ecx
+    1394:	48 8d 3d 45 ff ff ff 	lea    -0xbb(%rip),%rdi        # 12e0 <main>
+    139b:	ff 15 17 2c 00 00    	call   *0x2c17(%rip)        # 3fb8 <__libc_start_main@GLIBC_2.34>
+    13a1:	f4                   	hlt
+    13a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13a9:	00 00 00 
+    13ac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000013b0 <deregister_tm_clones>:
+    13b0:	48 8d 3d d9 2c 00 00 	lea    0x2cd9(%rip),%rdi        # 4090 <__TMC_END__>
+    13b7:	48 8d 05 d2 2c 00 00 	lea    0x2cd2(%rip),%rax        # 4090 <__TMC_END__>
+    13be:	48 39 f8             	cmp    %rdi,%rax
+    13c1:	74 15                	je     13d8 <deregister_tm_clones+0x28>
+    13c3:	48 8b 05 fe 2b 00 00 	mov    0x2bfe(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    13ca:	48 85 c0             	test   %rax,%rax
+    13cd:	74 09                	je     13d8 <deregister_tm_clones+0x28>
+    13cf:	ff e0                	jmp    *%rax
+    13d1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    13d8:	c3                   	ret
+    13d9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013e0 <register_tm_clones>:
+    13e0:	48 8d 3d a9 2c 00 00 	lea    0x2ca9(%rip),%rdi        # 4090 <__TMC_END__>
+    13e7:	48 8d 35 a2 2c 00 00 	lea    0x2ca2(%rip),%rsi        # 4090 <__TMC_END__>
+    13ee:	48 29 fe             	sub    %rdi,%rsi
+    13f1:	48 89 f0             	mov    %rsi,%rax
+    13f4:	48 c1 ee 3f          	shr    $0x3f,%rsi
+    13f8:	48 c1 f8 03          	sar    $0x3,%rax
+    13fc:	48 01 c6             	add    %rax,%rsi
+    13ff:	48 d1 fe             	sar    %rsi
+    1402:	74 14                	je     1418 <register_tm_clones+0x38>
+    1404:	48 8b 05 cd 2b 00 00 	mov    0x2bcd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    140b:	48 85 c0             	test   %rax,%rax
+    140e:	74 08                	je     1418 <register_tm_clones+0x38>
+    1410:	ff e0                	jmp    *%rax
+    1412:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1418:	c3                   	ret
+    1419:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001420 <__do_global_dtors_aux>:
+    1420:	f3 0f 1e fa          	endbr64
+    1424:	80 3d 65 2c 00 00 00 	cmpb   $0x0,0x2c65(%rip)        # 4090 <__TMC_END__>
+    142b:	75 2b                	jne    1458 <__do_global_dtors_aux+0x38>
+    142d:	55                   	push   %rbp
+    142e:	48 83 3d 7a 2b 00 00 	cmpq   $0x0,0x2b7a(%rip)        # 3fb0 <__cxa_finalize@GLIBC_2.2.5>
+    1435:	00 
+    1436:	48 89 e5             	mov    %rsp,%rbp
+    1439:	74 0c                	je     1447 <__do_global_dtors_aux+0x27>
+    143b:	48 8b 3d 2e 2c 00 00 	mov    0x2c2e(%rip),%rdi        # 4070 <__dso_handle>
+    1442:	e8 b9 fc ff ff       	call   1100 <__cxa_finalize@plt>
+    1447:	e8 64 ff ff ff       	call   13b0 <deregister_tm_clones>
+    144c:	c6 05 3d 2c 00 00 01 	movb   $0x1,0x2c3d(%rip)        # 4090 <__TMC_END__>
+    1453:	5d                   	pop    %rbp
+    1454:	c3                   	ret
+    1455:	0f 1f 00             	nopl   (%rax)
+    1458:	c3                   	ret
+    1459:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001460 <frame_dummy>:
+    1460:	f3 0f 1e fa          	endbr64
+    1464:	e9 77 ff ff ff       	jmp    13e0 <register_tm_clones>
+    1469:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001470 <_Z5test1v>:
+    1470:	b8 07 00 00 00       	mov    $0x7,%eax
+    1475:	c3                   	ret
+    1476:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    147d:	00 00 00 
+
+0000000000001480 <_ZN5boost12static_views12out_of_boundD1Ev>:
+    1480:	48 8d 05 59 28 00 00 	lea    0x2859(%rip),%rax        # 3ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    1487:	48 83 c7 08          	add    $0x8,%rdi
+    148b:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    148f:	48 83 c0 18          	add    $0x18,%rax
+    1493:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    1498:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    149d:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    14a1:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    14a5:	e9 f6 fb ff ff       	jmp    10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    14aa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000014b0 <_ZTv0_n24_N5boost12static_views12out_of_boundD1Ev>:
+    14b0:	48 8b 07             	mov    (%rdi),%rax
+    14b3:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    14b7:	48 8d 05 22 28 00 00 	lea    0x2822(%rip),%rax        # 3ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    14be:	48 83 c7 08          	add    $0x8,%rdi
+    14c2:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    14c6:	48 83 c0 18          	add    $0x18,%rax
+    14ca:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    14cf:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    14d4:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    14d8:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    14dc:	e9 bf fb ff ff       	jmp    10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    14e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14e8:	00 00 00 
+    14eb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000014f0 <_ZN5boost12static_views11full_bucketD1Ev>:
+    14f0:	48 8d 05 59 28 00 00 	lea    0x2859(%rip),%rax        # 3d50 <_ZTVN5boost12static_views11full_bucketE>
+    14f7:	48 83 c7 08          	add    $0x8,%rdi
+    14fb:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    14ff:	48 83 c0 18          	add    $0x18,%rax
+    1503:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    1508:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    150d:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1511:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    1515:	e9 86 fb ff ff       	jmp    10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    151a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000001520 <_ZTv0_n24_N5boost12static_views11full_bucketD1Ev>:
+    1520:	48 8b 07             	mov    (%rdi),%rax
+    1523:	48 03 78 e8          	add    -0x18(%rax),%rdi
+    1527:	48 8d 05 22 28 00 00 	lea    0x2822(%rip),%rax        # 3d50 <_ZTVN5boost12static_views11full_bucketE>
+    152e:	48 83 c7 08          	add    $0x8,%rdi
+    1532:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    1536:	48 83 c0 18          	add    $0x18,%rax
+    153a:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    153f:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1544:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1548:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    154c:	e9 4f fb ff ff       	jmp    10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    1551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1558:	00 00 00 
+    155b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001560 <_ZN5boost12static_views12out_of_boundD0Ev>:
+    1560:	48 8d 05 79 27 00 00 	lea    0x2779(%rip),%rax        # 3ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    1567:	53                   	push   %rbx
+    1568:	48 89 fb             	mov    %rdi,%rbx
+    156b:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    156f:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    1573:	48 83 c0 18          	add    $0x18,%rax
+    1577:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    157c:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1581:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1585:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    1589:	e8 12 fb ff ff       	call   10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    158e:	48 89 df             	mov    %rbx,%rdi
+    1591:	be 18 00 00 00       	mov    $0x18,%esi
+    1596:	5b                   	pop    %rbx
+    1597:	e9 f4 fa ff ff       	jmp    1090 <_ZdlPvm@plt>
+    159c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000015a0 <_ZTv0_n24_N5boost12static_views12out_of_boundD0Ev>:
+    15a0:	53                   	push   %rbx
+    15a1:	48 8b 07             	mov    (%rdi),%rax
+    15a4:	48 89 fb             	mov    %rdi,%rbx
+    15a7:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    15ab:	48 8d 05 2e 27 00 00 	lea    0x272e(%rip),%rax        # 3ce0 <_ZTVN5boost12static_views12out_of_boundE>
+    15b2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    15b6:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    15ba:	48 83 c0 18          	add    $0x18,%rax
+    15be:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    15c3:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    15c8:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    15cc:	0f 11 03             	movups %xmm0,(%rbx)
+    15cf:	e8 cc fa ff ff       	call   10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    15d4:	48 89 df             	mov    %rbx,%rdi
+    15d7:	be 18 00 00 00       	mov    $0x18,%esi
+    15dc:	5b                   	pop    %rbx
+    15dd:	e9 ae fa ff ff       	jmp    1090 <_ZdlPvm@plt>
+    15e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15e9:	00 00 00 
+    15ec:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000015f0 <_ZN5boost12static_views11full_bucketD0Ev>:
+    15f0:	48 8d 05 59 27 00 00 	lea    0x2759(%rip),%rax        # 3d50 <_ZTVN5boost12static_views11full_bucketE>
+    15f7:	53                   	push   %rbx
+    15f8:	48 89 fb             	mov    %rdi,%rbx
+    15fb:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    15ff:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    1603:	48 83 c0 18          	add    $0x18,%rax
+    1607:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    160c:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1611:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1615:	0f 11 47 f8          	movups %xmm0,-0x8(%rdi)
+    1619:	e8 82 fa ff ff       	call   10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    161e:	48 89 df             	mov    %rbx,%rdi
+    1621:	be 18 00 00 00       	mov    $0x18,%esi
+    1626:	5b                   	pop    %rbx
+    1627:	e9 64 fa ff ff       	jmp    1090 <_ZdlPvm@plt>
+    162c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001630 <_ZTv0_n24_N5boost12static_views11full_bucketD0Ev>:
+    1630:	53                   	push   %rbx
+    1631:	48 8b 07             	mov    (%rdi),%rax
+    1634:	48 89 fb             	mov    %rdi,%rbx
+    1637:	48 03 58 e8          	add    -0x18(%rax),%rbx
+    163b:	48 8d 05 0e 27 00 00 	lea    0x270e(%rip),%rax        # 3d50 <_ZTVN5boost12static_views11full_bucketE>
+    1642:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    1646:	48 8d 50 48          	lea    0x48(%rax),%rdx
+    164a:	48 83 c0 18          	add    $0x18,%rax
+    164e:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    1653:	66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1658:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    165c:	0f 11 03             	movups %xmm0,(%rbx)
+    165f:	e8 3c fa ff ff       	call   10a0 <_ZNSt13runtime_errorD2Ev@plt>
+    1664:	48 89 df             	mov    %rbx,%rdi
+    1667:	be 18 00 00 00       	mov    $0x18,%esi
+    166c:	5b                   	pop    %rbx
+    166d:	e9 1e fa ff ff       	jmp    1090 <_ZdlPvm@plt>
+
+Disassembly of section .fini:
+
+0000000000001674 <_fini>:
+    1674:	48 83 ec 08          	sub    $0x8,%rsp
+    1678:	48 83 c4 08          	add    $0x8,%rsp
+    167c:	c3                   	ret
@@ -0,0 +1,90 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that chains of adaptors are fused when they are built, so that an
+// access costs the same no matter how long the chain is. test1 and test2
+// access a long chain of drops, takes and slices and a single take of a
+// drop respectively. test3 and test4 do the same for through views.
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/slice.hpp>
+#include <boost/static_views/through.hpp>
+
+namespace sv = boost::static_views;
+
+static int data[100];
+static int indices[100];
+
+// Offsets are read at run time, so that accesses are not folded into
+// constants.
+static int volatile offset = 1;
+
+static auto make_chain(int const a)
+{
+    return sv::drop_exactly(
+        sv::take_exactly(
+            sv::slice(sv::drop_exactly(sv::raw_view(data), a), a, 90), 80),
+        a);
+}
+
+static auto make_window(int const a)
+{
+    return sv::take_exactly(sv::drop_exactly(sv::raw_view(data), 3 * a), 79);
+}
+
+static auto make_lookup()
+{
+    return sv::through(
+        sv::through(sv::through(sv::raw_view(data), sv::raw_view(indices)),
+            sv::raw_view(indices)),
+        sv::raw_view(indices));
+}
+
+static auto make_single_lookup()
+{
+    return sv::through(sv::raw_view(data),
+        sv::through(sv::raw_view(indices),
+            sv::through(sv::raw_view(indices), sv::raw_view(indices))));
+}
+
+static auto const chain         = make_chain(offset);
+static auto const window        = make_window(offset);
+static auto const lookup        = make_lookup();
+static auto const single_lookup = make_single_lookup();
+
+BOOST_STATIC_VIEWS_NOINLINE auto test1(int const i) -> int
+{
+    return chain.unsafe_at(i);
+}
+
+BOOST_STATIC_VIEWS_NOINLINE auto test2(int const i) -> int
+{
+    return window.unsafe_at(i);
+}
+
+BOOST_STATIC_VIEWS_NOINLINE auto test3(int const i) -> int
+{
+    return lookup.unsafe_at(i);
+}
+
+BOOST_STATIC_VIEWS_NOINLINE auto test4(int const i) -> int
+{
+    return single_lookup.unsafe_at(i);
+}
+
+int main(int argc, char** argv)
+{
+    for (auto i = 0; i < 100; ++i) {
+        data[i]    = i;
+        indices[i] = (i * 7) % 100;
+    }
+    auto const i = argc > 1 ? std::atoi(argv[1]) : 0;
+    if (test1(i) != test2(i) || test3(i) != test4(i)) std::terminate();
+    std::cout << test1(i) << ' ' << test3(i) << '\n';
+    return 0;
+}
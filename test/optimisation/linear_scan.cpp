@@ -0,0 +1,47 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that tiny maps created by make_static_map_impl<> use a linear scan
+// which compiles to a short sequence of compares rather than hashing followed
+// by a bucket search.
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+struct field {
+    int         key;
+    char const* value;
+};
+
+static constexpr field data[] = {{1, "one"}, {2, "two"}, {3, "three"},
+    {5, "five"}, {8, "eight"}, {13, "thirteen"}, {21, "twenty one"},
+    {34, "thirty four"}};
+
+static constexpr auto small_map = boost::static_views::make_static_map_impl<>{}(
+    boost::static_views::raw_view(data), &field::key, &field::value);
+
+static_assert(decltype(small_map)::bucket_count() == 1,
+    "A linear scan should have been selected.");
+
+BOOST_STATIC_VIEWS_NOINLINE auto test1(int const x) -> char const*
+{
+    auto const* p = small_map.find(x);
+    return p == nullptr ? nullptr : p->value;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2) {
+        std::cout << "2 arguments, please!\n";
+        return 0;
+    }
+    auto const x = static_cast<int>(std::stol(argv[1]));
+    auto const* p = test1(x);
+    if (p != nullptr) std::cout << p << '\n';
+    return 0;
+}
@@ -0,0 +1,71 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that lookups in a static_map with the disabled (default)
+// no_lookup_counters policy generate no more code than a lookup which calls
+// hashed_view_impl::lookup directly, i.e. without any instrumentation hooks.
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <boost/static_views/detail/compose.hpp>
+#include <boost/static_views/hash_c.hpp>
+#include <boost/static_views/hashed.hpp>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+struct field {
+    int         key;
+    char const* value;
+};
+
+static constexpr field data[] = {{1, "one"}, {2, "two"}, {3, "three"},
+    {5, "five"}, {8, "eight"}, {13, "thirteen"}, {21, "twenty one"},
+    {34, "thirty four"}};
+
+// Baseline: the lookup static_map performs, minus the hooks.
+struct key_equal_to {
+    int key;
+
+    constexpr auto operator()(field const& x) const noexcept -> bool
+    {
+        return x.key == key;
+    }
+};
+
+static constexpr auto plain_view = boost::static_views::hashed<16, 2>(
+    boost::static_views::raw_view(data),
+    boost::static_views::compose(
+        boost::static_views::hash_c{}, &field::key));
+
+static constexpr auto instrumented_map =
+    boost::static_views::make_static_map_impl<16, 2,
+        boost::static_views::no_lookup_counters>{}(
+        boost::static_views::raw_view(data), &field::key, &field::value);
+
+BOOST_STATIC_VIEWS_NOINLINE auto test1(int const x) -> char const*
+{
+    auto const* p = plain_view.lookup(
+        static_cast<std::size_t>(boost::static_views::hash_c{}(x)),
+        key_equal_to{x});
+    return p == nullptr ? nullptr : p->value;
+}
+
+BOOST_STATIC_VIEWS_NOINLINE auto test2(int const x) -> char const*
+{
+    auto const* p = instrumented_map.find(x);
+    return p == nullptr ? nullptr : p->value;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2) {
+        std::cout << "2 arguments, please!\n";
+        return 0;
+    }
+    auto const x = static_cast<int>(std::stol(argv[1]));
+    if (test1(x) != test2(x)) std::terminate();
+    return 0;
+}
@@ -0,0 +1,49 @@
+//          Copyright Tom Westerhout 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that BOOST_STATIC_VIEWS_STATIC_AT compiles to an immediate, i.e.
+// nothing but `mov $imm, %eax; ret`.
+
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <boost/static_views/raw_view.hpp>
+#include <boost/static_views/static_map.hpp>
+
+struct equal_c {
+    constexpr auto operator()(char const* a, char const* b) const noexcept
+        -> bool
+    {
+        while (*a != '\0' && *a == *b) {
+            ++a;
+            ++b;
+        }
+        return *a == *b;
+    }
+};
+
+struct field {
+    char const*   name;
+    std::uint16_t id;
+};
+
+static constexpr field data[] = {{"GET", 1}, {"HEAD", 2}, {"POST", 3},
+    {"PUT", 4}, {"DELETE", 5}, {"CONNECT", 6}, {"OPTIONS", 7}, {"TRACE", 8},
+    {"PATCH", 9}};
+
+static constexpr auto methods = boost::static_views::make_static_map_impl<>{}(
+    boost::static_views::raw_view(data), &field::name, &field::id, equal_c{});
+
+BOOST_STATIC_VIEWS_NOINLINE auto test1() -> std::uint16_t
+{
+    return BOOST_STATIC_VIEWS_STATIC_AT(methods, "OPTIONS");
+}
+
+int main()
+{
+    if (test1() != 7) std::terminate();
+    std::cout << test1() << '\n';
+    return 0;
+}